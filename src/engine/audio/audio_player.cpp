@@ -6,13 +6,14 @@
 
 namespace engine::audio {
 AudioPlayer::~AudioPlayer() {
+    voice_manager_.reset();
     if (music_track_) {
         MIX_DestroyTrack(music_track_);
         music_track_ = nullptr;
     }
 }
 
-AudioPlayer::AudioPlayer(engine::resource::ResourceManager* resource_manager)
+AudioPlayer::AudioPlayer(engine::resource::ResourceManager* resource_manager, int voice_count, int max_sound_instances)
     : resource_manager_(resource_manager) {
     if (!resource_manager_) {
         throw std::runtime_error("AudioPlayer 构造失败: 提供的 ResourceManager 指针为空。");
@@ -22,9 +23,21 @@ AudioPlayer::AudioPlayer(engine::resource::ResourceManager* resource_manager)
     if (!music_track_) {
         throw std::runtime_error("AudioPlayer 构造失败: 无法创建音乐轨道: " + std::string(SDL_GetError()));
     }
+    try {
+        voice_manager_ = std::make_unique<VoiceManager>(mixer_, voice_count, max_sound_instances);
+    } catch (...) {
+        MIX_DestroyTrack(music_track_);     // 析构函数不会被调用
+        music_track_ = nullptr;
+        throw;
+    }
+    // 应用资源映射中为个别音效（如频繁触发的命中、射击音效）指定的实例上限
+    for (const auto& [sound_id, max_instances] : resource_manager_->getSoundInstanceLimits()) {
+        setMaxSoundInstances(sound_id, max_instances);
+    }
+    spdlog::trace("AudioPlayer: 应用了 {} 个音效的实例上限。", resource_manager_->getSoundInstanceLimits().size());
 }
 
-int AudioPlayer::playSound(entt::id_type sound_id) {
+int AudioPlayer::playSound(entt::id_type sound_id, int priority, float gain) {
 
     MIX_Audio* audio = resource_manager_->getSound(sound_id); // 通过 ResourceManager 获取资源
     if (!audio) {
@@ -32,41 +45,54 @@ int AudioPlayer::playSound(entt::id_type sound_id) {
         return -1;
     }
 
-    if (!MIX_PlayAudio(mixer_, audio)) {    // 即发即忘方式播放音效
-        spdlog::error("AudioPlayer: 无法播放音效 id: '{}': {}", sound_id, SDL_GetError());
+    if (!voice_manager_->play(audio, sound_id, priority, gain)) {    // 由声部管理器分配轨道播放
         return -1;
     }
     spdlog::trace("AudioPlayer: 播放音效 id: '{}'。", sound_id);
     return 0;
 }
 
-int AudioPlayer::playSound(entt::hashed_string hashed_path) {
+int AudioPlayer::playSound(entt::hashed_string hashed_path, int priority, float gain) {
     MIX_Audio* audio = resource_manager_->getSound(hashed_path, hashed_path.data()); // 通过 ResourceManager 获取资源
     if (!audio) {
         spdlog::error("AudioPlayer: 无法获取音效 id: {}, path: {} 播放。", hashed_path.value(), hashed_path.data());
         return -1;
     }
 
-    if (!MIX_PlayAudio(mixer_, audio)) {    // 即发即忘方式播放音效
-        spdlog::error("AudioPlayer: 无法播放音效 id: {}, path: {}: {}", hashed_path.value(), hashed_path.data(), SDL_GetError());
+    if (!voice_manager_->play(audio, hashed_path.value(), priority, gain)) {    // 由声部管理器分配轨道播放
         return -1;
     }
     spdlog::trace("AudioPlayer: 播放音效 id: {}, path: {}。", hashed_path.value(), hashed_path.data());
     return 0;
 }
 
+void AudioPlayer::beginFrame() {
+    voice_manager_->beginFrame();
+}
+
+void AudioPlayer::stopAllSounds() {
+    voice_manager_->stopAll();
+    spdlog::trace("AudioPlayer: 停止所有音效。");
+}
+
+void AudioPlayer::setMaxSoundInstances(entt::id_type sound_id, int max_instances) {
+    voice_manager_->setMaxInstances(sound_id, max_instances);
+}
+
+const VoiceStats& AudioPlayer::getVoiceStats() const {
+    return voice_manager_->getLastFrameStats();
+}
+
 bool AudioPlayer::playMusic(entt::id_type music_id, int loops, int fade_in_ms) {
     if (music_id == current_music_id_) return true;      // 如果当前音乐已经在播放，则不重复播放
     current_music_id_ = music_id;
-    MIX_Audio* music = resource_manager_->getMusic(music_id); // 通过 ResourceManager 获取资源
-    if (!music) {
+    MIX_StopTrack(music_track_, 0);         // 立即停止之前的音乐
+    // 设置音乐轨道的音频源（由 ResourceManager 按加载策略决定流式播放或使用常驻内存的音频）
+    if (!resource_manager_->bindMusic(music_track_, music_id)) {
         spdlog::error("AudioPlayer: 无法获取音乐 '{}' 播放。", music_id);
         return false;
     }
 
-    MIX_StopTrack(music_track_, 0);         // 立即停止之前的音乐
-    MIX_SetTrackAudio(music_track_, music); // 设置音乐轨道的音频源
-
     // 配置播放参数（循环次数、淡入时长）
     SDL_PropertiesID props = SDL_CreateProperties();
     SDL_SetNumberProperty(props, MIX_PROP_PLAY_LOOPS_NUMBER, loops);
@@ -87,15 +113,13 @@ bool AudioPlayer::playMusic(entt::id_type music_id, int loops, int fade_in_ms) {
 bool AudioPlayer::playMusic(entt::hashed_string hashed_path, int loops, int fade_in_ms) {
     if (hashed_path.value() == current_music_id_) return true;      // 如果当前音乐已经在播放，则不重复播放
     current_music_id_ = hashed_path;
-    MIX_Audio* music = resource_manager_->getMusic(hashed_path, hashed_path.data()); // 通过 ResourceManager 获取资源
-    if (!music) {
+    MIX_StopTrack(music_track_, 0);         // 立即停止之前的音乐
+    // 设置音乐轨道的音频源（由 ResourceManager 按加载策略决定流式播放或使用常驻内存的音频）
+    if (!resource_manager_->bindMusic(music_track_, hashed_path.value(), hashed_path.data())) {
         spdlog::error("AudioPlayer: 无法获取音乐 id: {}, path: {} 播放。", hashed_path.value(), hashed_path.data());
         return false;
     }
 
-    MIX_StopTrack(music_track_, 0);         // 立即停止之前的音乐
-    MIX_SetTrackAudio(music_track_, music); // 设置音乐轨道的音频源
-
     // 配置播放参数（循环次数、淡入时长）
     SDL_PropertiesID props = SDL_CreateProperties();
     SDL_SetNumberProperty(props, MIX_PROP_PLAY_LOOPS_NUMBER, loops);
@@ -1,4 +1,6 @@
 #pragma once
+#include "voice_manager.h"
+#include <memory>
 #include <string_view>
 #include <entt/entity/fwd.hpp>
 
@@ -22,13 +24,20 @@ private:
     engine::resource::ResourceManager* resource_manager_;   ///< @brief 指向 ResourceManager 的非拥有指针，用于加载和管理音频资源。
     MIX_Mixer* mixer_{nullptr};         ///< @brief SDL_mixer 混音器指针（非拥有）。
     MIX_Track* music_track_{nullptr};   ///< @brief 专用于背景音乐播放的轨道（拥有）。
+    std::unique_ptr<VoiceManager> voice_manager_;   ///< @brief 音效声部管理器（固定数量的音效轨道）。
     entt::id_type current_music_id_;    ///< @brief 当前正在播放的音乐ID，用于避免重复播放同一音乐。
 
 public:
     /**
-     * @brief 构造函数，使用 ResourceManager 初始化。
+     * @brief 构造函数，使用 ResourceManager 初始化，并应用资源映射中指定的音效实例上限。
+     * @note 必须在 ResourceManager 载入资源映射之后构造。
+     * @param resource_manager 资源管理器。
+     * @param voice_count 音效声部数量。
+     * @param max_sound_instances 每个音效默认同时播放的实例上限。
      */
-    explicit AudioPlayer(engine::resource::ResourceManager* resource_manager);
+    explicit AudioPlayer(engine::resource::ResourceManager* resource_manager,
+                         int voice_count = VoiceManager::DEFAULT_VOICE_COUNT,
+                         int max_sound_instances = 4);
     ~AudioPlayer();
 
     // 删除复制/移动操作
@@ -39,20 +48,46 @@ public:
 
     // --- 播放控制方法 ---
     /**
-     * @brief 播放音效。
+     * @brief 播放音效（通过声部管理器，可能被合并、限制或抢占）。
      * @note 必须确保 ResourceManager 加载了音效。
      * @param sound_id 音效ID。
-     * @return 成功返回 0，出错返回 -1。
+     * @param priority 优先级（SOUND_PRIORITY_*）。
+     * @param gain 音量（0.0-1.0，用于距离衰减，<= 0 时不播放）。
+     * @return 成功返回 0（包括被合并或限制），出错返回 -1。
      */
-    int playSound(entt::id_type sound_id);
+    int playSound(entt::id_type sound_id, int priority = SOUND_PRIORITY_NORMAL, float gain = 1.0f);
 
     /**
-     * @brief 播放音效。
+     * @brief 播放音效（通过声部管理器，可能被合并、限制或抢占）。
      * @note 如果尚未缓存，则通过 ResourceManager 加载音效。
      * @param hashed_path 音效文件路径。
-     * @return 成功返回 0，出错返回 -1。
+     * @param priority 优先级（SOUND_PRIORITY_*）。
+     * @param gain 音量（0.0-1.0，用于距离衰减，<= 0 时不播放）。
+     * @return 成功返回 0（包括被合并或限制），出错返回 -1。
      */
-    int playSound(entt::hashed_string hashed_path);
+    int playSound(entt::hashed_string hashed_path, int priority = SOUND_PRIORITY_NORMAL, float gain = 1.0f);
+
+    /**
+     * @brief 帧开始时调用：刷新声部状态并结算上一帧的声部统计。
+     */
+    void beginFrame();
+
+    /**
+     * @brief 立即停止所有音效。
+     */
+    void stopAllSounds();
+
+    /**
+     * @brief 设置某个音效同时播放的实例上限。
+     * @param sound_id 音效ID。
+     * @param max_instances 实例上限。
+     */
+    void setMaxSoundInstances(entt::id_type sound_id, int max_instances);
+
+    /**
+     * @brief 获取上一帧的声部统计。
+     */
+    const VoiceStats& getVoiceStats() const;
 
     /**
      * @brief 播放背景音乐。如果正在播放，则停止之前的音乐。
@@ -0,0 +1,149 @@
+#include "voice_manager.h"
+#include <SDL3_mixer/SDL_mixer.h>
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <spdlog/spdlog.h>
+
+namespace engine::audio {
+
+VoiceManager::VoiceManager(MIX_Mixer* mixer, int voice_count, int default_max_instances)
+    : mixer_(mixer), default_max_instances_(std::max(default_max_instances, 1)) {
+    voices_.resize(static_cast<size_t>(std::max(voice_count, 1)));
+    for (auto& voice : voices_) {
+        voice.track_ = MIX_CreateTrack(mixer_);
+        if (!voice.track_) {
+            // 析构函数不会被调用，先销毁已创建的轨道
+            for (auto& created : voices_) {
+                if (created.track_) MIX_DestroyTrack(created.track_);
+            }
+            throw std::runtime_error("VoiceManager 构造失败: 无法创建音效轨道: " + std::string(SDL_GetError()));
+        }
+    }
+    frame_sounds_.reserve(voices_.size());
+    frame_stats_.voice_count_ = voices_.size();
+    last_frame_stats_.voice_count_ = voices_.size();
+    spdlog::trace("VoiceManager: 创建了 {} 个音效声部，默认实例上限 {}。", voices_.size(), default_max_instances_);
+}
+
+VoiceManager::~VoiceManager() {
+    for (auto& voice : voices_) {
+        if (voice.track_) {
+            MIX_DestroyTrack(voice.track_);
+            voice.track_ = nullptr;
+        }
+    }
+}
+
+bool VoiceManager::play(MIX_Audio* audio, entt::id_type sound_id, int priority, float gain) {
+    ++frame_stats_.requests_;
+    if (gain <= 0.0f) {
+        ++frame_stats_.inaudible_;
+        return true;
+    }
+
+    // 同一帧内重复的音效：合并到已开始的声部，只取较大的音量
+    if (auto* voice = findFrameVoice(sound_id); voice) {
+        ++frame_stats_.deduplicated_;
+        if (gain > voice->gain_) {
+            voice->gain_ = gain;
+            MIX_SetTrackGain(voice->track_, gain);
+        }
+        voice->priority_ = std::max(voice->priority_, priority);
+        return true;
+    }
+
+    // 单个音效的实例上限
+    const auto instances = std::count_if(voices_.begin(), voices_.end(), [sound_id](const Voice& voice) {
+        return voice.playing_ && voice.sound_id_ == sound_id;
+    });
+    if (instances >= getMaxInstances(sound_id)) {
+        ++frame_stats_.capped_;
+        return true;
+    }
+
+    auto* voice = acquireVoice(priority);
+    if (!voice) {
+        ++frame_stats_.rejected_;
+        return true;
+    }
+
+    if (!MIX_SetTrackAudio(voice->track_, audio) || !MIX_SetTrackGain(voice->track_, gain) || !MIX_PlayTrack(voice->track_, 0)) {
+        spdlog::error("VoiceManager: 无法播放音效 id: '{}': {}", sound_id, SDL_GetError());
+        voice->playing_ = false;
+        return false;
+    }
+    voice->sound_id_ = sound_id;
+    voice->priority_ = priority;
+    voice->gain_ = gain;
+    voice->serial_ = next_serial_++;
+    voice->playing_ = true;
+    frame_sounds_.emplace_back(sound_id, static_cast<size_t>(voice - voices_.data()));
+    ++frame_stats_.started_;
+    return true;
+}
+
+void VoiceManager::beginFrame() {
+    frame_sounds_.clear();
+    size_t active = 0;
+    for (auto& voice : voices_) {
+        voice.playing_ = MIX_TrackPlaying(voice.track_);
+        if (voice.playing_) ++active;
+    }
+    frame_stats_.active_voices_ = active;
+    frame_stats_.peak_active_voices_ = std::max(last_frame_stats_.peak_active_voices_, active);
+    last_frame_stats_ = frame_stats_;
+
+    frame_stats_ = VoiceStats{};
+    frame_stats_.voice_count_ = voices_.size();
+    frame_stats_.peak_active_voices_ = last_frame_stats_.peak_active_voices_;
+}
+
+void VoiceManager::stopAll() {
+    for (auto& voice : voices_) {
+        MIX_StopTrack(voice.track_, 0);
+        voice.playing_ = false;
+    }
+    frame_sounds_.clear();
+}
+
+void VoiceManager::setMaxInstances(entt::id_type sound_id, int max_instances) {
+    max_instances_[sound_id] = std::max(max_instances, 1);
+}
+
+int VoiceManager::getMaxInstances(entt::id_type sound_id) const {
+    auto it = max_instances_.find(sound_id);
+    return it != max_instances_.end() ? it->second : default_max_instances_;
+}
+
+VoiceManager::Voice* VoiceManager::findFrameVoice(entt::id_type sound_id) {
+    // 每帧开始的音效很少，线性查找即可
+    for (const auto& [id, index] : frame_sounds_) {
+        if (id == sound_id) return &voices_[index];
+    }
+    return nullptr;
+}
+
+VoiceManager::Voice* VoiceManager::acquireVoice(int priority) {
+    Voice* victim = nullptr;
+    for (auto& voice : voices_) {
+        if (!voice.playing_) return &voice;
+        // 候选：优先级最低，相同时最早开始
+        if (!victim || voice.priority_ < victim->priority_ ||
+            (voice.priority_ == victim->priority_ && voice.serial_ < victim->serial_)) {
+            victim = &voice;
+        }
+    }
+    if (!victim || victim->priority_ > priority) {
+        return nullptr;
+    }
+    // 被抢占的声部可能是本帧刚开始的，需要从去重列表中移除
+    const auto index = static_cast<size_t>(victim - voices_.data());
+    std::erase_if(frame_sounds_, [index](const auto& entry) { return entry.second == index; });
+    MIX_StopTrack(victim->track_, 0);
+    victim->playing_ = false;
+    ++frame_stats_.stolen_;
+    return victim;
+}
+
+} // namespace engine::audio
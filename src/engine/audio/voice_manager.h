@@ -0,0 +1,107 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include <entt/entity/fwd.hpp>
+
+struct MIX_Mixer;
+struct MIX_Track;
+struct MIX_Audio;
+
+namespace engine::audio {
+
+// --- 音效优先级（数值越大越重要，声部不足时可抢占优先级不高于自己的声部） ---
+constexpr int SOUND_PRIORITY_LOW = 0;       ///< @brief 大量重复的战斗音效（命中、发射等）
+constexpr int SOUND_PRIORITY_NORMAL = 1;    ///< @brief 默认优先级
+constexpr int SOUND_PRIORITY_HIGH = 2;      ///< @brief 玩家操作反馈（UI、放置单位等）
+
+/**
+ * @brief 声部统计（每帧重置）
+ */
+struct VoiceStats {
+    size_t voice_count_{0};         ///< @brief 声部池大小
+    size_t active_voices_{0};       ///< @brief 帧开始时正在播放的声部数
+    size_t peak_active_voices_{0};  ///< @brief 历史最多同时播放的声部数
+    size_t requests_{0};            ///< @brief 播放请求数
+    size_t started_{0};             ///< @brief 实际开始播放的次数
+    size_t deduplicated_{0};        ///< @brief 同一帧内重复而被合并的请求
+    size_t capped_{0};              ///< @brief 超过单个音效实例上限而被拒绝的请求
+    size_t stolen_{0};              ///< @brief 抢占其它声部的次数
+    size_t rejected_{0};            ///< @brief 声部不足且无法抢占而被拒绝的请求
+    size_t inaudible_{0};           ///< @brief 音量为0（如距离过远）而被剔除的请求
+};
+
+/**
+ * @brief 音效声部管理器：在固定数量的 MIX_Track 上播放音效
+ *
+ * 每次播放音效不再创建新的轨道，而是从声部池中分配：
+ * - 同一帧内相同音效只播放一次，后来的请求只会提高该声部的音量；
+ * - 每个音效同时播放的实例数有上限（默认上限可按音效单独覆盖）；
+ * - 声部用完时抢占优先级最低（相同时最早开始）的声部，新请求优先级更低则放弃。
+ * 是否正在播放只在 beginFrame() 中向混音器查询一次，帧内结束的声部要到下一帧才会被复用。
+ */
+class VoiceManager final {
+    /// @brief 一个声部（持有一条轨道）
+    struct Voice {
+        MIX_Track* track_{nullptr};
+        entt::id_type sound_id_{0};     ///< @brief 正在播放的音效ID
+        int priority_{0};               ///< @brief 正在播放的音效优先级
+        float gain_{0.0f};              ///< @brief 播放时设置的音量
+        std::uint64_t serial_{0};       ///< @brief 开始播放的序号（越小越早）
+        bool playing_{false};           ///< @brief 是否正在播放（帧开始时刷新，播放时置位）
+    };
+
+    MIX_Mixer* mixer_{nullptr};                                     ///< @brief 混音器（非拥有）
+    std::vector<Voice> voices_;                                     ///< @brief 声部池（轨道由本类拥有）
+    std::unordered_map<entt::id_type, int> max_instances_;          ///< @brief 音效ID -> 同时播放的实例上限
+    int default_max_instances_{4};                                  ///< @brief 默认的实例上限
+    std::vector<std::pair<entt::id_type, size_t>> frame_sounds_;    ///< @brief 本帧已开始的音效ID -> 声部序号
+    std::uint64_t next_serial_{0};
+
+    VoiceStats frame_stats_;                                        ///< @brief 本帧正在累计的统计
+    VoiceStats last_frame_stats_;                                   ///< @brief 上一帧的统计
+
+public:
+    static constexpr int DEFAULT_VOICE_COUNT{32};                   ///< @brief 默认的声部数量
+
+    /**
+     * @brief 构造函数，创建声部池
+     * @param mixer 混音器
+     * @param voice_count 声部数量
+     * @param default_max_instances 每个音效默认的实例上限
+     * @throws std::runtime_error 创建轨道失败时抛出
+     */
+    VoiceManager(MIX_Mixer* mixer, int voice_count, int default_max_instances);
+    ~VoiceManager();
+
+    // 删除复制/移动操作
+    VoiceManager(const VoiceManager&) = delete;
+    VoiceManager& operator=(const VoiceManager&) = delete;
+    VoiceManager(VoiceManager&&) = delete;
+    VoiceManager& operator=(VoiceManager&&) = delete;
+
+    /**
+     * @brief 播放音效
+     * @param audio 音频资源
+     * @param sound_id 音效ID（用于去重与实例上限）
+     * @param priority 优先级（SOUND_PRIORITY_*）
+     * @param gain 音量（0.0-1.0，<= 0 时直接剔除）
+     * @return 出错返回 false；被合并、限制或剔除不算出错，返回 true
+     */
+    bool play(MIX_Audio* audio, entt::id_type sound_id, int priority, float gain);
+
+    void beginFrame();                                              ///< @brief 帧开始：刷新声部状态，结算并重置统计
+    void stopAll();                                                 ///< @brief 立即停止所有声部
+
+    void setMaxInstances(entt::id_type sound_id, int max_instances);    ///< @brief 设置某个音效的实例上限
+    void setDefaultMaxInstances(int max_instances) { default_max_instances_ = max_instances; }
+    const VoiceStats& getLastFrameStats() const { return last_frame_stats_; }   ///< @brief 获取上一帧的统计
+
+private:
+    int getMaxInstances(entt::id_type sound_id) const;
+    Voice* findFrameVoice(entt::id_type sound_id);                  ///< @brief 查找本帧已开始播放该音效的声部
+    Voice* acquireVoice(int priority);                              ///< @brief 分配空闲声部，必要时抢占；失败返回 nullptr
+};
+
+} // namespace engine::audio
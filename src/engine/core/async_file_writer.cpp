@@ -0,0 +1,138 @@
+#include "async_file_writer.h"
+#include "engine/utils/events.h"
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <spdlog/spdlog.h>
+#include <entt/signal/dispatcher.hpp>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace engine::core {
+
+AsyncFileWriter::AsyncFileWriter() : worker_(&AsyncFileWriter::workerLoop, this) {
+    spdlog::trace("后台文件写入器已创建。");
+}
+
+AsyncFileWriter::~AsyncFileWriter() {
+    {
+        std::lock_guard lock(mutex_);
+        stop_ = true;
+    }
+    condition_.notify_all();
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+    spdlog::trace("后台文件写入器已销毁。");
+}
+
+void AsyncFileWriter::write(std::string_view path, std::string data) {
+    {
+        std::lock_guard lock(mutex_);
+        auto it = std::find_if(pending_.begin(), pending_.end(), [path](const PendingWrite& write) { return write.path_ == path; });
+        if (it != pending_.end()) {
+            it->data_ = std::move(data);    // 旧数据还没写出，直接替换
+            spdlog::debug("合并写入: {}", path);
+        } else {
+            pending_.push_back({std::string(path), std::move(data)});
+        }
+    }
+    condition_.notify_all();
+}
+
+void AsyncFileWriter::flush() {
+    std::unique_lock lock(mutex_);
+    condition_.wait(lock, [this] { return pending_.empty() && in_flight_ == 0; });
+}
+
+void AsyncFileWriter::dispatchCompleted(entt::dispatcher& dispatcher) {
+    std::vector<Result> completed;
+    {
+        std::lock_guard lock(mutex_);
+        if (completed_.empty()) return;
+        completed.swap(completed_);
+    }
+    for (auto& result : completed) {
+        dispatcher.enqueue(engine::utils::FileWrittenEvent{std::move(result.path_), result.success_});
+    }
+}
+
+void AsyncFileWriter::workerLoop() {
+    std::unique_lock lock(mutex_);
+    while (true) {
+        condition_.wait(lock, [this] { return stop_ || !pending_.empty(); });
+        if (pending_.empty()) break;    // 只有在没有待写数据时才响应停止请求
+
+        std::vector<PendingWrite> batch;
+        batch.swap(pending_);
+        in_flight_ = batch.size();
+        lock.unlock();
+
+        std::vector<Result> results;
+        results.reserve(batch.size());
+        for (const auto& write : batch) {
+            results.push_back({write.path_, writeAtomic(write.path_, write.data_)});
+        }
+
+        lock.lock();
+        in_flight_ = 0;
+        completed_.insert(completed_.end(), std::make_move_iterator(results.begin()), std::make_move_iterator(results.end()));
+        condition_.notify_all();    // 唤醒可能在 flush() 中等待的线程
+    }
+}
+
+bool AsyncFileWriter::writeAtomic(const std::string& path, std::string_view data) {
+    const std::filesystem::path file_path(path);
+    std::error_code ec;
+    if (file_path.has_parent_path()) {
+        std::filesystem::create_directories(file_path.parent_path(), ec);
+        if (ec) {
+            spdlog::error("无法创建目录 {}: {}", file_path.parent_path().string(), ec.message());
+            return false;
+        }
+    }
+
+    // 1. 写入同目录下的临时文件（保证重命名不跨文件系统）
+    auto temp_path = file_path;
+    temp_path += ".tmp";
+    std::FILE* file = nullptr;
+#ifdef _WIN32
+    if (_wfopen_s(&file, temp_path.c_str(), L"wb") != 0) file = nullptr;
+#else
+    file = std::fopen(temp_path.c_str(), "wb");
+#endif
+    if (!file) {
+        spdlog::error("无法创建临时文件: {}", temp_path.string());
+        return false;
+    }
+    bool ok = std::fwrite(data.data(), 1, data.size(), file) == data.size();
+
+    // 2. 刷盘，保证重命名之前数据已经落到磁盘上
+    ok = ok && std::fflush(file) == 0;
+#ifdef _WIN32
+    ok = ok && _commit(_fileno(file)) == 0;
+#else
+    ok = ok && ::fsync(fileno(file)) == 0;
+#endif
+    ok = (std::fclose(file) == 0) && ok;
+    if (!ok) {
+        spdlog::error("写入临时文件失败: {}", temp_path.string());
+        std::filesystem::remove(temp_path, ec);
+        return false;
+    }
+
+    // 3. 重命名覆盖目标文件（同一文件系统内为原子操作）
+    std::filesystem::rename(temp_path, file_path, ec);
+    if (ec) {
+        spdlog::error("无法替换文件 {}: {}", path, ec.message());
+        std::filesystem::remove(temp_path, ec);
+        return false;
+    }
+    spdlog::info("文件已写入: {}（{} 字节）", path, data.size());
+    return true;
+}
+
+} // namespace engine::core
@@ -0,0 +1,72 @@
+#pragma once
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include <entt/signal/fwd.hpp>
+
+namespace engine::core {
+
+/**
+ * @brief 后台文件写入器：主线程只负责把数据序列化到缓冲区，写盘由工作线程完成。
+ *
+ * - 原子写入：先写临时文件并刷盘（fsync），再重命名覆盖目标文件，崩溃或断电时不会留下写了一半的存档；
+ * - 合并写入：同一路径尚未写出的旧数据会被新数据直接替换，连续多次保存只写最后一次；
+ * - 完成通知：写入结果由主线程调用 dispatchCompleted() 以 FileWrittenEvent 的形式加入事件分发器队列。
+ */
+class AsyncFileWriter final {
+private:
+    struct PendingWrite {
+        std::string path_;
+        std::string data_;
+    };
+    struct Result {
+        std::string path_;
+        bool success_{false};
+    };
+
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::vector<PendingWrite> pending_;     ///< @brief 等待写入的数据（每个路径最多一项）
+    std::vector<Result> completed_;         ///< @brief 已完成、尚未通知主线程的写入
+    size_t in_flight_{0};                   ///< @brief 工作线程正在写入的数量
+    bool stop_{false};
+    std::thread worker_;                    ///< @brief 声明在最后，保证其它成员先于线程初始化
+
+public:
+    AsyncFileWriter();
+    ~AsyncFileWriter();     ///< @brief 写完所有待写数据后结束工作线程
+
+    AsyncFileWriter(const AsyncFileWriter&) = delete;
+    AsyncFileWriter& operator=(const AsyncFileWriter&) = delete;
+    AsyncFileWriter(AsyncFileWriter&&) = delete;
+    AsyncFileWriter& operator=(AsyncFileWriter&&) = delete;
+
+    /**
+     * @brief 提交一次写入（立即返回）
+     * @param path 目标文件路径（父目录不存在时会创建）
+     * @param data 文件内容
+     */
+    void write(std::string_view path, std::string data);
+
+    /// @brief 阻塞等待所有已提交的写入完成
+    void flush();
+
+    /// @brief 把已完成的写入结果以 FileWrittenEvent 加入分发器队列（主线程每帧调用）
+    void dispatchCompleted(entt::dispatcher& dispatcher);
+
+    /**
+     * @brief 同步原子写入：写临时文件、刷盘后重命名覆盖目标文件
+     * @param path 目标文件路径（父目录不存在时会创建）
+     * @param data 文件内容
+     * @return 是否成功（失败时目标文件保持原样）
+     */
+    static bool writeAtomic(const std::string& path, std::string_view data);
+
+private:
+    void workerLoop();
+};
+
+} // namespace engine::core
@@ -67,6 +67,7 @@ void Config::fromJson(const nlohmann::json& j) {
     if (j.contains("graphics")) {
         const auto& graphics_config = j["graphics"];
         vsync_enabled_ = graphics_config.value("vsync", vsync_enabled_);
+        texture_budget_mb_ = graphics_config.value("texture_budget_mb", texture_budget_mb_);
     }
     if (j.contains("performance")) {
         const auto& perf_config = j["performance"];
@@ -75,11 +76,14 @@ void Config::fromJson(const nlohmann::json& j) {
             spdlog::warn("目标 FPS 不能为负数。设置为 0（无限制）。");
             target_fps_ = 0;
         }
+        frame_pacing_ = perf_config.value("frame_pacing", frame_pacing_);
     }
     if (j.contains("audio")) {
         const auto& audio_config = j["audio"];
         music_volume_ = audio_config.value("music_volume", music_volume_);
         sound_volume_ = audio_config.value("sound_volume", sound_volume_);
+        sound_voices_ = audio_config.value("sound_voices", sound_voices_);
+        max_sound_instances_ = audio_config.value("max_sound_instances", max_sound_instances_);
     }
 
     // 从 JSON 加载 input_mappings
@@ -110,14 +114,18 @@ nlohmann::ordered_json Config::toJson() const {
             {"resizable", window_resizable_}
         }},
         {"graphics", {
-            {"vsync", vsync_enabled_}
+            {"vsync", vsync_enabled_},
+            {"texture_budget_mb", texture_budget_mb_}
         }},
         {"performance", {
-            {"target_fps", target_fps_}
+            {"target_fps", target_fps_},
+            {"frame_pacing", frame_pacing_}
         }},
         {"audio", {
             {"music_volume", music_volume_},
-            {"sound_volume", sound_volume_}
+            {"sound_volume", sound_volume_},
+            {"sound_voices", sound_voices_},
+            {"max_sound_instances", max_sound_instances_}
         }},
         {"input_mappings", input_mappings_}
     };
@@ -26,13 +26,17 @@ public:
 
     // 图形设置
     bool vsync_enabled_ = true;             ///< @brief 是否启用垂直同步
+    int texture_budget_mb_ = 256;           ///< @brief 纹理显存预算（MB），超出时逐出未使用的纹理，0 表示不限制
 
     // 性能设置
     int target_fps_ = 144;                  ///< @brief 目标 FPS 设置，0 表示不限制
+    std::string frame_pacing_ = "adaptive"; ///< @brief 帧率限制的等待方式（sleep / precise / adaptive）
 
     // 音频设置
     float music_volume_ = 0.5f;
     float sound_volume_ = 0.5f;
+    int sound_voices_ = 32;                 ///< @brief 音效声部（轨道）数量
+    int max_sound_instances_ = 4;           ///< @brief 同一音效默认同时播放的实例上限
 
     // 存储动作名称到 SDL Scancode 名称列表的映射
     std::unordered_map<std::string, std::vector<std::string>> input_mappings_ = {
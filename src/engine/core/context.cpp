@@ -1,6 +1,8 @@
 #include "context.h"
 #include "time.h"
 #include "game_state.h"
+#include "frame_arena.h"
+#include "async_file_writer.h"
 #include "engine/input/input_manager.h"
 #include "engine/render/renderer.h"
 #include "engine/render/camera.h"
@@ -20,7 +22,9 @@ Context::Context(entt::dispatcher& dispatcher,
                  engine::resource::ResourceManager& resource_manager,
                  engine::audio::AudioPlayer& audio_player,
                  engine::core::GameState& game_state,
-                 engine::core::Time& time)     
+                 engine::core::Time& time,
+                 engine::core::FrameArena& frame_arena,
+                 engine::core::AsyncFileWriter& file_writer)
     : dispatcher_(dispatcher),
       input_manager_(input_manager),
       renderer_(renderer),
@@ -29,7 +33,9 @@ Context::Context(entt::dispatcher& dispatcher,
       resource_manager_(resource_manager),
       audio_player_(audio_player),
       game_state_(game_state),
-      time_(time)
+      time_(time),
+      frame_arena_(frame_arena),
+      file_writer_(file_writer)
 {
     spdlog::trace("上下文已创建并初始化。");
 }
@@ -22,6 +22,8 @@ namespace engine::audio {
 namespace engine::core {
     class GameState;
     class Time;
+    class FrameArena;
+    class AsyncFileWriter;
 
 /**
  * @brief 持有对核心引擎模块引用的上下文对象。
@@ -40,6 +42,8 @@ private:
     engine::audio::AudioPlayer& audio_player_;              ///< @brief 音频播放器
     engine::core::GameState& game_state_;                   ///< @brief 游戏状态
     engine::core::Time& time_;                              ///< @brief 时间
+    engine::core::FrameArena& frame_arena_;                 ///< @brief 帧内临时内存
+    engine::core::AsyncFileWriter& file_writer_;            ///< @brief 后台文件写入器
 public:
     /**
      * @brief 构造函数。
@@ -52,6 +56,8 @@ public:
      * @param audio_player 对 AudioPlayer 实例的引用。
      * @param game_state 对 GameState 实例的引用。
      * @param time 对 Time 实例的引用。
+     * @param frame_arena 对 FrameArena 实例的引用。
+     * @param file_writer 对 AsyncFileWriter 实例的引用。
      */
     Context(entt::dispatcher& dispatcher,
             engine::input::InputManager& input_manager,
@@ -61,7 +67,9 @@ public:
             engine::resource::ResourceManager& resource_manager,
             engine::audio::AudioPlayer& audio_player,
             engine::core::GameState& game_state,
-            engine::core::Time& time);
+            engine::core::Time& time,
+            engine::core::FrameArena& frame_arena,
+            engine::core::AsyncFileWriter& file_writer);
 
     // 禁止拷贝和移动，Context 对象通常是唯一的或按需创建/传递
     Context(const Context&) = delete;
@@ -79,6 +87,8 @@ public:
     engine::audio::AudioPlayer& getAudioPlayer() const { return audio_player_; }                 ///< @brief 获取音频播放器
     engine::core::GameState& getGameState() const { return game_state_; }                         ///< @brief 获取游戏状态
     engine::core::Time& getTime() const { return time_; }                                         ///< @brief 获取时间
+    engine::core::FrameArena& getFrameArena() const { return frame_arena_; }                      ///< @brief 获取帧内临时内存
+    engine::core::AsyncFileWriter& getFileWriter() const { return file_writer_; }                 ///< @brief 获取后台文件写入器
 };
 
 } // namespace engine::core
\ No newline at end of file
@@ -0,0 +1,46 @@
+#include "frame_arena.h"
+#include <algorithm>
+#include <cstdint>
+#include <spdlog/spdlog.h>
+
+namespace engine::core {
+
+FrameArena::FrameArena(size_t capacity)
+    : buffer_(std::make_unique<std::byte[]>(capacity)),
+      capacity_(capacity),
+      overflow_(std::pmr::new_delete_resource()) {
+    spdlog::trace("FrameArena 初始化成功，预留 {} 字节。", capacity_);
+}
+
+void FrameArena::reset() {
+    last_frame_used_ = getUsed();
+    high_water_mark_ = std::max(high_water_mark_, last_frame_used_);
+
+    if (overflow_bytes_ > 0) {
+        // 本帧预留空间不足：此时所有帧内对象都已失效，可以安全地扩容 (多留一半余量，避免反复扩容)
+        ++overflow_frames_;
+        const size_t new_capacity = high_water_mark_ + high_water_mark_ / 2;
+        spdlog::warn("FrameArena 溢出 {} 字节，预留空间由 {} 扩大到 {} 字节", overflow_bytes_, capacity_, new_capacity);
+        overflow_.release();
+        buffer_ = std::make_unique<std::byte[]>(new_capacity);
+        capacity_ = new_capacity;
+        overflow_bytes_ = 0;
+    }
+    offset_ = 0;
+}
+
+void* FrameArena::do_allocate(size_t bytes, size_t alignment) {
+    // 对齐当前偏移量
+    const auto base = reinterpret_cast<std::uintptr_t>(buffer_.get());
+    const auto aligned = (base + offset_ + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+    const size_t new_offset = aligned - base + bytes;
+    if (new_offset <= capacity_) {
+        offset_ = new_offset;
+        return reinterpret_cast<void*>(aligned);
+    }
+    // 预留空间不足，退回到后备分配器
+    overflow_bytes_ += bytes;
+    return overflow_.allocate(bytes, alignment);
+}
+
+} // namespace engine::core
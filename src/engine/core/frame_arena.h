@@ -0,0 +1,65 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+namespace engine::core {
+
+/**
+ * @brief 帧内线性分配器（bump allocator），供每帧临时容器使用。
+ *
+ * 实现 std::pmr::memory_resource，可直接用于 std::pmr::vector 等容器：
+ * 分配只是移动偏移量，释放为空操作，GameApp 在每帧结束时调用 reset() 一次性回收。
+ * 预留空间不足时退回到堆上分配（本帧内依然有效），并在 reset() 时按最高使用量扩容，
+ * 因此稳定运行后不会再产生任何堆分配。
+ *
+ * 只适合在一帧内创建、用完即弃的局部容器（如 ChunkStreamSystem 每帧的请求列表和待实例化区块）。
+ * 跨帧复用容量的成员容器（UIManager 的绘制/更新/命中列表、VoiceManager 的本帧音效列表、
+ * Renderer 的纹理颜色记录等）稳定后本身已不再分配，且内容要保留到下一帧或回收之后，不应放在这里。
+ *
+ * @note 从帧内存分配的对象不能跨帧保存，且只能在主线程中使用。
+ */
+class FrameArena final : public std::pmr::memory_resource {
+private:
+    std::unique_ptr<std::byte[]> buffer_;               ///< @brief 预留的内存块
+    size_t capacity_{0};                                ///< @brief 预留内存块大小（字节）
+    size_t offset_{0};                                  ///< @brief 当前帧已使用的字节数（不含溢出）
+    size_t overflow_bytes_{0};                          ///< @brief 当前帧溢出到堆上的字节数
+    std::pmr::monotonic_buffer_resource overflow_;      ///< @brief 溢出时的后备分配器（reset 时释放）
+
+    size_t last_frame_used_{0};                         ///< @brief 上一帧的使用量（含溢出）
+    size_t high_water_mark_{0};                         ///< @brief 历史单帧最高使用量（含溢出）
+    size_t overflow_frames_{0};                         ///< @brief 发生过溢出的帧数
+
+public:
+    static constexpr size_t DEFAULT_CAPACITY{256 * 1024};   ///< @brief 默认预留大小（字节）
+
+    /**
+     * @brief 构造函数
+     * @param capacity 预留内存块大小（字节）
+     */
+    explicit FrameArena(size_t capacity = DEFAULT_CAPACITY);
+
+    // 禁止拷贝和移动（容器中保存的是指向本对象的指针）
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+    FrameArena(FrameArena&&) = delete;
+    FrameArena& operator=(FrameArena&&) = delete;
+
+    /// @brief 帧结束时调用：回收本帧所有分配，必要时扩容
+    void reset();
+
+    // --- getters ---
+    size_t getUsed() const { return offset_ + overflow_bytes_; }      ///< @brief 当前帧已使用的字节数
+    size_t getCapacity() const { return capacity_; }
+    size_t getLastFrameUsed() const { return last_frame_used_; }
+    size_t getHighWaterMark() const { return high_water_mark_; }
+    size_t getOverflowFrames() const { return overflow_frames_; }
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void*, size_t, size_t) override {}              ///< @brief 单个释放为空操作，帧结束统一回收
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+} // namespace engine::core
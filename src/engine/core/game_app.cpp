@@ -1,5 +1,7 @@
 #include "game_app.h"
 #include "time.h"
+#include "frame_arena.h"
+#include "async_file_writer.h"
 #include "context.h"
 #include "config.h"
 #include "game_state.h"
@@ -11,7 +13,9 @@
 #include "engine/input/input_manager.h"
 #include "engine/scene/scene_manager.h"
 #include "engine/utils/events.h"
+#include "engine/debug/alloc_tracker.h"
 #include <SDL3/SDL.h>
+#include <algorithm>
 #include <spdlog/spdlog.h>
 #include <entt/signal/dispatcher.hpp>
 #include <imgui.h>
@@ -36,15 +40,28 @@ void GameApp::run() {
     }
 
     while (is_running_) {
+        engine::debug::AllocTracker::beginFrame();     // 结算上一帧的分配统计（未开启追踪时为空操作）
         time_->update();
+        audio_player_->beginFrame();                   // 刷新音效声部状态（结算上一帧的声部统计）
         float delta_time = time_->getDeltaTime();
         
         handleEvents();
         update(delta_time);
-        render();
+        if (!is_headless_) render();
+
+        // 后台写入的完成通知加入事件队列，随本帧其它事件一起分发
+        file_writer_->dispatchCompleted(*dispatcher_);
 
         // 分发事件（让新创建的实体先更新再渲染）
-        dispatcher_->update();
+        {
+            ENGINE_ALLOC_SCOPE("Dispatcher");
+            dispatcher_->update();
+        }
+
+        // 回收本帧的临时内存（必须在本帧所有逻辑之后）
+        frame_arena_->reset();
+        // 超出预算时逐出未使用的纹理（必须在本帧呈现之后）
+        resource_manager_->collectGarbage();
 
         // spdlog::info("delta_time: {}", delta_time);
     }
@@ -69,6 +86,8 @@ bool GameApp::init() {
     if (!initSDL())  return false;
     if (!initGameState()) return false;
     if (!initTime()) return false;
+    if (!initFrameArena()) return false;
+    if (!initFileWriter()) return false;
     if (!initResourceManager()) return false;
     if (!initAudioPlayer()) return false;
     if (!initRenderer()) return false;
@@ -93,23 +112,30 @@ bool GameApp::init() {
 
 void GameApp::handleEvents() {
     // 处理并分发输入事件
+    ENGINE_ALLOC_SCOPE("Input");
     input_manager_->update();
 }
 
 void GameApp::update(float delta_time) {
     // 游戏逻辑更新
+    ENGINE_ALLOC_SCOPE("SceneUpdate");
     scene_manager_->update(delta_time);
 }
 
 void GameApp::render() {
-    // 1. 清除屏幕
+    ENGINE_ALLOC_SCOPE("SceneRender");
+    // 1. 渲染前重新采样鼠标位置（延迟锁存），跟随鼠标的绘制按最新位置修正
+    renderer_->setCursorOffset(input_manager_->latchMousePosition());
+
+    // 2. 清除屏幕
     renderer_->clearScreen();
 
-    // 2. 具体渲染代码
+    // 3. 具体渲染代码
     scene_manager_->render();
 
-    // 3. 更新屏幕显示
+    // 4. 更新屏幕显示，然后结算输入延迟
     renderer_->present();
+    input_manager_->onFramePresented();
 }
 
 void GameApp::close() {
@@ -127,6 +153,9 @@ void GameApp::close() {
     scene_manager_->close();
 
     // 为了确保正确的销毁顺序，有些智能指针对象也需要手动管理
+    file_writer_.reset();       // 等待尚未写完的存档写入完成
+    text_renderer_->clearCache();   // 缓存的文本对象引用字体，需在字体卸载前销毁
+    audio_player_.reset();          // 音频轨道属于混音器，需在混音器销毁前销毁
     resource_manager_.reset();
 
     if (sdl_renderer_ != nullptr) {
@@ -175,7 +204,8 @@ bool GameApp::initSDL()
     // 设置窗口大小 (窗口大小 * 窗口缩放比例)
     int window_width = static_cast<int>(static_cast<float>(config_->window_width_) * config_->window_scale_);
     int window_height = static_cast<int>(static_cast<float>(config_->window_height_) * config_->window_scale_);
-    window_ = SDL_CreateWindow(config_->window_title_.c_str(), window_width, window_height, SDL_WINDOW_RESIZABLE);
+    SDL_WindowFlags window_flags = is_headless_ ? SDL_WINDOW_HIDDEN : SDL_WINDOW_RESIZABLE;
+    window_ = SDL_CreateWindow(config_->window_title_.c_str(), window_width, window_height, window_flags);
     if (window_ == nullptr) {
         spdlog::error("无法创建窗口! SDL错误: {}", SDL_GetError());
         return false;
@@ -191,9 +221,9 @@ bool GameApp::initSDL()
     SDL_SetRenderDrawBlendMode(sdl_renderer_, SDL_BLENDMODE_BLEND);
 
     // 设置 VSync (注意: VSync 开启时，驱动程序会尝试将帧率限制到显示器刷新率，有可能会覆盖我们手动设置的 target_fps)
-    int vsync_mode = config_->vsync_enabled_ ? SDL_RENDERER_VSYNC_ADAPTIVE : SDL_RENDERER_VSYNC_DISABLED;
+    int vsync_mode = config_->vsync_enabled_ && !is_headless_ ? SDL_RENDERER_VSYNC_ADAPTIVE : SDL_RENDERER_VSYNC_DISABLED;
     SDL_SetRenderVSync(sdl_renderer_, vsync_mode);
-    spdlog::trace("VSync 设置为: {}", config_->vsync_enabled_ ? "Enabled" : "Disabled");
+    spdlog::trace("VSync 设置为: {}", vsync_mode != SDL_RENDERER_VSYNC_DISABLED ? "Enabled" : "Disabled");
 
     // 设置逻辑分辨率 (窗口大小 * 逻辑缩放比例)
     int logical_width = static_cast<int>(static_cast<float>(config_->window_width_) * config_->window_logical_scale_);
@@ -227,11 +257,38 @@ bool GameApp::initTime() {
         spdlog::error("初始化时间管理失败: {}", e.what());
         return false;
     }
-    time_->setTargetFps(config_->target_fps_);
+    time_->setTargetFps(is_headless_ ? 0 : config_->target_fps_);     // 无界面模式不限制帧率
+    if (auto pacing = engine::core::parseFramePacing(config_->frame_pacing_); pacing) {
+        time_->setFramePacing(*pacing);
+    } else {
+        spdlog::warn("未知的帧率限制方式 '{}'，使用默认值 '{}'。", config_->frame_pacing_, engine::core::toString(time_->getFramePacing()));
+    }
     spdlog::trace("时间管理初始化成功。");
     return true;
 }
 
+bool GameApp::initFrameArena() {
+    try {
+        frame_arena_ = std::make_unique<FrameArena>();
+    } catch (const std::exception& e) {
+        spdlog::error("初始化帧内存失败: {}", e.what());
+        return false;
+    }
+    spdlog::trace("帧内存初始化成功。");
+    return true;
+}
+
+bool GameApp::initFileWriter() {
+    try {
+        file_writer_ = std::make_unique<AsyncFileWriter>();
+    } catch (const std::exception& e) {
+        spdlog::error("初始化后台文件写入器失败: {}", e.what());
+        return false;
+    }
+    spdlog::trace("后台文件写入器初始化成功。");
+    return true;
+}
+
 bool GameApp::initResourceManager() {
     try {
         resource_manager_ = std::make_unique<engine::resource::ResourceManager>(sdl_renderer_);
@@ -240,6 +297,8 @@ bool GameApp::initResourceManager() {
         return false;
     }
     spdlog::trace("资源管理器初始化成功。");
+    resource_manager_->setTextureBudget(static_cast<size_t>(std::max(config_->texture_budget_mb_, 0)) * 1024 * 1024);
+    resource_manager_->mountArchive("assets.pak");       // 存在打包好的资源包时优先使用
     resource_manager_->loadResources("assets/data/resource_mapping.json");  // 载入默认资源映射文件
     return true;
 }
@@ -247,9 +306,11 @@ bool GameApp::initResourceManager() {
 bool GameApp::initAudioPlayer()
 {
     try {
-        audio_player_ = std::make_unique<engine::audio::AudioPlayer>(resource_manager_.get());
-        audio_player_->setMusicVolume(config_->music_volume_);      // 设置背景音乐音量
-        audio_player_->setSoundVolume(config_->sound_volume_);      // 设置音效音量
+        audio_player_ = std::make_unique<engine::audio::AudioPlayer>(resource_manager_.get(),
+                                                                     config_->sound_voices_,
+                                                                     config_->max_sound_instances_);
+        audio_player_->setMusicVolume(is_headless_ ? 0.0f : config_->music_volume_);      // 设置背景音乐音量（无界面模式静音）
+        audio_player_->setSoundVolume(is_headless_ ? 0.0f : config_->sound_volume_);      // 设置音效音量
     } catch (const std::exception& e) {
         spdlog::error("初始化音频播放器失败: {}", e.what());
         return false;
@@ -283,7 +344,8 @@ bool GameApp::initCamera() {
 bool GameApp::initTextRenderer()
 {
     try {
-        text_renderer_ = std::make_unique<engine::render::TextRenderer>(sdl_renderer_, resource_manager_.get());
+        text_renderer_ = std::make_unique<engine::render::TextRenderer>(renderer_.get(), resource_manager_.get());
+        text_renderer_->prewarmFonts("assets/fonts", {16});     // UI文字的默认字号；其它字号在首次使用时预热
     } catch (const std::exception& e) {
         spdlog::error("初始化文字渲染引擎失败: {}", e.what());
         return false;
@@ -315,7 +377,9 @@ bool GameApp::initContext()
                                                            *resource_manager_, 
                                                            *audio_player_,
                                                            *game_state_,
-                                                           *time_);
+                                                           *time_,
+                                                           *frame_arena_,
+                                                           *file_writer_);
     } catch (const std::exception& e) {
         spdlog::error("初始化上下文失败: {}", e.what());
         return false;
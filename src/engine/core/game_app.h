@@ -31,6 +31,8 @@ class AudioPlayer;
 
 namespace engine::core {        // 命名空间的最佳实践：与文件路径一致
 class Time;
+class FrameArena;
+class AsyncFileWriter;
 class Config;
 class Context;
 class GameState;
@@ -43,6 +45,7 @@ private:
     SDL_Window* window_ = nullptr;
     SDL_Renderer* sdl_renderer_ = nullptr;
     bool is_running_ = false;
+    bool is_headless_ = false;      ///< @brief 无界面模式：隐藏窗口、不渲染、不限帧率、静音（用于录像回放）
 
     /// @brief 游戏场景设置函数，用于在运行游戏前设置初始场景 (GameApp不再决定初始场景是什么)
     std::function<void(engine::core::Context&)> scene_setup_func_;
@@ -50,6 +53,8 @@ private:
     // 引擎组件
     std::unique_ptr<entt::dispatcher> dispatcher_;  // 事件分发器
     std::unique_ptr<engine::core::Time> time_;
+    std::unique_ptr<engine::core::FrameArena> frame_arena_;
+    std::unique_ptr<engine::core::AsyncFileWriter> file_writer_;     // 后台文件写入（存档等）
     std::unique_ptr<engine::resource::ResourceManager> resource_manager_;
     std::unique_ptr<engine::render::Renderer> renderer_;
     std::unique_ptr<engine::render::Camera> camera_;
@@ -77,6 +82,12 @@ public:
      */
     void registerSceneSetup(std::function<void(engine::core::Context&)> func);
 
+    /**
+     * @brief 设置无界面模式（需在 run() 之前调用）。
+     *        窗口隐藏、跳过渲染、关闭垂直同步和帧率限制、静音，游戏逻辑以最快速度运行（用于录像回放）。
+     */
+    void setHeadless(bool headless) { is_headless_ = headless; }
+
     // 禁止拷贝和移动
     GameApp(const GameApp&) = delete;
     GameApp& operator=(const GameApp&) = delete;
@@ -96,6 +107,8 @@ private:
     [[nodiscard]] bool initSDL();
     [[nodiscard]] bool initGameState();
     [[nodiscard]] bool initTime();
+    [[nodiscard]] bool initFrameArena();
+    [[nodiscard]] bool initFileWriter();
     [[nodiscard]] bool initResourceManager();
     [[nodiscard]] bool initAudioPlayer();
     [[nodiscard]] bool initRenderer();
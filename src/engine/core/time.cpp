@@ -1,39 +1,127 @@
 #include "time.h"
 #include <spdlog/spdlog.h>
 #include <SDL3/SDL_timer.h>    // 用于 SDL_GetTicksNS()
+#include <algorithm>
+#include <cmath>
+#include <thread>
 
 namespace engine::core {
 
+std::string_view toString(FramePacing pacing) {
+    switch (pacing) {
+        case FramePacing::SLEEP: return "sleep";
+        case FramePacing::PRECISE: return "precise";
+        case FramePacing::ADAPTIVE: return "adaptive";
+    }
+    return "unknown";
+}
+
+std::optional<FramePacing> parseFramePacing(std::string_view name) {
+    for (auto pacing : {FramePacing::SLEEP, FramePacing::PRECISE, FramePacing::ADAPTIVE}) {
+        if (name == toString(pacing)) return pacing;
+    }
+    return std::nullopt;
+}
+
 Time::Time() {
-    // 初始化 last_time_ 和 frame_start_time_ 为当前时间，避免第一帧 DeltaTime 过大
-    last_time_ = SDL_GetTicksNS();
-    frame_start_time_ = last_time_;
-    spdlog::trace("Time 初始化。Last time: {}", last_time_);
+    // 初始化为当前时间，避免第一帧 DeltaTime 过大
+    frame_begin_time_ = SDL_GetTicksNS();
+    spdlog::trace("Time 初始化。Frame begin time: {}", frame_begin_time_);
 }
 
 void Time::update() {
-    
-    frame_start_time_ = SDL_GetTicksNS();   // 记录进入 update 时的时间戳
-    auto current_delta_time = static_cast<double>(frame_start_time_ - last_time_) / 1000000000.0;
-    if (target_frame_time_ > 0.0){      // 如果设置了目标帧率，则限制帧率；否则delta_time_ = current_delta_time
-        limitFrameRate(current_delta_time);
-    } else {
-        delta_time_ = current_delta_time;
+    // 截止时间以上一帧开始的时刻为基准，等待误差不会累积到之后的帧
+    const Uint64 deadline = frame_begin_time_ + target_frame_ns_;
+    if (target_frame_ns_ > 0 && SDL_GetTicksNS() < deadline) {
+        limitFrameRate(deadline);
+    }
+
+    const Uint64 now = SDL_GetTicksNS();
+    delta_time_ = static_cast<double>(now - frame_begin_time_) / 1000000000.0;
+    frame_begin_time_ = now;
+    recordFrame(delta_time_ * 1000.0, target_frame_ns_ > 0 && now > deadline + DEADLINE_TOLERANCE_NS);
+}
+
+void Time::limitFrameRate(Uint64 deadline) {
+    switch (pacing_) {
+        case FramePacing::SLEEP:
+            SDL_DelayNS(deadline - SDL_GetTicksNS());
+            break;
+        case FramePacing::PRECISE:
+            // 粗略睡眠到截止时间前 PRECISE_SPIN_NS，剩余时间自旋（系统睡眠精度通常在1~2毫秒）
+            if (const Uint64 now = SDL_GetTicksNS(); now + PRECISE_SPIN_NS < deadline) {
+                SDL_DelayNS(deadline - PRECISE_SPIN_NS - now);
+            }
+            spinUntil(deadline);
+            break;
+        case FramePacing::ADAPTIVE:
+            sleepAdaptive(deadline);
+            spinUntil(deadline);
+            break;
+    }
+}
+
+void Time::spinUntil(Uint64 deadline) const {
+    for (Uint64 now = SDL_GetTicksNS(); now < deadline; now = SDL_GetTicksNS()) {
+        if (deadline - now > YIELD_THRESHOLD_NS) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void Time::sleepAdaptive(Uint64 deadline) {
+    // 估计一次睡眠的最长耗时（均值 + 标准差），剩余时间多于估计值才继续睡眠
+    constexpr double ALPHA = 0.05;
+    for (Uint64 now = SDL_GetTicksNS(); now < deadline; ) {
+        const double estimate = sleep_mean_ns_ + std::sqrt(sleep_variance_ns2_);
+        if (static_cast<double>(deadline - now) <= estimate) break;
+
+        SDL_DelayNS(ADAPTIVE_SLEEP_NS);
+        const Uint64 after = SDL_GetTicksNS();
+        const double observed = static_cast<double>(after - now);
+        const double diff = observed - sleep_mean_ns_;
+        sleep_mean_ns_ += ALPHA * diff;
+        sleep_variance_ns2_ = (1.0 - ALPHA) * (sleep_variance_ns2_ + ALPHA * diff * diff);
+        now = after;
     }
+}
 
-    last_time_ = SDL_GetTicksNS(); // 记录离开 update 时的时间戳
+void Time::recordFrame(double frame_ms, bool missed) {
+    frame_times_ms_[history_offset_] = static_cast<float>(frame_ms);
+    history_offset_ = (history_offset_ + 1) % FRAME_HISTORY;
+    history_count_ = std::min(history_count_ + 1, FRAME_HISTORY);
+    if (missed) ++total_missed_;
 }
 
-void Time::limitFrameRate(float current_delta_time) {
-    // 如果当前帧耗费的时间小于目标帧时间，则等待剩余时间
-    if (current_delta_time < target_frame_time_) {
-        double time_to_wait = target_frame_time_ - current_delta_time;
-        Uint64 ns_to_wait = static_cast<Uint64>(time_to_wait * 1000000000.0);
-        SDL_DelayNS(ns_to_wait);
-        delta_time_ = static_cast<double>(SDL_GetTicksNS() - last_time_) / 1000000000.0;
-    } else {    // 否则，直接使用当前帧耗费的时间
-        delta_time_ = static_cast<double>(current_delta_time);
+FrameTimeStats Time::getFrameTimeStats() const {
+    FrameTimeStats stats;
+    stats.total_missed_deadlines_ = total_missed_;
+    stats.sleep_overshoot_ms_ = static_cast<float>(sleep_mean_ns_ / 1000000.0);
+    stats.samples_ = history_count_;
+    if (history_count_ == 0) return stats;
+
+    // 未写满时有效记录位于 [0, history_count_)，写满后为整个数组，两种情况都可以直接取前 history_count_ 个
+    const auto first = sort_buffer_.begin();
+    const auto last = first + static_cast<std::ptrdiff_t>(history_count_);
+    std::copy(frame_times_ms_.begin(), frame_times_ms_.begin() + static_cast<std::ptrdiff_t>(history_count_), first);
+
+    double sum = 0.0;
+    const float deadline_ms = static_cast<float>((target_frame_ns_ + DEADLINE_TOLERANCE_NS) / 1000000.0);
+    for (auto it = first; it != last; ++it) {
+        sum += *it;
+        stats.max_ms_ = std::max(stats.max_ms_, *it);
+        if (target_frame_ns_ > 0 && *it > deadline_ms) ++stats.missed_deadlines_;
     }
+    stats.average_ms_ = static_cast<float>(sum / history_count_);
+
+    auto percentile = [&](double p) {
+        const auto nth = first + static_cast<std::ptrdiff_t>(p * (history_count_ - 1));
+        std::nth_element(first, nth, last);
+        return *nth;
+    };
+    stats.p50_ms_ = percentile(0.50);
+    stats.p99_ms_ = percentile(0.99);
+    return stats;
 }
 
 float Time::getDeltaTime() const {
@@ -66,9 +154,11 @@ void Time::setTargetFps(int fps) {
 
     if (target_fps_ > 0) {
         target_frame_time_ = 1.0 / static_cast<double>(target_fps_);
+        target_frame_ns_ = static_cast<Uint64>(1000000000.0 / target_fps_);
         spdlog::info("Target FPS 设置为: {} (Frame time: {:.6f}s)", target_fps_, target_frame_time_);
     } else {
         target_frame_time_ = 0.0;
+        target_frame_ns_ = 0;
         spdlog::info("Target FPS 设置为: Unlimited");
     }
 }
@@ -77,4 +167,9 @@ int Time::getTargetFps() const {
     return target_fps_;
 }
 
-} // namespace engine::core 
\ No newline at end of file
+void Time::setFramePacing(FramePacing pacing) {
+    pacing_ = pacing;
+    spdlog::info("帧率限制方式设置为: {}", toString(pacing));
+}
+
+} // namespace engine::core
@@ -1,24 +1,76 @@
 #pragma once
 #include <SDL3/SDL_stdinc.h>    // 用于 Uint64
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
 
 namespace engine::core {
 
+/**
+ * @brief 帧率限制时等待到下一帧截止时间的方式
+ */
+enum class FramePacing : std::uint8_t {
+    SLEEP,      ///< @brief 只调用一次 SDL_DelayNS（受系统睡眠精度影响，可能睡过头）
+    PRECISE,    ///< @brief 先睡眠到截止时间前的固定余量，再让出/自旋到截止时间
+    ADAPTIVE,   ///< @brief 以1毫秒为单位睡眠，并学习睡眠的实际耗时，剩余时间不足一次睡眠时自旋
+};
+
+std::string_view toString(FramePacing pacing);
+std::optional<FramePacing> parseFramePacing(std::string_view name);    ///< @brief 从名称解析（无法识别时返回空）
+
+/**
+ * @brief 最近若干帧的帧时间统计
+ */
+struct FrameTimeStats {
+    size_t samples_{0};                 ///< @brief 统计的帧数
+    float average_ms_{0.0f};            ///< @brief 平均帧时间
+    float p50_ms_{0.0f};                ///< @brief 帧时间中位数
+    float p99_ms_{0.0f};                ///< @brief 99% 分位帧时间
+    float max_ms_{0.0f};                ///< @brief 最长帧时间
+    size_t missed_deadlines_{0};        ///< @brief 统计窗口内错过截止时间的帧数
+    size_t total_missed_deadlines_{0};  ///< @brief 累计错过截止时间的帧数
+    float sleep_overshoot_ms_{0.0f};    ///< @brief 自适应模式学到的1毫秒睡眠的实际耗时估计
+};
+
 /**
  * @brief 管理游戏循环中的时间，计算帧间时间差 (DeltaTime)。
  *
  * 使用 SDL 的高精度性能计数器来确保时间测量的准确性。
  * 提供获取缩放和未缩放 DeltaTime 的方法，以及设置时间缩放因子的能力。
+ * DeltaTime 是相邻两帧开始时刻（等待结束后）之差，即真实的帧周期。
  */
 class Time final{
+public:
+    static constexpr size_t FRAME_HISTORY{512};                 ///< @brief 帧时间历史记录的长度
+
 private:
-    Uint64 last_time_ = 0;         ///< @brief 上一帧的时间戳 (用于计算 delta)
-    Uint64 frame_start_time_ = 0;  ///< @brief 当前帧开始的时间戳 (用于帧率限制)
+    static constexpr Uint64 PRECISE_SPIN_NS{2'000'000};         ///< @brief 精确模式下截止时间前改为自旋的余量
+    static constexpr Uint64 YIELD_THRESHOLD_NS{200'000};        ///< @brief 剩余时间多于该值时自旋中让出线程
+    static constexpr Uint64 ADAPTIVE_SLEEP_NS{1'000'000};       ///< @brief 自适应模式每次睡眠请求的时长
+    static constexpr Uint64 DEADLINE_TOLERANCE_NS{500'000};     ///< @brief 晚于截止时间超过该值视为错过
+
+    Uint64 frame_begin_time_ = 0;  ///< @brief 当前帧开始（等待结束后）的时间戳
     double delta_time_ = 0.0;      ///< @brief 未缩放的帧间时间差 (秒)
     double time_scale_ = 1.0;      ///< @brief 时间缩放因子
 
     // 帧率限制相关
     int target_fps_ = 0;             ///< @brief 目标 FPS (0 表示不限制)
     double target_frame_time_ = 0.0; ///< @brief 目标每帧时间 (秒)
+    Uint64 target_frame_ns_ = 0;     ///< @brief 目标每帧时间 (纳秒)
+    FramePacing pacing_ = FramePacing::ADAPTIVE;    ///< @brief 等待方式
+
+    // 自适应模式学到的睡眠耗时（指数滑动平均，纳秒）
+    double sleep_mean_ns_ = static_cast<double>(ADAPTIVE_SLEEP_NS);
+    double sleep_variance_ns2_ = 0.0;
+
+    // 帧时间统计
+    std::array<float, FRAME_HISTORY> frame_times_ms_{};     ///< @brief 帧时间历史（毫秒，环形缓冲区）
+    mutable std::array<float, FRAME_HISTORY> sort_buffer_{}; ///< @brief 计算分位数用的临时缓冲区
+    size_t history_offset_ = 0;     ///< @brief 环形缓冲区中下一个写入位置（即最旧的记录）
+    size_t history_count_ = 0;      ///< @brief 已记录的帧数（不超过 FRAME_HISTORY）
+    size_t total_missed_ = 0;       ///< @brief 累计错过截止时间的帧数
 
 public:
     Time();
@@ -30,7 +82,7 @@ public:
     Time& operator=(Time&&) = delete;
 
     /**
-     * @brief 每帧开始时调用，更新内部时间状态并计算 DeltaTime。
+     * @brief 每帧开始时调用：等待到本帧的截止时间（如果限制了帧率），然后计算 DeltaTime 并记录帧时间。
      */
     void update();
 
@@ -77,13 +129,26 @@ public:
      */
     int getTargetFps() const;
 
+    void setFramePacing(FramePacing pacing);                    ///< @brief 设置帧率限制的等待方式
+    FramePacing getFramePacing() const { return pacing_; }      ///< @brief 获取帧率限制的等待方式
+
+    /**
+     * @brief 计算最近 FRAME_HISTORY 帧的帧时间统计（不分配内存）
+     */
+    FrameTimeStats getFrameTimeStats() const;
+    const std::array<float, FRAME_HISTORY>& getFrameTimeHistory() const { return frame_times_ms_; }    ///< @brief 帧时间历史（毫秒，环形缓冲区）
+    size_t getFrameTimeHistoryOffset() const { return history_offset_; }                                ///< @brief 环形缓冲区中最旧记录的位置
+
 private:
     /**
-     * @brief update 中调用，用于限制帧率。如果设置了 target_fps_ > 0，且当前帧执行时间小于目标帧时间，则会调用 SDL_DelayNS() 来等待剩余时间。
-     * 
-     * @param current_delta_time 当前帧的执行时间（秒）
+     * @brief update 中调用，用于限制帧率：按 pacing_ 指定的方式等待到 deadline。
+     *
+     * @param deadline 本帧的截止时间戳（纳秒）
      */
-    void limitFrameRate(float current_delta_time);
+    void limitFrameRate(Uint64 deadline);
+    void spinUntil(Uint64 deadline) const;      ///< @brief 自旋等待到截止时间（剩余时间较多时让出线程）
+    void sleepAdaptive(Uint64 deadline);        ///< @brief 自适应模式：睡眠并学习睡眠耗时，剩余时间不足一次睡眠时返回
+    void recordFrame(double frame_ms, bool missed);     ///< @brief 记录一帧的帧时间
 };
 
-} // namespace engine::core
\ No newline at end of file
+} // namespace engine::core
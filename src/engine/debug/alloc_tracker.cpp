@@ -0,0 +1,226 @@
+#include "alloc_tracker.h"
+#include <atomic>
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <spdlog/spdlog.h>
+#ifdef _WIN32
+#include <malloc.h>     // _aligned_malloc / _aligned_free
+#endif
+
+namespace engine::debug {
+
+namespace {
+
+// --- 计数器 (operator new 中使用，必须是平凡类型，不能分配内存) ---
+std::atomic<std::uint64_t> g_alloc_count{0};    ///< @brief 所有线程的分配次数
+std::atomic<std::uint64_t> g_alloc_bytes{0};    ///< @brief 所有线程的分配字节数
+thread_local AllocStats t_alloc_total{};        ///< @brief 当前线程的分配统计（用于作用域统计）
+
+// --- 帧与作用域统计 (只在主线程访问) ---
+const std::thread::id g_main_thread_id{std::this_thread::get_id()};    ///< @brief 静态初始化在主线程中进行
+AllocStats g_frame_start{};
+AllocStats g_last_frame{};
+std::uint64_t g_frame_index{0};
+std::array<float, AllocTracker::HISTORY_SIZE> g_history{};
+size_t g_history_offset{0};
+
+// --- 作用域登记表 ---
+// 登记（写入新槽位、增加数量）由互斥量保护；数量以 release 发布，读取方 acquire 后即可无锁访问已登记的名称
+std::array<ScopeAllocStats, AllocTracker::MAX_SCOPES> g_scopes{};
+std::atomic<size_t> g_scope_count{0};
+std::mutex g_scope_mutex;
+
+/// @brief 按名称查找作用域，不存在则登记（名称都是字面量，先比较指针，再比较内容）；登记表已满时返回nullptr
+ScopeAllocStats* findOrRegisterScope(const char* name, bool zero_alloc) {
+    auto find = [name](size_t count) -> ScopeAllocStats* {
+        for (size_t i = 0; i < count; ++i) {
+            if (g_scopes[i].name_ == name || std::strcmp(g_scopes[i].name_, name) == 0) {
+                return &g_scopes[i];
+            }
+        }
+        return nullptr;
+    };
+    if (auto* scope = find(g_scope_count.load(std::memory_order_acquire))) return scope;
+
+    std::lock_guard lock(g_scope_mutex);
+    const auto count = g_scope_count.load(std::memory_order_relaxed);
+    if (auto* scope = find(count)) return scope;       // 等待锁期间可能已被其它线程登记
+    if (count >= AllocTracker::MAX_SCOPES) return nullptr;
+    auto* scope = &g_scopes[count];
+    scope->name_ = name;
+    scope->zero_alloc_ = zero_alloc;
+    g_scope_count.store(count + 1, std::memory_order_release);
+    return scope;
+}
+
+constexpr std::uint64_t WARMUP_FRAMES{120};     ///< @brief 前若干帧容器仍在增长，不检查 ZERO_ALLOC
+
+AllocStats globalTotal() {
+    return AllocStats{g_alloc_count.load(std::memory_order_relaxed), g_alloc_bytes.load(std::memory_order_relaxed)};
+}
+
+} // namespace
+
+bool AllocTracker::isEnabled() {
+#ifdef ENGINE_ALLOC_TRACKING
+    return true;
+#else
+    return false;
+#endif
+}
+
+void AllocTracker::beginFrame() {
+    const auto total = globalTotal();
+    g_last_frame = AllocStats{total.count_ - g_frame_start.count_, total.bytes_ - g_frame_start.bytes_};
+    g_frame_start = total;
+    ++g_frame_index;
+
+    g_history[g_history_offset] = static_cast<float>(g_last_frame.count_);
+    g_history_offset = (g_history_offset + 1) % HISTORY_SIZE;
+
+    const auto scope_count = g_scope_count.load(std::memory_order_acquire);
+    for (size_t i = 0; i < scope_count; ++i) {
+        g_scopes[i].last_frame_ = g_scopes[i].frame_;
+        g_scopes[i].frame_ = AllocStats{};
+    }
+}
+
+AllocStats AllocTracker::getLastFrame() {
+    return g_last_frame;
+}
+
+AllocStats AllocTracker::getThreadTotal() {
+    return t_alloc_total;
+}
+
+const std::array<float, AllocTracker::HISTORY_SIZE>& AllocTracker::getHistory() {
+    return g_history;
+}
+
+size_t AllocTracker::getHistoryOffset() {
+    return g_history_offset;
+}
+
+const std::array<ScopeAllocStats, AllocTracker::MAX_SCOPES>& AllocTracker::getScopes() {
+    return g_scopes;
+}
+
+size_t AllocTracker::getScopeCount() {
+    return g_scope_count.load(std::memory_order_acquire);
+}
+
+void AllocTracker::report(const char* name, const AllocStats& stats, bool zero_alloc) {
+    // 工作线程（如平衡性模拟）中运行的系统也会经过作用域，每帧的累计值只在主线程中维护
+    if (std::this_thread::get_id() != g_main_thread_id) return;
+    auto* scope = findOrRegisterScope(name, zero_alloc);
+    if (!scope) return;
+    scope->frame_.count_ += stats.count_;
+    scope->frame_.bytes_ += stats.bytes_;
+
+    if (!zero_alloc || stats.count_ == 0 || g_frame_index < WARMUP_FRAMES) return;
+    // 违规按帧计数：同一帧内多次进入作用域只计一次（检查从 WARMUP_FRAMES 之后开始，帧序号不会是初始值0）
+    if (scope->last_violation_frame_ != g_frame_index) {
+        scope->last_violation_frame_ = g_frame_index;
+        // 只在第一次违规时输出日志，避免日志本身持续分配
+        if (scope->violations_++ == 0) {
+            spdlog::error("ZERO_ALLOC 作用域 '{}' 发生了 {} 次分配，共 {} 字节", name, stats.count_, stats.bytes_);
+        }
+    }
+#ifdef ENGINE_ZERO_ALLOC_ASSERT
+    assert(false && "ZERO_ALLOC 作用域发生了堆分配");
+#endif
+}
+
+AllocScope::AllocScope(const char* name, bool zero_alloc)
+    : name_(name), start_(t_alloc_total), zero_alloc_(zero_alloc) {
+}
+
+AllocScope::~AllocScope() {
+    const auto end = t_alloc_total;
+    AllocTracker::report(name_, AllocStats{end.count_ - start_.count_, end.bytes_ - start_.bytes_}, zero_alloc_);
+}
+
+} // namespace engine::debug
+
+#ifdef ENGINE_ALLOC_TRACKING
+// ----------------------------- 全局 operator new / delete 替换 -----------------------------
+namespace {
+
+void countAlloc(std::size_t size) {
+    engine::debug::g_alloc_count.fetch_add(1, std::memory_order_relaxed);
+    engine::debug::g_alloc_bytes.fetch_add(size, std::memory_order_relaxed);
+    ++engine::debug::t_alloc_total.count_;
+    engine::debug::t_alloc_total.bytes_ += size;
+}
+
+void* trackedAlloc(std::size_t size) {
+    countAlloc(size);
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void* trackedAlignedAlloc(std::size_t size, std::align_val_t alignment) {
+    countAlloc(size);
+    const auto align = static_cast<std::size_t>(alignment);
+#ifdef _WIN32
+    return _aligned_malloc(size == 0 ? 1 : size, align);
+#else
+    // aligned_alloc 要求大小是对齐值的整数倍
+    const auto rounded = ((size == 0 ? 1 : size) + align - 1) / align * align;
+    return std::aligned_alloc(align, rounded);
+#endif
+}
+
+void trackedAlignedFree(void* ptr) noexcept {
+#ifdef _WIN32
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+} // namespace
+
+void* operator new(std::size_t size) {
+    if (void* ptr = trackedAlloc(size)) return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    if (void* ptr = trackedAlloc(size)) return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return trackedAlloc(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return trackedAlloc(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    if (void* ptr = trackedAlignedAlloc(size, alignment)) return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    if (void* ptr = trackedAlignedAlloc(size, alignment)) return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { trackedAlignedFree(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { trackedAlignedFree(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { trackedAlignedFree(ptr); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept { trackedAlignedFree(ptr); }
+
+#endif // ENGINE_ALLOC_TRACKING
@@ -0,0 +1,93 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace engine::debug {
+
+/**
+ * @brief 一段时间内的堆分配统计
+ */
+struct AllocStats {
+    std::uint64_t count_{0};    ///< @brief 分配次数
+    std::uint64_t bytes_{0};    ///< @brief 分配字节数
+};
+
+/**
+ * @brief 某个作用域（通常是一个系统的 update）在一帧内的分配统计
+ */
+struct ScopeAllocStats {
+    const char* name_{nullptr};     ///< @brief 作用域名称（必须是字符串字面量，统计表不复制名称以免自身分配内存）
+    AllocStats frame_{};            ///< @brief 当前帧累计
+    AllocStats last_frame_{};       ///< @brief 上一帧的结果（用于显示）
+    std::uint64_t violations_{0};   ///< @brief ZERO_ALLOC 作用域发生分配的累计帧数（同一帧内多次进入作用域只计一次）
+    std::uint64_t last_violation_frame_{0};     ///< @brief 最近一次发生违规的帧序号
+    bool zero_alloc_{false};        ///< @brief 是否要求零分配
+};
+
+/**
+ * @brief 堆分配追踪器（调试用，默认关闭）
+ *
+ * 用 CMake 选项 ENABLE_ALLOC_TRACKING 开启后，全局 operator new 会统计每次分配：
+ * 1. 所有线程的分配计入帧统计（GameApp 每帧开始时调用 beginFrame()）；
+ * 2. 主线程中 AllocScope 作用域内的分配计入对应作用域（其它线程中的作用域不计入）；
+ * 3. 标记为 ZERO_ALLOC 的作用域发生分配时记录违规，开启 ENABLE_ZERO_ALLOC_ASSERT 后直接断言。
+ *
+ * 未开启时所有接口依然可用，只是统计结果始终为0，宏展开为空，不会带来任何开销。
+ */
+class AllocTracker final {
+public:
+    static constexpr size_t MAX_SCOPES{64};         ///< @brief 最多统计的作用域数量（固定大小，避免统计本身分配内存）
+    static constexpr size_t HISTORY_SIZE{120};      ///< @brief 每帧分配次数的历史记录长度
+
+    static bool isEnabled();                        ///< @brief 是否编译了分配追踪
+
+    static void beginFrame();                       ///< @brief 开始新的一帧：结算上一帧的统计
+    static AllocStats getLastFrame();               ///< @brief 上一帧的分配统计（所有线程）
+    static AllocStats getThreadTotal();             ///< @brief 当前线程累计的分配统计
+
+    static const std::array<float, HISTORY_SIZE>& getHistory();   ///< @brief 每帧分配次数的历史记录（环形缓冲区）
+    static size_t getHistoryOffset();                             ///< @brief 环形缓冲区中最旧记录的位置
+
+    static const std::array<ScopeAllocStats, MAX_SCOPES>& getScopes();  ///< @brief 所有作用域的统计
+    static size_t getScopeCount();                                      ///< @brief 已登记的作用域数量
+
+    /**
+     * @brief 把一次作用域的分配结果计入统计表（由 AllocScope 析构时调用）
+     * @param name 作用域名称（字符串字面量）
+     * @param stats 作用域内的分配
+     * @param zero_alloc 是否要求零分配
+     */
+    static void report(const char* name, const AllocStats& stats, bool zero_alloc);
+};
+
+/**
+ * @brief RAII 作用域：统计构造与析构之间当前线程的分配
+ */
+class AllocScope final {
+    const char* name_;
+    AllocStats start_;
+    bool zero_alloc_;
+
+public:
+    AllocScope(const char* name, bool zero_alloc = false);
+    ~AllocScope();
+
+    AllocScope(const AllocScope&) = delete;
+    AllocScope& operator=(const AllocScope&) = delete;
+};
+
+} // namespace engine::debug
+
+#define ENGINE_ALLOC_CONCAT_IMPL(a, b) a##b
+#define ENGINE_ALLOC_CONCAT(a, b) ENGINE_ALLOC_CONCAT_IMPL(a, b)
+
+#ifdef ENGINE_ALLOC_TRACKING
+    /// @brief 统计当前作用域的分配
+    #define ENGINE_ALLOC_SCOPE(name) ::engine::debug::AllocScope ENGINE_ALLOC_CONCAT(alloc_scope_, __LINE__)(name)
+    /// @brief 统计当前作用域的分配，并要求稳定运行时零分配
+    #define ENGINE_ZERO_ALLOC_SCOPE(name) ::engine::debug::AllocScope ENGINE_ALLOC_CONCAT(alloc_scope_, __LINE__)(name, true)
+#else
+    #define ENGINE_ALLOC_SCOPE(name) ((void)0)
+    #define ENGINE_ZERO_ALLOC_SCOPE(name) ((void)0)
+#endif
@@ -0,0 +1,162 @@
+#include "memory_profiler.h"
+#include "engine/component/animation_component.h"
+#include "engine/component/audio_component.h"
+#include "engine/component/name_component.h"
+#include "engine/component/parallax_component.h"
+#include "engine/component/render_component.h"
+#include "engine/component/sprite_component.h"
+#include "engine/component/tilelayer_component.h"
+#include "engine/component/transform_component.h"
+#include "engine/component/velocity_component.h"
+#include <algorithm>
+#include <fstream>
+#include <entt/entity/registry.hpp>
+#include <entt/signal/dispatcher.hpp>
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+
+namespace engine::debug {
+
+size_t MemorySnapshot::getTotalBytes() const {
+    return ecs_bytes_ + ecs_heap_bytes_ + resources_.texture_bytes_ + resources_.sound_bytes_ + resources_.music_bytes_;
+}
+
+MemoryProfiler::MemoryProfiler() : history_(HISTORY_SIZE, 0.0f) {
+    // 登记引擎层的组件类型 (游戏层的组件由使用者自行登记)
+    track<engine::component::TransformComponent>();
+    track<engine::component::VelocityComponent>();
+    track<engine::component::RenderComponent>();
+    track<engine::component::ParallaxComponent>();
+    track<engine::component::SpriteComponent>([](const engine::component::SpriteComponent& sprite) {
+        return heapBytes(sprite.sprite_.texture_path_);
+    });
+    track<engine::component::NameComponent>([](const engine::component::NameComponent& name) {
+        return heapBytes(name.name_);
+    });
+    track<engine::component::AudioComponent>([](const engine::component::AudioComponent& audio) {
+        return heapBytes(audio.sounds_);
+    });
+    track<engine::component::TileLayerComponent>([](const engine::component::TileLayerComponent& layer) {
+        return heapBytes(layer.tiles_);
+    });
+    track<engine::component::AnimationComponent>([](const engine::component::AnimationComponent& animation) {
+        size_t bytes = heapBytes(animation.animations_);
+        for (const auto& [id, anim] : animation.animations_) {
+            bytes += heapBytes(anim.frames_) + heapBytes(anim.events_);
+        }
+        return bytes;
+    });
+}
+
+MemorySnapshot MemoryProfiler::capture(entt::registry& registry,
+                                       const entt::dispatcher& dispatcher,
+                                       const engine::resource::ResourceManager& resource_manager) const {
+    MemorySnapshot snapshot;
+    snapshot.entity_count_ = registry.storage<entt::entity>().free_list();
+    snapshot.pending_events_ = dispatcher.size();
+    snapshot.resources_ = resource_manager.getMemoryStats();
+
+    for (auto [id, set] : registry.storage()) {
+        StorageStats stats;
+        stats.name_ = std::string(set.type().name());
+        stats.count_ = set.size();
+        stats.capacity_ = set.capacity();
+        // 稀疏数组与密集数组（实体索引）
+        stats.bytes_ = (set.extent() + set.capacity()) * sizeof(entt::entity);
+        if (auto it = types_.find(set.type().hash()); it != types_.end()) {
+            stats.tracked_ = true;
+            stats.bytes_ += stats.capacity_ * it->second.element_size_;
+            if (it->second.heap_) {
+                stats.heap_bytes_ = it->second.heap_(set);
+            }
+        }
+        snapshot.ecs_bytes_ += stats.bytes_;
+        snapshot.ecs_heap_bytes_ += stats.heap_bytes_;
+        snapshot.storages_.push_back(std::move(stats));
+    }
+
+    std::sort(snapshot.storages_.begin(), snapshot.storages_.end(), [](const StorageStats& a, const StorageStats& b) {
+        return a.bytes_ + a.heap_bytes_ > b.bytes_ + b.heap_bytes_;
+    });
+    return snapshot;
+}
+
+void MemoryProfiler::record(MemorySnapshot snapshot) {
+    history_[history_offset_] = static_cast<float>(snapshot.getTotalBytes()) / (1024.0f * 1024.0f);
+    history_offset_ = (history_offset_ + 1) % HISTORY_SIZE;
+    latest_ = std::move(snapshot);
+}
+
+bool MemoryProfiler::dumpJson(const MemorySnapshot& snapshot, std::string_view file_path) {
+    nlohmann::ordered_json json;
+    json["entity_count"] = snapshot.entity_count_;
+    json["pending_events"] = snapshot.pending_events_;
+    json["ecs_bytes"] = snapshot.ecs_bytes_;
+    json["ecs_heap_bytes"] = snapshot.ecs_heap_bytes_;
+    json["total_bytes"] = snapshot.getTotalBytes();
+    json["resources"] = {
+        {"texture_count", snapshot.resources_.texture_count_},
+        {"texture_bytes", snapshot.resources_.texture_bytes_},
+        {"texture_budget_bytes", snapshot.resources_.texture_budget_bytes_},
+        {"texture_referenced_count", snapshot.resources_.texture_referenced_count_},
+        {"texture_evictions", snapshot.resources_.texture_evictions_},
+        {"texture_reloads", snapshot.resources_.texture_reloads_},
+        {"sound_count", snapshot.resources_.sound_count_},
+        {"sound_bytes", snapshot.resources_.sound_bytes_},
+        {"music_count", snapshot.resources_.music_count_},
+        {"music_bytes", snapshot.resources_.music_bytes_},
+    };
+    auto& audio_policies = json["resources"]["audio_policies"] = nlohmann::ordered_json::object();
+    for (size_t i = 0; i < snapshot.resources_.audio_policies_.size(); ++i) {
+        const auto& policy = snapshot.resources_.audio_policies_[i];
+        audio_policies[std::string(engine::resource::toString(static_cast<engine::resource::AudioLoadPolicy>(i)))] = {
+            {"registered", policy.registered_},
+            {"loaded", policy.loaded_},
+            {"bytes", policy.bytes_},
+        };
+    }
+    json["render"] = {
+        {"draw_calls", snapshot.render_.draw_calls_},
+        {"texture_draws", snapshot.render_.texture_draws_},
+        {"texture_switches", snapshot.render_.texture_switches_},
+        {"color_mod_changes", snapshot.render_.color_mod_changes_},
+        {"alpha_mod_changes", snapshot.render_.alpha_mod_changes_},
+        {"draw_color_changes", snapshot.render_.draw_color_changes_},
+        {"text_draws", snapshot.render_.text_draws_},
+        {"world_draws", snapshot.render_.world_draws_},
+        {"world_culled", snapshot.render_.world_culled_},
+        {"vertices", snapshot.render_.vertices_},
+    };
+    json["frame_time"] = {
+        {"samples", snapshot.frame_time_.samples_},
+        {"average_ms", snapshot.frame_time_.average_ms_},
+        {"p50_ms", snapshot.frame_time_.p50_ms_},
+        {"p99_ms", snapshot.frame_time_.p99_ms_},
+        {"max_ms", snapshot.frame_time_.max_ms_},
+        {"missed_deadlines", snapshot.frame_time_.missed_deadlines_},
+        {"total_missed_deadlines", snapshot.frame_time_.total_missed_deadlines_},
+        {"sleep_overshoot_ms", snapshot.frame_time_.sleep_overshoot_ms_},
+    };
+    auto& storages = json["storages"] = nlohmann::ordered_json::array();
+    for (const auto& stats : snapshot.storages_) {
+        storages.push_back({
+            {"name", stats.name_},
+            {"count", stats.count_},
+            {"capacity", stats.capacity_},
+            {"bytes", stats.bytes_},
+            {"heap_bytes", stats.heap_bytes_},
+            {"tracked", stats.tracked_},
+        });
+    }
+
+    std::ofstream file{std::string(file_path)};
+    if (!file.is_open()) {
+        spdlog::error("无法打开内存统计文件: {}", file_path);
+        return false;
+    }
+    file << json.dump(4);
+    spdlog::info("内存统计已导出到: {}", file_path);
+    return true;
+}
+
+} // namespace engine::debug
@@ -0,0 +1,141 @@
+#pragma once
+#include "engine/core/time.h"
+#include "engine/render/render_stats.h"
+#include "engine/resource/resource_manager.h"
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <functional>
+#include <type_traits>
+#include <unordered_map>
+#include <entt/core/type_info.hpp>
+#include <entt/entity/fwd.hpp>
+#include <entt/entity/storage.hpp>
+#include <entt/signal/fwd.hpp>
+
+namespace engine::debug {
+
+// --- 组件堆内存估算辅助函数 ---
+
+/// @brief 字符串的堆内存（短字符串优化范围内为0）
+inline size_t heapBytes(const std::string& str) {
+    static const size_t sso_capacity = std::string().capacity();
+    return str.capacity() > sso_capacity ? str.capacity() + 1 : 0;
+}
+
+/// @brief vector 的堆内存（只统计自身缓冲区，不递归元素）
+template<typename T>
+size_t heapBytes(const std::vector<T>& vec) {
+    return vec.capacity() * sizeof(T);
+}
+
+/// @brief unordered_map 的堆内存估算值（桶数组 + 每个节点的键值对与链表指针，不递归值）
+template<typename K, typename V>
+size_t heapBytes(const std::unordered_map<K, V>& map) {
+    return map.bucket_count() * sizeof(void*) +
+           map.size() * (sizeof(typename std::unordered_map<K, V>::value_type) + 2 * sizeof(void*));
+}
+
+/**
+ * @brief 单个组件存储的内存统计
+ */
+struct StorageStats {
+    std::string name_;          ///< @brief 组件类型名称
+    size_t count_{0};           ///< @brief 组件数量
+    size_t capacity_{0};        ///< @brief 容量
+    size_t bytes_{0};           ///< @brief 存储本身占用的内存（稀疏数组 + 密集数组 + 组件数据）
+    size_t heap_bytes_{0};      ///< @brief 组件内部持有的堆内存（如动画表、字符串）
+    bool tracked_{false};       ///< @brief 是否登记了组件类型（未登记的类型无法统计组件数据大小）
+};
+
+/**
+ * @brief 某一时刻的内存快照
+ */
+struct MemorySnapshot {
+    std::vector<StorageStats> storages_;                    ///< @brief 各组件存储的统计，按总内存降序
+    size_t entity_count_{0};                                ///< @brief 存活的实体数量
+    size_t ecs_bytes_{0};                                   ///< @brief 所有组件存储的内存合计
+    size_t ecs_heap_bytes_{0};                              ///< @brief 所有组件持有的堆内存合计
+    size_t pending_events_{0};                              ///< @brief 分发器队列中等待处理的事件数量
+    engine::resource::ResourceMemoryStats resources_{};     ///< @brief 资源缓存统计
+    engine::render::RenderStats render_{};                  ///< @brief 采样时上一帧的绘制统计（由使用者填入）
+    engine::core::FrameTimeStats frame_time_{};             ///< @brief 采样时最近若干帧的帧时间统计（由使用者填入）
+
+    size_t getTotalBytes() const;                           ///< @brief ECS + 资源缓存的内存合计
+};
+
+/**
+ * @brief ECS 及资源缓存的内存统计工具（调试用）
+ *
+ * 遍历 registry.storage() 中的每个组件存储，统计数量、容量与字节数。
+ * EnTT 的存储基类不知道组件类型的大小，因此需要用 track<T>() 登记组件类型，
+ * 同时可以提供一个函数估算组件内部持有的堆内存。
+ */
+class MemoryProfiler final {
+    /// @brief 登记的组件类型信息
+    struct TypeEntry {
+        size_t element_size_{0};                                        ///< @brief 组件大小（空类型为0）
+        std::function<size_t(const entt::sparse_set&)> heap_;           ///< @brief 统计存储中所有组件的堆内存
+    };
+
+    std::unordered_map<entt::id_type, TypeEntry> types_;    ///< @brief 组件类型哈希 -> 类型信息
+    MemorySnapshot latest_;                                 ///< @brief 最近一次记录的快照
+    std::vector<float> history_;                            ///< @brief 总内存历史记录（MB，环形缓冲区）
+    size_t history_offset_{0};                              ///< @brief 环形缓冲区中最旧记录的位置
+
+public:
+    static constexpr size_t HISTORY_SIZE{120};              ///< @brief 历史记录的长度
+
+    MemoryProfiler();       ///< @brief 构造函数，会登记引擎层的组件类型
+
+    /**
+     * @brief 登记组件类型
+     * @tparam T 组件类型
+     * @param heap 估算单个组件持有的堆内存的函数（可选）
+     */
+    template<typename T>
+    void track(std::function<size_t(const T&)> heap = nullptr) {
+        TypeEntry entry;
+        if constexpr (!std::is_empty_v<T>) {
+            entry.element_size_ = sizeof(T);
+            if (heap) {
+                entry.heap_ = [heap = std::move(heap)](const entt::sparse_set& set) {
+                    const auto& storage = static_cast<const entt::storage<T>&>(set);
+                    size_t bytes = 0;
+                    for (auto entity : storage) {
+                        bytes += heap(storage.get(entity));
+                    }
+                    return bytes;
+                };
+            }
+        }
+        types_[entt::type_hash<T>::value()] = std::move(entry);
+    }
+
+    /**
+     * @brief 采集一次内存快照
+     * @param registry 注册表
+     * @param dispatcher 事件分发器
+     * @param resource_manager 资源管理器
+     * @return 内存快照
+     */
+    MemorySnapshot capture(entt::registry& registry,
+                           const entt::dispatcher& dispatcher,
+                           const engine::resource::ResourceManager& resource_manager) const;
+
+    void record(MemorySnapshot snapshot);                   ///< @brief 保存快照，并把总内存加入历史记录
+    const MemorySnapshot& getLatest() const { return latest_; }
+    const std::vector<float>& getHistory() const { return history_; }
+    size_t getHistoryOffset() const { return history_offset_; }
+
+    /**
+     * @brief 把快照导出为 JSON 文件
+     * @param snapshot 内存快照
+     * @param file_path 文件路径
+     * @return 是否成功
+     */
+    static bool dumpJson(const MemorySnapshot& snapshot, std::string_view file_path);
+};
+
+} // namespace engine::debug
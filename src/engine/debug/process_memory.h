@@ -0,0 +1,13 @@
+#pragma once
+#include <cstddef>
+
+namespace engine::debug {
+
+/**
+ * @brief 获取当前进程的常驻内存（RSS，字节）
+ *
+ * 用于基准测试等需要对比整体内存占用的场合；平台不支持时返回0。
+ */
+size_t getResidentMemoryBytes();
+
+} // namespace engine::debug
@@ -0,0 +1,17 @@
+#pragma once
+
+/* 引擎层使用的标签组件（空结构体），与 game/defs/tags.h 中的游戏标签区分 */
+namespace engine::defs {
+
+struct StaticTag {};            ///< @brief 静态标签，标记位置与尺寸不会再改变的实体（如关卡瓦片），由VisibilitySystem的空间索引管理
+
+/**
+ * @brief 跟随鼠标标签，标记位置跟随鼠标的实体（如待放置单位），渲染前按重新采样的鼠标位置修正（延迟锁存）
+ * @note 只修正绘制位置，依赖位置的逻辑结果（如待放置单位的有效/无效颜色、目标放置点）仍按 update 时的鼠标位置计算。
+ *       鼠标快速移动时这些结果可能与画面相差一帧：例如绘制在放置点之外的单位仍显示为绿色，下一帧即恢复一致。
+ */
+struct FollowCursorTag {};
+
+struct VisibleTag {};           ///< @brief 可见标签，由VisibilitySystem每帧根据相机视口更新，只加在动态实体上（可见的静态实体见 VisibilitySystem::getStaticVisible()）
+
+}   // namespace engine::defs
@@ -0,0 +1,28 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <glm/vec2.hpp>
+#include <entt/core/fwd.hpp>
+
+namespace engine::input {
+
+/**
+ * @brief 一帧内的输入记录：本帧发生的动作状态变化及鼠标位置
+ *
+ * 由 InputManager 在每次 update() 时生成（getFrameInput()），回放时再交给 InputManager 代替真实输入（setPlaybackFrame()）。
+ * 只记录“动作”而非原始按键，因此与按键映射无关；鼠标记录逻辑坐标，与窗口大小无关。
+ */
+struct InputFrame {
+    struct ActionInput {
+        entt::id_type action_name_id_{};    ///< @brief 动作名称ID
+        bool is_input_active_{false};       ///< @brief 按下（true）或释放（false）
+        bool is_repeat_event_{false};       ///< @brief 是否为按键重复事件
+        std::uint64_t timestamp_ns_{0};     ///< @brief SDL 事件时间戳（纳秒，与 SDL_GetTicksNS 同一时基；回放的输入为0，不写入录像）
+    };
+
+    std::vector<ActionInput> actions_;      ///< @brief 本帧的动作状态变化（按发生顺序）
+    glm::vec2 mouse_position_{};            ///< @brief 鼠标位置 (屏幕坐标)
+    glm::vec2 logical_mouse_position_{};    ///< @brief 鼠标位置 (逻辑坐标)
+};
+
+} // namespace engine::input
@@ -1,10 +1,12 @@
 #include "input_manager.h"
 #include "engine/core/config.h"
 #include "engine/utils/events.h"
+#include <algorithm>
 #include <stdexcept>
 #include <SDL3/SDL.h>
 #include <spdlog/spdlog.h>
 #include <glm/vec2.hpp>
+#include <glm/geometric.hpp>
 #include <entt/signal/dispatcher.hpp>
 #include <entt/core/hashed_string.hpp>
 #include <imgui.h>
@@ -46,11 +48,23 @@ void InputManager::update() {
     }
 
     // 2. 处理所有待处理的 SDL 事件 (这将设定 action_states_ 的值)
+    frame_input_.actions_.clear();
+    oldest_event_time_ = 0;
+    frame_events_ = 0;
     SDL_Event event;
     while (SDL_PollEvent(&event)) {
+        if (is_playback_) {         // 回放时只响应关闭窗口，其它输入来自录像
+            if (event.type == SDL_EVENT_QUIT) quit();
+            continue;
+        }
         ImGui_ImplSDL3_ProcessEvent(&event);    // ImGui 步骤2 处理 ImGui 事件
         processEvent(event);
     }
+    if (is_playback_) {
+        applyPlaybackFrame();
+    }
+    frame_input_.mouse_position_ = mouse_position_;
+    frame_input_.logical_mouse_position_ = logical_mouse_position_;
 
     // 3. 触发回调
     for (auto& [action_name_id, state] : action_states_) {
@@ -68,11 +82,81 @@ void InputManager::update() {
     }
 }
 
+void InputManager::setPlayback(bool is_playback) {
+    is_playback_ = is_playback;
+    playback_frame_ = {};
+    // 清除真实输入残留的按下状态，避免切换后动作一直处于按下状态
+    for (auto& [action_name_id, state] : action_states_) {
+        state = ActionState::INACTIVE;
+    }
+}
+
+void InputManager::applyPlaybackFrame() {
+    for (const auto& action : playback_frame_.actions_) {
+        updateActionState(action.action_name_id_, action.is_input_active_, action.is_repeat_event_);
+    }
+    mouse_position_ = playback_frame_.mouse_position_;
+    logical_mouse_position_ = playback_frame_.logical_mouse_position_;
+    playback_frame_.actions_.clear();   // 同一帧的动作只应用一次（鼠标位置保留）
+}
+
+glm::vec2 InputManager::latchMousePosition() {
+    latch_time_ = 0;
+    latch_correction_px_ = 0.0f;
+    // 回放时鼠标来自录像；ImGui 占用鼠标时本帧的逻辑位置不随鼠标移动，两者都不修正
+    if (is_playback_ || ImGui::GetIO().WantCaptureMouse) return {0.0f, 0.0f};
+
+    float x, y;
+    SDL_GetMouseState(&x, &y);
+    latch_time_ = SDL_GetTicksNS();
+    glm::vec2 latched_position;
+    SDL_RenderCoordinatesFromWindow(sdl_renderer_, x, y, &latched_position.x, &latched_position.y);
+    const auto offset = latched_position - logical_mouse_position_;
+    latch_correction_px_ = glm::length(offset);
+    return offset;
+}
+
+void InputManager::onFramePresented() {
+    constexpr float ALPHA = 0.1f;
+    const Uint64 now = SDL_GetTicksNS();
+    latency_stats_.events_ = frame_events_;
+    if (oldest_event_time_ != 0 && oldest_event_time_ <= now) {
+        const float latency_ms = static_cast<float>(now - oldest_event_time_) / 1000000.0f;
+        latency_stats_.input_to_present_ms_ = latency_ms;
+        latency_stats_.average_input_to_present_ms_ = latency_stats_.average_input_to_present_ms_ == 0.0f
+            ? latency_ms : latency_stats_.average_input_to_present_ms_ + ALPHA * (latency_ms - latency_stats_.average_input_to_present_ms_);
+        latency_stats_.max_input_to_present_ms_ = std::max(latency_stats_.max_input_to_present_ms_, latency_ms);
+    }
+    latency_stats_.latch_to_present_ms_ = latch_time_ != 0 ? static_cast<float>(now - latch_time_) / 1000000.0f : 0.0f;
+    latency_stats_.latch_correction_px_ = latch_correction_px_;
+    latch_time_ = 0;
+}
+
+void InputManager::recordEventTime(Uint64 timestamp_ns) {
+    ++frame_events_;
+    if (oldest_event_time_ == 0 || timestamp_ns < oldest_event_time_) {
+        oldest_event_time_ = timestamp_ns;
+    }
+}
+
 void InputManager::quit() {
     dispatcher_->trigger<engine::utils::QuitEvent>();
 }
 
 void InputManager::processEvent(const SDL_Event& event) {
+    // 输入延迟测量包括被 ImGui 捕获的输入（同样需要呈现到屏幕上）
+    switch (event.type) {
+        case SDL_EVENT_KEY_DOWN:
+        case SDL_EVENT_KEY_UP:
+        case SDL_EVENT_MOUSE_BUTTON_DOWN:
+        case SDL_EVENT_MOUSE_BUTTON_UP:
+        case SDL_EVENT_MOUSE_MOTION:
+            recordEventTime(event.common.timestamp);
+            break;
+        default:
+            break;
+    }
+
     // 如果 ImGui 捕获了鼠标，则不处理该事件(避免穿透到游戏中)
     if (ImGui::GetIO().WantCaptureMouse) {
         return;
@@ -89,7 +173,7 @@ void InputManager::processEvent(const SDL_Event& event) {
             if (it != input_to_actions_.end()) {     // 如果按键有对应的action
                 const std::vector<entt::id_type>& associated_actions = it->second;
                 for (const auto& action_name : associated_actions) {
-                    updateActionState(action_name, is_down, is_repeat); // 更新action状态
+                    updateActionState(action_name, is_down, is_repeat, event.key.timestamp); // 更新action状态
                 }
             }
             break;
@@ -103,7 +187,7 @@ void InputManager::processEvent(const SDL_Event& event) {
                 const std::vector<entt::id_type>& associated_actions = it->second;
                 for (const auto& action_name : associated_actions) {
                     // 鼠标事件不考虑repeat, 所以第三个参数传false
-                    updateActionState(action_name, is_down, false); // 更新action状态
+                    updateActionState(action_name, is_down, false, event.button.timestamp); // 更新action状态
                 }
             }
             // 在点击时更新鼠标位置，同时更新逻辑位置
@@ -223,13 +307,15 @@ Uint32 InputManager::mouseButtonFromString(std::string_view button_name) {
     return 0; // 0 不是有效的按钮值，表示无效
 }
 
-void InputManager::updateActionState(entt::id_type action_name_id, bool is_input_active, bool is_repeat_event) {
+void InputManager::updateActionState(entt::id_type action_name_id, bool is_input_active, bool is_repeat_event, Uint64 timestamp_ns) {
     auto it = action_states_.find(action_name_id);
     if (it == action_states_.end()) {
         spdlog::warn("尝试更新未注册的动作状态: {}", action_name_id);
         return;
     }
 
+    frame_input_.actions_.push_back({action_name_id, is_input_active, is_repeat_event, timestamp_ns});
+
     if (is_input_active) { // 输入被激活 (按下)
         if (is_repeat_event) {
             it->second = ActionState::HELD; 
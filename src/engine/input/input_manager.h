@@ -1,6 +1,8 @@
 #pragma once
+#include "input_frame.h"
 #include <string_view>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 #include <array>
 #include <variant>
@@ -25,6 +27,18 @@ enum class ActionState {
     INACTIVE    // 动作未激活 (放在最后，不占用数组索引)
 };
 
+/**
+ * @brief 输入延迟统计（时间均以 SDL_GetTicksNS 为时基）
+ */
+struct InputLatencyStats {
+    size_t events_{0};                          ///< @brief 上一帧处理的输入事件数（键盘、鼠标按钮、鼠标移动）
+    float input_to_present_ms_{0.0f};           ///< @brief 上一个有输入的帧：最早的输入事件到呈现完成
+    float average_input_to_present_ms_{0.0f};   ///< @brief 输入到呈现的指数滑动平均
+    float max_input_to_present_ms_{0.0f};       ///< @brief 输入到呈现的历史最大值
+    float latch_to_present_ms_{0.0f};           ///< @brief 上一帧鼠标重新采样（延迟锁存）到呈现完成
+    float latch_correction_px_{0.0f};           ///< @brief 上一帧延迟锁存修正的鼠标距离（逻辑像素）
+};
+
 /**
  * @brief 输入管理器类，负责处理输入事件和动作状态。
  * 
@@ -52,6 +66,18 @@ private:
     glm::vec2 mouse_position_;                                      ///< @brief 鼠标位置 (针对屏幕坐标)
     glm::vec2 logical_mouse_position_;                              ///< @brief 鼠标位置 (针对逻辑坐标)
 
+    // --- 输入延迟测量 ---
+    Uint64 oldest_event_time_{0};                                   ///< @brief 本帧最早的输入事件时间戳（0 表示本帧没有输入）
+    size_t frame_events_{0};                                        ///< @brief 本帧处理的输入事件数
+    Uint64 latch_time_{0};                                          ///< @brief 本帧重新采样鼠标位置的时间戳（0 表示未采样）
+    float latch_correction_px_{0.0f};                               ///< @brief 本帧延迟锁存修正的距离
+    InputLatencyStats latency_stats_;                               ///< @brief 延迟统计
+
+    // --- 输入录像与回放 ---
+    InputFrame frame_input_;                                        ///< @brief 本帧的输入记录（供录像使用）
+    InputFrame playback_frame_;                                     ///< @brief 回放时下一帧要应用的输入
+    bool is_playback_{false};                                       ///< @brief 是否处于回放模式（忽略真实的键盘鼠标输入）
+
 public:
     /**
      * @brief 构造函数
@@ -82,11 +108,31 @@ public:
     glm::vec2 getMousePosition() const;                              ///< @brief 获取鼠标位置 （屏幕坐标）
     glm::vec2 getLogicalMousePosition() const;                       ///< @brief 获取鼠标位置 （逻辑坐标）
 
+    // --- 延迟锁存与输入延迟 ---
+    /**
+     * @brief 渲染前重新采样鼠标位置（延迟锁存），只用于跟随鼠标的画面，不改变本帧逻辑使用的鼠标位置
+     * @return 最新的逻辑坐标与本帧 update() 时逻辑坐标之差；回放或 ImGui 占用鼠标时返回 0
+     */
+    glm::vec2 latchMousePosition();
+    void onFramePresented();                                          ///< @brief 呈现完成后调用，结算本帧的输入延迟
+    const InputLatencyStats& getLatencyStats() const { return latency_stats_; }  ///< @brief 获取输入延迟统计
+
+    // --- 输入录像与回放 ---
+    const InputFrame& getFrameInput() const { return frame_input_; }  ///< @brief 获取本帧的输入记录
+    /// @brief 开启/关闭回放模式。回放时仍处理窗口关闭事件，但键盘鼠标输入被忽略，改用 setPlaybackFrame() 设置的输入
+    void setPlayback(bool is_playback);
+    bool isPlayback() const { return is_playback_; }
+    /// @brief 设置下一次 update() 要应用的输入（每帧调用一次；应用后动作清空，鼠标位置保留）
+    void setPlaybackFrame(InputFrame frame) { playback_frame_ = std::move(frame); }
+
 private:
     void processEvent(const SDL_Event& event);                      ///< @brief 处理 SDL 事件（将按键转换为动作状态）
+    void applyPlaybackFrame();                                      ///< @brief 应用回放输入（代替 SDL 事件）
     void initializeMappings(const engine::core::Config* config);    ///< @brief 根据 Config配置初始化映射表
 
-    void updateActionState(entt::id_type action_name_id, bool is_input_active, bool is_repeat_event); ///< @brief 辅助更新动作状态
+    /// @brief 辅助更新动作状态（timestamp_ns 为触发该变化的 SDL 事件时间戳，回放时为0）
+    void updateActionState(entt::id_type action_name_id, bool is_input_active, bool is_repeat_event, Uint64 timestamp_ns = 0);
+    void recordEventTime(Uint64 timestamp_ns);                        ///< @brief 记录一个输入事件的时间戳（用于输入延迟测量）
     SDL_Scancode scancodeFromString(std::string_view key_name);     ///< @brief 将字符串键名转换为 SDL_Scancode
     Uint32 mouseButtonFromString(std::string_view button_name);     ///< @brief 将字符串按钮名转换为 SDL_Button
 };
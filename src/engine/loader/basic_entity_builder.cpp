@@ -7,6 +7,7 @@
 #include "engine/component/transform_component.h"
 #include "engine/component/render_component.h"
 #include "engine/resource/resource_manager.h"
+#include "engine/defs/tags.h"
 #include <entt/entt.hpp>
 #include <spdlog/spdlog.h>
 
@@ -134,6 +135,8 @@ void BasicEntityBuilder::buildTransform() {
 
     // 添加 TransformComponent
     registry_.emplace<engine::component::TransformComponent>(entity_id_, position_, scale, rotation);
+    // 关卡地图中的实体不会移动，标记为静态（由VisibilitySystem的空间索引管理）
+    registry_.emplace<engine::defs::StaticTag>(entity_id_);
 }
 
 void BasicEntityBuilder::buildRender() {
@@ -1,4 +1,8 @@
 #include "level_loader.h"
+#include "tile_chunk_map.h"
+#include "tiled_json_reader.h"
+#include "tile_data_decoder.h"
+#include "level_preloader.h"
 #include "engine/scene/scene.h"
 #include "engine/core/context.h"
 #include "engine/resource/resource_manager.h"
@@ -8,6 +12,7 @@
 #include "engine/component/transform_component.h"
 #include "engine/component/parallax_component.h"
 #include "engine/component/render_component.h"
+#include "engine/defs/tags.h"
 #include "engine/render/renderer.h"
 #include "engine/utils/math.h"
 #include <filesystem>
@@ -25,7 +30,20 @@ void LevelLoader::setEntityBuilder(std::unique_ptr<BasicEntityBuilder> builder)
     entity_builder_ = std::move(builder);
 }
 
+std::unique_ptr<TileChunkMap> LevelLoader::takeChunkMap() {
+    return std::move(chunk_map_);
+}
+
 bool LevelLoader::loadLevel(std::string_view level_path, engine::scene::Scene* scene) {
+    // 流式解析地图文件 (瓦片层的 data 数组直接解码到 gid 缓冲区) 及其引用的 tileset
+    PreloadedLevel level;
+    if (!LevelPreloader::parse(level_path, level)) {
+        return false;
+    }
+    return loadLevel(std::move(level), scene);
+}
+
+bool LevelLoader::loadLevel(PreloadedLevel&& level, engine::scene::Scene* scene) {
     if (!scene) {
         spdlog::error("场景指针为空");
         return false;
@@ -37,25 +55,21 @@ bool LevelLoader::loadLevel(std::string_view level_path, engine::scene::Scene* s
         entity_builder_ = std::make_unique<BasicEntityBuilder>(*this, scene->getContext(), scene->getRegistry());
     }
 
-    // 1. 加载 JSON 文件
-    auto path = std::filesystem::path(level_path);
-    std::ifstream file(path);
-    if (!file.is_open()) {
-        spdlog::error("无法打开关卡文件: {}", level_path);
-        return false;
-    }
+    // 1. 取出解析结果
+    map_path_ = std::move(level.map_path_);
+    gid_buffers_ = std::move(level.gid_buffers_);
+    tileset_data_ = std::move(level.tileset_data_);
+    nlohmann::json json_data = std::move(level.map_json_);
+    const std::string_view level_path = map_path_;
 
-    // 2. 解析 JSON 数据
-    nlohmann::json json_data;
-    try {
-        file >> json_data;
-    } catch (const nlohmann::json::parse_error& e) {
-        spdlog::error("解析 JSON 数据失败: {}", e.what());
-        return false;
+    // 2. 用预先解码的图片创建纹理（之后按路径获取纹理时直接命中缓存）
+    auto& resource_manager = scene_->getContext().getResourceManager();
+    for (const auto& image : level.images_) {
+        resource_manager.loadTexture(entt::hashed_string(image.path_.c_str()), image.path_, image.surface_.get());
     }
+    level.images_.clear();
 
     // 3. 获取基本地图信息 (名称、地图尺寸、瓦片尺寸)，并设置背景颜色
-    map_path_ = level_path;
     map_size_ = glm::ivec2(json_data.value("width", 0), json_data.value("height", 0));
     tile_size_ = glm::ivec2(json_data.value("tilewidth", 0), json_data.value("tileheight", 0));
     if (json_data.contains("backgroundcolor")) {
@@ -64,21 +78,7 @@ bool LevelLoader::loadLevel(std::string_view level_path, engine::scene::Scene* s
         scene_->getContext().getRenderer().setBgColorFloat(color.r, color.g, color.b, color.a);
     }
 
-    // 4. 加载 tileset 数据
-    if (json_data.contains("tilesets") && json_data["tilesets"].is_array()) {
-        for (const auto& tileset_json : json_data["tilesets"]) {
-            if (!tileset_json.contains("source") || !tileset_json["source"].is_string() ||
-                !tileset_json.contains("firstgid") || !tileset_json["firstgid"].is_number_integer()) {
-                spdlog::error("tilesets 对象中缺少有效 'source' 或 'firstgid' 字段。");
-                continue;
-            }
-            auto tileset_path = resolvePath(tileset_json["source"].get<std::string>(), map_path_);  // 支持隐式转换，可以省略.get<T>()方法，
-            auto first_gid = tileset_json["firstgid"];
-            loadTileset(tileset_path, first_gid);
-        }
-    }
-
-    // 5. 加载图层数据
+    // 4. 加载图层数据
     if (!json_data.contains("layers") || !json_data["layers"].is_array()) {       // 地图文件中必须有 layers 数组
         spdlog::error("地图文件 '{}' 中缺少或无效的 'layers' 数组。", level_path);
         return false;
@@ -114,6 +114,8 @@ bool LevelLoader::loadLevel(std::string_view level_path, engine::scene::Scene* s
         current_layer_++;   // 每加载一个图层，图层ID加1
     }
 
+    gid_buffers_.clear();       // gid 缓冲区只在载入过程中使用
+    gid_buffers_.shrink_to_fit();
     spdlog::info("关卡加载完成: {}", level_path);
     return true;
 }
@@ -156,14 +158,22 @@ void LevelLoader::loadImageLayer(const nlohmann::json& layer_json) {
     registry.emplace<engine::component::ParallaxComponent>(entity, scroll_factor, repeat);
     registry.emplace<engine::component::SpriteComponent>(entity, sprite);
     registry.emplace<engine::component::RenderComponent>(entity, current_layer_);
+    registry.emplace<engine::defs::StaticTag>(entity);
     /* 实体与组件创建完毕后即由registry自动管理，不需要“添加到场景”的步骤 */
 
     spdlog::info("加载图层: '{}' 完成", layer_name);
 }
 
 void LevelLoader::loadTileLayer(const nlohmann::json& layer_json) {
-    if (!layer_json.contains("data") || !layer_json["data"].is_array()) {
-        spdlog::error("图层 '{}' 缺少 'data' 属性。", layer_json.value("name", "Unnamed"));
+    std::vector<std::uint32_t> gids;
+    if (!takeLayerGids(layer_json, gids)) {
+        spdlog::error("图层 '{}' 缺少有效的 'data' 属性。", layer_json.value("name", "Unnamed"));
+        return;
+    }
+
+    // 大地图且允许分块加载时，瓦片交给 ChunkStreamSystem 按需实例化
+    if (chunk_streaming_enabled_ && map_size_.x * map_size_.y >= CHUNK_STREAMING_MIN_TILES) {
+        loadChunkedTileLayer(layer_json, gids);
         return;
     }
 
@@ -180,12 +190,10 @@ void LevelLoader::loadTileLayer(const nlohmann::json& layer_json) {
     std::vector<entt::entity> tiles;
     tiles.reserve(map_size_.x * map_size_.y);
 
-    // 获取图层数据 (瓦片 ID 列表)
-    const auto& data = layer_json["data"];
-
     size_t index = 0;   // data数据的索引，它决定图块在地图中的位置
     // --- 每一个瓦片都是一个独立的entity ---
-    for (const int gid : data) {
+    for (const auto raw_gid : gids) {
+        const int gid = static_cast<int>(raw_gid);  // 保留最高位的翻转标志，与getTileInfoByGid的参数一致
         if (gid == 0) {
             index++;
             continue;
@@ -209,6 +217,87 @@ void LevelLoader::loadTileLayer(const nlohmann::json& layer_json) {
     spdlog::info("加载图层: '{}' 完成", layer_name);
 }
 
+bool LevelLoader::takeLayerGids(const nlohmann::json& layer_json, std::vector<std::uint32_t>& gids) {
+    // 流式解析时 data 数组已被解码到 gid_buffers_ 中
+    if (auto it = layer_json.find(TiledJsonReader::GID_BUFFER_KEY); it != layer_json.end()) {
+        const auto buffer_index = it->get<size_t>();
+        if (buffer_index >= gid_buffers_.size()) return false;
+        gids = std::move(gid_buffers_[buffer_index]);
+        return true;
+    }
+    if (!layer_json.contains("data")) return false;
+    // base64 编码（可能压缩）的字符串：直接解码到 gid 缓冲区
+    if (layer_json["data"].is_string()) {
+        if (layer_json.value("encoding", "csv") != "base64") {
+            spdlog::error("图层 '{}' 的 data 编码 '{}' 不受支持。", layer_json.value("name", "Unnamed"), layer_json.value("encoding", "csv"));
+            return false;
+        }
+        const auto tile_count = static_cast<size_t>(layer_json.value("width", map_size_.x)) *
+                                static_cast<size_t>(layer_json.value("height", map_size_.y));
+        const auto& data = layer_json["data"].get_ref<const std::string&>();
+        return TileDataDecoder::decodeLayer(data, layer_json.value("compression", ""), tile_count, gids);
+    }
+    // 普通 json 数组（兼容直接传入 DOM 的情况）
+    if (layer_json["data"].is_array()) {
+        const auto& data = layer_json["data"];
+        gids.reserve(data.size());
+        for (const auto& gid : data) {
+            gids.push_back(gid.get<std::uint32_t>());
+        }
+        return true;
+    }
+    return false;
+}
+
+void LevelLoader::loadChunkedTileLayer(const nlohmann::json& layer_json, const std::vector<std::uint32_t>& gids) {
+    if (!chunk_map_) {
+        chunk_map_ = std::make_unique<TileChunkMap>(map_size_, tile_size_);
+    }
+
+    // 获取图层名称
+    std::string layer_name = layer_json.value("name", "Unnamed");
+    entt::id_type name_id = entt::hashed_string(layer_name.c_str());
+
+    // 图层实体依然创建，TileLayerComponent 中只保存立即实例化的瓦片
+    auto& registry = scene_->getRegistry();
+    auto layer_entity = registry.create();
+    registry.emplace<engine::component::NameComponent>(layer_entity, name_id, layer_name);
+    std::vector<entt::entity> tiles;
+
+    TileChunkLayer chunk_layer{layer_name, current_layer_, {}};
+    chunk_layer.gids_.reserve(gids.size());
+    auto& resource_manager = scene_->getContext().getResourceManager();
+
+    size_t index = 0;
+    for (const auto gid : gids) {
+        std::uint32_t streamed_gid = 0;     // 交给分块存储的gid，0表示该位置没有需要流式加载的瓦片
+        if (gid != 0) {
+            // 每种瓦片只解析一次，并确保纹理在主线程中加载
+            if (!chunk_map_->hasTileInfo(gid)) {
+                if (auto tile_info = getTileInfoByGid(static_cast<int>(gid)); tile_info) {
+                    resource_manager.loadTexture(tile_info->sprite_.texture_id_, tile_info->sprite_.texture_path_);
+                    chunk_map_->addTileInfo(gid, std::move(tile_info.value()));
+                }
+            }
+            const auto* tile_info = chunk_map_->getTileInfo(gid);
+            if (!tile_info) {
+                spdlog::error("瓦片 ID 为 {} 的瓦片未找到图块集。", gid);
+            } else if (tile_info->properties_) {
+                // 带自定义属性的瓦片可能关系到游戏逻辑（如放置区域），仍然立即实例化
+                tiles.push_back(entity_builder_->configure(static_cast<int>(index), tile_info)->build()->getEntityID());
+            } else {
+                streamed_gid = gid;
+            }
+        }
+        chunk_layer.gids_.push_back(streamed_gid);
+        index++;
+    }
+    chunk_map_->addLayer(std::move(chunk_layer));
+
+    registry.emplace<engine::component::TileLayerComponent>(layer_entity, tile_size_, map_size_, tiles);
+    spdlog::info("分块加载图层: '{}' 完成，立即实例化的瓦片数量: {}", layer_name, tiles.size());
+}
+
 void LevelLoader::loadObjectLayer(const nlohmann::json& layer_json) {
     if (!layer_json.contains("objects") || !layer_json["objects"].is_array()) {
         spdlog::error("对象图层 '{}' 缺少 'objects' 属性。", layer_json.value("name", "Unnamed"));
@@ -237,26 +326,6 @@ void LevelLoader::loadObjectLayer(const nlohmann::json& layer_json) {
     }
 }
 
-void LevelLoader::loadTileset(std::string_view tileset_path, int first_gid) {
-    auto path = std::filesystem::path(tileset_path);
-    std::ifstream tileset_file(path);
-    if (!tileset_file.is_open()) {
-        spdlog::error("无法打开 Tileset 文件: {}", tileset_path);
-        return;
-    }
-
-    nlohmann::json ts_json;
-    try {
-        tileset_file >> ts_json;
-    } catch (const nlohmann::json::parse_error& e) {
-        spdlog::error("解析 Tileset JSON 文件 '{}' 失败: {} (at byte {})", tileset_path, e.what(), e.byte);
-        return;
-    }
-    ts_json["file_path"] = tileset_path;    // 将文件路径存储到json中，后续解析图片路径时需要
-    tileset_data_[first_gid] = std::move(ts_json);
-    spdlog::info("Tileset 文件 '{}' 加载完成，firstgid: {}", tileset_path, first_gid);
-}
-
 std::optional<engine::utils::Rect> LevelLoader::getColliderRect(const nlohmann::json& tile_json) {
     if (!tile_json.contains("objectgroup")) return std::nullopt;
     auto& objectgroup = tile_json["objectgroup"];
@@ -5,6 +5,8 @@
 #include <string_view>
 #include <memory>
 #include <optional>
+#include <vector>
+#include <cstdint>
 #include <glm/vec2.hpp>
 #include <nlohmann/json.hpp>
 #include <entt/entity/registry.hpp>
@@ -21,6 +23,8 @@ namespace engine::scene {
 }
 
 namespace engine::loader {
+    class TileChunkMap;
+    struct PreloadedLevel;
 
 /**
  * 关卡加载器，负责加载关卡数据，并生成游戏实体
@@ -35,12 +39,17 @@ private:
     glm::ivec2 tile_size_;              ///< @brief 瓦片尺寸(像素)
 
     std::map<int, nlohmann::json> tileset_data_;            ///< @brief firstgid -> 瓦片集数据
+    std::vector<std::vector<std::uint32_t>> gid_buffers_;   ///< @brief 流式解析得到的各瓦片层 gid 数据（只在载入过程中使用）
 
     std::unique_ptr<BasicEntityBuilder> entity_builder_;    ///< @brief 实体生成器(生成器模式)
 
+    bool chunk_streaming_enabled_ = false;                  ///< @brief 是否允许大地图的瓦片层分块流式加载
+    std::unique_ptr<TileChunkMap> chunk_map_;               ///< @brief 分块瓦片地图（只有触发分块加载时才会创建）
+
     int current_layer_ = 0;      ///< @brief 当前图层序号（用于RenderComponent，决定渲染顺序）
 
 public:
+    static constexpr int CHUNK_STREAMING_MIN_TILES{64 * 64};   ///< @brief 地图瓦片数量达到该值时，瓦片层改为分块流式加载
 
     LevelLoader() = default;    ///< @brief 默认构造函数
     ~LevelLoader();
@@ -48,6 +57,15 @@ public:
     /// @brief 设置实体生成器（如果不设置，则使用默认的BasicEntityBuilder）
     void setEntityBuilder(std::unique_ptr<BasicEntityBuilder> builder);
 
+    /**
+     * @brief 设置是否允许分块流式加载（默认关闭）。
+     * @note 开启后，大地图的瓦片层只保存紧凑的gid数据，需要场景用 takeChunkMap() 取出并交给 ChunkStreamSystem。
+     */
+    void setChunkStreaming(bool enabled) { chunk_streaming_enabled_ = enabled; }
+
+    /// @brief 取出载入过程中生成的分块瓦片地图（没有触发分块加载则返回nullptr）
+    std::unique_ptr<TileChunkMap> takeChunkMap();
+
     /**
      * @brief 加载关卡数据，并生成游戏实体
      * @param level_path 关卡文件路径（.tmj）
@@ -56,22 +74,44 @@ public:
      */
     [[nodiscard]] bool loadLevel(std::string_view level_path, engine::scene::Scene* scene);
 
+    /**
+     * @brief 用预加载的数据生成游戏实体（只创建纹理和实体，不再读取、解析文件）
+     * @param level 预加载的关卡数据（见 LevelPreloader），其中的数据会被移走
+     * @param scene 场景指针（非拥有）
+     * @return true 加载成功，false 加载失败
+     */
+    [[nodiscard]] bool loadLevel(PreloadedLevel&& level, engine::scene::Scene* scene);
+
     // --- getters and setters ---
     const glm::ivec2& getMapSize() const { return map_size_; }
     const glm::ivec2& getTileSize() const { return tile_size_; }
     int getCurrentLayer() const { return current_layer_; }
+
+    /**
+     * @brief 解析图片路径，合并地图路径和相对路径。例如：
+     * 1. 文件路径："assets/maps/level1.tmj"
+     * 2. 相对路径："../textures/Layers/back.png"
+     * 3. 最终路径："assets/textures/Layers/back.png"
+     * @param relative_path 相对路径（相对于文件）
+     * @param file_path 文件路径
+     * @return std::string 解析后的完整路径。
+     */
+    static std::string resolvePath(std::string_view relative_path, std::string_view file_path);
     
 private:
     void loadImageLayer(const nlohmann::json& layer_json);    ///< @brief 加载图片图层
     void loadTileLayer(const nlohmann::json& layer_json);     ///< @brief 加载瓦片图层
-    void loadObjectLayer(const nlohmann::json& layer_json);   ///< @brief 加载对象图层
+    void loadChunkedTileLayer(const nlohmann::json& layer_json, const std::vector<std::uint32_t>& gids);  ///< @brief 以分块形式加载瓦片图层（只保存gid，不实例化瓦片）
 
-     /**
-      * @brief 加载 Tiled tileset 文件 (.tsj)，数据保存到tileset_data_。
-      * @param tileset_path Tileset 文件路径。
-      * @param first_gid 此 tileset 的第一个全局 ID。
-      */
-      void loadTileset(std::string_view tileset_path, int first_gid);
+    /**
+     * @brief 取出瓦片图层的 gid 数据
+     * @param layer_json 图层json数据
+     * @param gids 输出：gid 列表（保留翻转标志位）
+     * @return 图层中是否有有效的 data 数据
+     * @note 支持 json 整数数组与 base64 编码（可选 zlib / gzip / zstd 压缩）两种格式
+     */
+    bool takeLayerGids(const nlohmann::json& layer_json, std::vector<std::uint32_t>& gids);
+    void loadObjectLayer(const nlohmann::json& layer_json);   ///< @brief 加载对象图层
 
     /**
      * @brief 获取瓦片属性
@@ -130,17 +170,6 @@ private:
      * @return engine::component::TileInfo 瓦片信息。
      */
     std::optional<engine::component::TileInfo> getTileInfoByGid(int gid);
- 
-    /**
-     * @brief 解析图片路径，合并地图路径和相对路径。例如：
-     * 1. 文件路径："assets/maps/level1.tmj"
-     * 2. 相对路径："../textures/Layers/back.png"
-     * 3. 最终路径："assets/textures/Layers/back.png"
-     * @param relative_path 相对路径（相对于文件）
-     * @param file_path 文件路径
-     * @return std::string 解析后的完整路径。
-     */
-    std::string resolvePath(std::string_view relative_path, std::string_view file_path);
 };
 
 } // namespace engine::loader
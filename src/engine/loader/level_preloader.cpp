@@ -0,0 +1,122 @@
+#include "level_preloader.h"
+#include "level_loader.h"
+#include "tiled_json_reader.h"
+#include "engine/resource/archive_io.h"
+#include <chrono>
+#include <unordered_set>
+#include <SDL3/SDL_surface.h>
+#include <SDL3_image/SDL_image.h>
+#include <spdlog/spdlog.h>
+
+namespace engine::loader {
+
+void PreloadedLevel::SurfaceDeleter::operator()(SDL_Surface* surface) const {
+    if (surface) {
+        SDL_DestroySurface(surface);
+    }
+}
+
+void LevelPreloader::preload(std::string_view map_path, const engine::resource::AssetArchive* archive) {
+    if (future_.valid() && map_path_ == map_path) {
+        return;
+    }
+    map_path_ = map_path;
+    spdlog::info("开始后台预加载关卡: {}", map_path_);
+    future_ = std::async(std::launch::async, [path = map_path_, archive]() -> std::shared_ptr<PreloadedLevel> {
+        const auto start = std::chrono::steady_clock::now();
+        auto level = std::make_shared<PreloadedLevel>();
+        if (!parse(path, *level)) {
+            spdlog::error("后台预加载关卡失败: {}", path);
+            return nullptr;
+        }
+        decodeImages(*level, archive);
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        spdlog::info("关卡 '{}' 预加载完成，耗时 {:.2f} ms（{} 张图片）", path, elapsed.count(), level->images_.size());
+        return level;
+    }).share();
+}
+
+bool LevelPreloader::parse(std::string_view map_path, PreloadedLevel& level) {
+    level.map_path_ = map_path;
+    level.gid_buffers_.clear();
+    level.tileset_data_.clear();
+    if (!TiledJsonReader::readMap(map_path, level.map_json_, level.gid_buffers_)) {
+        spdlog::error("加载关卡文件失败: {}", map_path);
+        return false;
+    }
+
+    const auto& map_json = level.map_json_;
+    if (!map_json.contains("tilesets") || !map_json["tilesets"].is_array()) {
+        return true;
+    }
+    for (const auto& tileset_json : map_json["tilesets"]) {
+        if (!tileset_json.contains("source") || !tileset_json["source"].is_string() ||
+            !tileset_json.contains("firstgid") || !tileset_json["firstgid"].is_number_integer()) {
+            spdlog::error("tilesets 对象中缺少有效 'source' 或 'firstgid' 字段。");
+            continue;
+        }
+        auto tileset_path = LevelLoader::resolvePath(tileset_json["source"].get<std::string>(), map_path);
+        int first_gid = tileset_json["firstgid"];
+        // 流式解析，只保留用到的字段
+        nlohmann::json ts_json;
+        if (!TiledJsonReader::readTileset(tileset_path, ts_json)) {
+            spdlog::error("加载 Tileset 文件 '{}' 失败", tileset_path);
+            continue;
+        }
+        ts_json["file_path"] = tileset_path;    // 将文件路径存储到json中，后续解析图片路径时需要
+        level.tileset_data_[first_gid] = std::move(ts_json);
+        spdlog::info("Tileset 文件 '{}' 加载完成，firstgid: {}", tileset_path, first_gid);
+    }
+    return true;
+}
+
+void LevelPreloader::decodeImages(PreloadedLevel& level, const engine::resource::AssetArchive* archive) {
+    // --- 收集图片路径（与 LevelLoader 中的路径解析方式保持一致，保证纹理 id 相同） ---
+    std::vector<std::string> paths;
+    std::unordered_set<std::string> seen;
+    auto add = [&](std::string_view relative_path, std::string_view file_path) {
+        auto path = LevelLoader::resolvePath(relative_path, file_path);
+        if (seen.insert(path).second) {
+            paths.push_back(std::move(path));
+        }
+    };
+    for (const auto& [first_gid, tileset] : level.tileset_data_) {
+        const auto file_path = tileset.value("file_path", "");
+        if (tileset.contains("image") && tileset["image"].is_string()) {
+            add(tileset["image"].get<std::string>(), file_path);
+        }
+        if (!tileset.contains("tiles") || !tileset["tiles"].is_array()) continue;
+        for (const auto& tile_json : tileset["tiles"]) {
+            if (tile_json.contains("image") && tile_json["image"].is_string()) {
+                add(tile_json["image"].get<std::string>(), file_path);
+            }
+        }
+    }
+    if (level.map_json_.contains("layers") && level.map_json_["layers"].is_array()) {
+        for (const auto& layer_json : level.map_json_["layers"]) {
+            if (layer_json.value("type", "") == "imagelayer" && layer_json.value("visible", true) &&
+                layer_json.contains("image") && layer_json["image"].is_string()) {
+                add(layer_json["image"].get<std::string>(), level.map_path_);
+            }
+        }
+    }
+
+    // --- 解码（SDL_Surface 可以在任意线程创建） ---
+    level.images_.clear();
+    level.images_.reserve(paths.size());
+    for (auto& path : paths) {
+        SDL_Surface* surface = nullptr;
+        if (auto* io = engine::resource::openArchiveIO(archive, path)) {
+            surface = IMG_Load_IO(io, true);
+        } else {
+            surface = IMG_Load(path.c_str());
+        }
+        if (!surface) {
+            spdlog::warn("预加载图片失败（将在主线程重试）: '{}': {}", path, SDL_GetError());
+            continue;
+        }
+        level.images_.push_back({std::move(path), std::unique_ptr<SDL_Surface, PreloadedLevel::SurfaceDeleter>(surface)});
+    }
+}
+
+} // namespace engine::loader
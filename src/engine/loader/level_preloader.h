@@ -0,0 +1,84 @@
+#pragma once
+#include <cstdint>
+#include <future>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+struct SDL_Surface;
+
+namespace engine::resource {
+    class AssetArchive;
+}
+
+namespace engine::loader {
+
+/**
+ * @brief 预加载的关卡数据：地图与图块集已解析、图片已解码，只差在主线程创建纹理和实体。
+ */
+struct PreloadedLevel {
+    struct SurfaceDeleter {
+        void operator()(SDL_Surface* surface) const;
+    };
+
+    /// @brief 已解码的图片（纹理需要在主线程由渲染器创建）
+    struct Image {
+        std::string path_;                                      ///< @brief 图片路径（与 LevelLoader 中纹理的路径一致）
+        std::unique_ptr<SDL_Surface, SurfaceDeleter> surface_;  ///< @brief 解码后的像素数据
+    };
+
+    std::string map_path_;                                  ///< @brief 地图路径
+    nlohmann::json map_json_;                               ///< @brief 地图数据（瓦片层的 data 已替换为 gid 缓冲区序号）
+    std::vector<std::vector<std::uint32_t>> gid_buffers_;   ///< @brief 各瓦片层的 gid 数据
+    std::map<int, nlohmann::json> tileset_data_;            ///< @brief firstgid -> 图块集数据（含 file_path 字段）
+    std::vector<Image> images_;                             ///< @brief 关卡引用的图片
+};
+
+/**
+ * @brief 关卡预加载器：在工作线程中读取、解析地图和图块集，并解码关卡用到的图片。
+ *
+ * 结果通过 std::shared_future 交给下一个场景，场景在其就绪前不会被切换进来（见 Scene::isReady()）。
+ * 工作线程不访问注册表和渲染器，纹理创建与实体生成仍由 LevelLoader 在主线程完成。
+ */
+class LevelPreloader final {
+public:
+    using Future = std::shared_future<std::shared_ptr<PreloadedLevel>>;
+
+private:
+    std::string map_path_;      ///< @brief 正在预加载的地图路径
+    Future future_;             ///< @brief 预加载结果（失败时结果为 nullptr）
+
+public:
+    LevelPreloader() = default;
+
+    /**
+     * @brief 在工作线程中开始预加载
+     * @param map_path 地图路径
+     * @param archive 资源包（可为空），包中存在的图片从映射内存解码
+     * @note 已经在预加载同一地图时不会重复开始；换成其它地图时会先等待上一次预加载结束（std::async 的 future 析构时会等待）
+     */
+    void preload(std::string_view map_path, const engine::resource::AssetArchive* archive);
+
+    const std::string& getMapPath() const { return map_path_; }
+    const Future& getFuture() const { return future_; }
+
+    /**
+     * @brief 读取并解析地图文件及其引用的图块集（不解码图片）
+     * @param map_path 地图路径
+     * @param level 输出：关卡数据
+     * @return 是否成功
+     */
+    static bool parse(std::string_view map_path, PreloadedLevel& level);
+
+    /**
+     * @brief 解码关卡引用的所有图片（图块集图片、多图片图块集的各瓦片图片、图片图层）
+     * @param level 已解析的关卡数据，结果写入 level.images_
+     * @param archive 资源包（可为空）
+     */
+    static void decodeImages(PreloadedLevel& level, const engine::resource::AssetArchive* archive);
+};
+
+} // namespace engine::loader
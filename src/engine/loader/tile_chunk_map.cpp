@@ -0,0 +1,69 @@
+#include "tile_chunk_map.h"
+#include <algorithm>
+#include <spdlog/spdlog.h>
+
+namespace engine::loader {
+
+TileChunkMap::TileChunkMap(glm::ivec2 map_size, glm::ivec2 tile_size, int chunk_size)
+    : map_size_(std::move(map_size)),
+      tile_size_(std::move(tile_size)),
+      chunk_size_(std::max(chunk_size, 1)) {
+}
+
+void TileChunkMap::addLayer(TileChunkLayer layer) {
+    if (layer.gids_.size() != static_cast<size_t>(map_size_.x) * static_cast<size_t>(map_size_.y)) {
+        spdlog::error("分块瓦片层 '{}' 的数据数量 {} 与地图尺寸 {}x{} 不符，跳过。", layer.name_, layer.gids_.size(), map_size_.x, map_size_.y);
+        return;
+    }
+    layers_.push_back(std::move(layer));
+}
+
+void TileChunkMap::addTileInfo(std::uint32_t gid, engine::component::TileInfo tile_info) {
+    palette_.emplace(gid, std::move(tile_info));
+}
+
+const engine::component::TileInfo* TileChunkMap::getTileInfo(std::uint32_t gid) const {
+    auto it = palette_.find(gid);
+    return it != palette_.end() ? &it->second : nullptr;
+}
+
+std::vector<TileInstance> TileChunkMap::collectChunk(size_t layer_index, glm::ivec2 chunk) const {
+    std::vector<TileInstance> result;
+    if (layer_index >= layers_.size()) return result;
+    const auto& gids = layers_[layer_index].gids_;
+
+    // 区块覆盖的瓦片范围（地图边缘的区块可能不完整）
+    const int begin_x = chunk.x * chunk_size_;
+    const int begin_y = chunk.y * chunk_size_;
+    const int end_x = std::min(begin_x + chunk_size_, map_size_.x);
+    const int end_y = std::min(begin_y + chunk_size_, map_size_.y);
+    if (begin_x < 0 || begin_y < 0 || begin_x >= end_x || begin_y >= end_y) return result;
+
+    result.reserve(static_cast<size_t>(end_x - begin_x) * static_cast<size_t>(end_y - begin_y));
+    for (int y = begin_y; y < end_y; ++y) {
+        for (int x = begin_x; x < end_x; ++x) {
+            const auto gid = gids[static_cast<size_t>(y) * map_size_.x + x];
+            if (gid == 0) continue;
+            result.push_back(TileInstance{glm::vec2(x * tile_size_.x, y * tile_size_.y), gid});
+        }
+    }
+    return result;
+}
+
+glm::ivec2 TileChunkMap::getChunkCount() const {
+    return (map_size_ + glm::ivec2(chunk_size_ - 1)) / chunk_size_;
+}
+
+glm::vec2 TileChunkMap::getChunkWorldSize() const {
+    return glm::vec2(tile_size_ * chunk_size_);
+}
+
+size_t TileChunkMap::getResidentBytes() const {
+    size_t bytes = 0;
+    for (const auto& layer : layers_) {
+        bytes += layer.gids_.capacity() * sizeof(std::uint32_t);
+    }
+    return bytes;
+}
+
+} // namespace engine::loader
@@ -0,0 +1,76 @@
+#pragma once
+#include "engine/component/tilelayer_component.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <glm/vec2.hpp>
+
+namespace engine::loader {
+
+/**
+ * @brief 区块中一个待实例化的瓦片（由后台线程准备，主线程据此创建实体）
+ */
+struct TileInstance {
+    glm::vec2 position_{0.0f};      ///< @brief 瓦片左上角的世界坐标
+    std::uint32_t gid_{0};          ///< @brief 瓦片全局ID（包含翻转标志位）
+};
+
+/**
+ * @brief 分块存储的瓦片层数据
+ */
+struct TileChunkLayer {
+    std::string name_;                  ///< @brief 图层名称
+    int render_layer_{0};               ///< @brief 渲染图层序号（用于RenderComponent）
+    std::vector<std::uint32_t> gids_;   ///< @brief 整张地图的gid（行优先，0表示空）
+};
+
+/**
+ * @brief 分块瓦片地图：以紧凑形式（每个瓦片4字节的gid）常驻整张地图，
+ * 只有相机附近的区块才会由 ChunkStreamSystem 实例化为实体。
+ *
+ * @note 载入完成后数据只读，因此 collectChunk 可以在后台线程中安全调用。
+ */
+class TileChunkMap final {
+private:
+    glm::ivec2 map_size_;                                               ///< @brief 地图尺寸(瓦片数量)
+    glm::ivec2 tile_size_;                                              ///< @brief 瓦片尺寸(像素)
+    int chunk_size_;                                                    ///< @brief 区块边长(瓦片数量)
+    std::vector<TileChunkLayer> layers_;                                ///< @brief 所有分块瓦片层
+    std::unordered_map<std::uint32_t, engine::component::TileInfo> palette_;   ///< @brief gid -> 瓦片信息（地图中用到的每种瓦片只保存一份）
+
+public:
+    static constexpr int DEFAULT_CHUNK_SIZE{16};                        ///< @brief 默认区块边长(瓦片数量)
+
+    /**
+     * @brief 构造函数
+     * @param map_size 地图尺寸(瓦片数量)
+     * @param tile_size 瓦片尺寸(像素)
+     * @param chunk_size 区块边长(瓦片数量)
+     */
+    TileChunkMap(glm::ivec2 map_size, glm::ivec2 tile_size, int chunk_size = DEFAULT_CHUNK_SIZE);
+
+    void addLayer(TileChunkLayer layer);                                            ///< @brief 添加一个分块瓦片层
+    void addTileInfo(std::uint32_t gid, engine::component::TileInfo tile_info);     ///< @brief 登记gid对应的瓦片信息
+    bool hasTileInfo(std::uint32_t gid) const { return palette_.contains(gid); }    ///< @brief 是否已登记gid
+    const engine::component::TileInfo* getTileInfo(std::uint32_t gid) const;        ///< @brief 获取gid对应的瓦片信息，不存在则返回nullptr
+
+    /**
+     * @brief 收集一个区块中所有非空瓦片（只读，线程安全）
+     * @param layer_index 图层序号
+     * @param chunk 区块坐标
+     * @return 区块中的瓦片列表
+     */
+    std::vector<TileInstance> collectChunk(size_t layer_index, glm::ivec2 chunk) const;
+
+    // --- getters ---
+    const glm::ivec2& getMapSize() const { return map_size_; }
+    const glm::ivec2& getTileSize() const { return tile_size_; }
+    int getChunkSize() const { return chunk_size_; }
+    glm::ivec2 getChunkCount() const;                                               ///< @brief 区块行列数
+    glm::vec2 getChunkWorldSize() const;                                            ///< @brief 区块的世界尺寸(像素)
+    const std::vector<TileChunkLayer>& getLayers() const { return layers_; }
+    size_t getResidentBytes() const;                                                ///< @brief 常驻的紧凑数据大小（字节，不含瓦片信息）
+};
+
+} // namespace engine::loader
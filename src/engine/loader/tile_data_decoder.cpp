@@ -0,0 +1,191 @@
+#include "tile_data_decoder.h"
+#include <array>
+#include <bit>
+#include <cstring>
+#include <spdlog/spdlog.h>
+#ifdef ENGINE_HAS_ZLIB
+#include <zlib.h>
+#endif
+#ifdef ENGINE_HAS_ZSTD
+#include <zstd.h>
+#endif
+
+namespace engine::loader {
+
+namespace {
+
+constexpr std::uint32_t BASE64_INVALID{0x01000000};      ///< @brief 查表结果中的非法字符标志（超出3字节输出范围的位）
+
+/// @brief 字符 -> 6位值，非法字符为 -1
+constexpr int base64Value(char c) {
+    if (c >= 'A' && c <= 'Z') return c - 'A';
+    if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+    if (c >= '0' && c <= '9') return c - '0' + 52;
+    if (c == '+') return 62;
+    if (c == '/') return 63;
+    return -1;
+}
+
+/**
+ * @brief 4个位置各一张查表：表中直接存放该字符对3个输出字节的贡献，
+ * 解码一组4字符只需4次查表和3次按位或，并且可以用一次比较检查整组是否含非法字符。
+ */
+struct Base64Tables {
+    std::array<std::array<std::uint32_t, 256>, 4> table_{};
+
+    constexpr Base64Tables() {
+        for (int i = 0; i < 256; ++i) {
+            const int v = base64Value(static_cast<char>(i));
+            if (v < 0) {
+                for (auto& t : table_) t[i] = BASE64_INVALID;
+                continue;
+            }
+            const auto u = static_cast<std::uint32_t>(v);
+            table_[0][i] = u << 2;                                              // 字节0 高6位
+            table_[1][i] = (u >> 4) | ((u & 0x0F) << 12);                       // 字节0 低2位 / 字节1 高4位
+            table_[2][i] = ((u >> 2) << 8) | ((u & 0x03) << 22);                // 字节1 低4位 / 字节2 高2位
+            table_[3][i] = u << 16;                                             // 字节2 低6位
+        }
+    }
+};
+
+constexpr Base64Tables BASE64_TABLES{};
+
+/// @brief 查表解码一组4个字符
+inline std::uint32_t decodeQuad(const unsigned char* in) {
+    const auto& t = BASE64_TABLES.table_;
+    return t[0][in[0]] | t[1][in[1]] | t[2][in[2]] | t[3][in[3]];
+}
+
+/// @brief 把字节缓冲区按小端序解释为 gid（大端平台需要交换字节序）
+void fixEndian(std::vector<std::uint32_t>& gids) {
+    if constexpr (std::endian::native == std::endian::big) {
+        for (auto& gid : gids) {
+            gid = ((gid & 0xFF) << 24) | ((gid & 0xFF00) << 8) | ((gid >> 8) & 0xFF00) | (gid >> 24);
+        }
+    }
+}
+
+#ifdef ENGINE_HAS_ZLIB
+/// @brief zlib / gzip 解压（windowBits + 32 自动识别两种头部）
+bool inflateInto(const std::uint8_t* src, size_t src_size, std::uint8_t* dst, size_t dst_size) {
+    z_stream stream{};
+    if (inflateInit2(&stream, MAX_WBITS + 32) != Z_OK) return false;
+    stream.next_in = const_cast<Bytef*>(src);
+    stream.avail_in = static_cast<uInt>(src_size);
+    stream.next_out = dst;
+    stream.avail_out = static_cast<uInt>(dst_size);
+    const int result = inflate(&stream, Z_FINISH);
+    const bool ok = result == Z_STREAM_END && stream.total_out == dst_size;
+    inflateEnd(&stream);
+    return ok;
+}
+#endif
+
+#ifdef ENGINE_HAS_ZSTD
+bool zstdInto(const std::uint8_t* src, size_t src_size, std::uint8_t* dst, size_t dst_size) {
+    const size_t result = ZSTD_decompress(dst, dst_size, src, src_size);
+    return !ZSTD_isError(result) && result == dst_size;
+}
+#endif
+
+} // namespace
+
+std::ptrdiff_t TileDataDecoder::decodeBase64(std::string_view data, std::uint8_t* out) {
+    // 去掉末尾填充
+    size_t length = data.size();
+    size_t padding = 0;
+    while (length > 0 && data[length - 1] == '=' && padding < 2) {
+        --length;
+        ++padding;
+    }
+    if ((length + padding) % 4 != 0 && padding > 0) return -1;
+    if (length % 4 == 1) return -1;
+
+    const auto* in = reinterpret_cast<const unsigned char*>(data.data());
+    std::uint8_t* dst = out;
+
+    // 主循环：每次4字符 -> 3字节
+    const size_t full = length / 4;
+    for (size_t i = 0; i < full; ++i, in += 4, dst += 3) {
+        const auto x = decodeQuad(in);
+        if (x & BASE64_INVALID) return -1;
+        dst[0] = static_cast<std::uint8_t>(x);
+        dst[1] = static_cast<std::uint8_t>(x >> 8);
+        dst[2] = static_cast<std::uint8_t>(x >> 16);
+    }
+
+    // 剩余的2或3个字符
+    const size_t rest = length % 4;
+    if (rest > 0) {
+        std::array<unsigned char, 4> tail{'A', 'A', 'A', 'A'};
+        std::memcpy(tail.data(), in, rest);
+        const auto x = decodeQuad(tail.data());
+        if (x & BASE64_INVALID) return -1;
+        dst[0] = static_cast<std::uint8_t>(x);
+        if (rest == 3) dst[1] = static_cast<std::uint8_t>(x >> 8);
+        dst += rest - 1;
+    }
+    return dst - out;
+}
+
+bool TileDataDecoder::decodeLayer(std::string_view data, std::string_view compression, size_t tile_count, std::vector<std::uint32_t>& gids) {
+    const size_t byte_count = tile_count * sizeof(std::uint32_t);
+    gids.resize(tile_count);
+    auto* gid_bytes = reinterpret_cast<std::uint8_t*>(gids.data());
+
+    // 未压缩：base64 直接解码到 gid 缓冲区（多留一个 gid 的余量给末尾的非完整组）
+    if (compression.empty()) {
+        gids.resize(tile_count + 1);
+        gid_bytes = reinterpret_cast<std::uint8_t*>(gids.data());
+        if (TileDataDecoder::getDecodedSize(data) > gids.size() * sizeof(std::uint32_t)) {
+            spdlog::error("瓦片层 base64 数据长度与图层大小 ({}) 不符", tile_count);
+            return false;
+        }
+        const auto written = decodeBase64(data, gid_bytes);
+        if (written < 0 || static_cast<size_t>(written) != byte_count) {
+            spdlog::error("瓦片层 base64 数据解码失败（得到 {} 字节，应为 {} 字节）", written, byte_count);
+            return false;
+        }
+        gids.resize(tile_count);
+        fixEndian(gids);
+        return true;
+    }
+
+    // 压缩：先解码出压缩数据，再直接解压到 gid 缓冲区
+    std::vector<std::uint8_t> packed(getDecodedSize(data));
+    const auto packed_size = decodeBase64(data, packed.data());
+    if (packed_size < 0) {
+        spdlog::error("瓦片层 base64 数据中有非法字符");
+        return false;
+    }
+
+    bool ok = false;
+    if (compression == "zlib" || compression == "gzip") {
+#ifdef ENGINE_HAS_ZLIB
+        ok = inflateInto(packed.data(), static_cast<size_t>(packed_size), gid_bytes, byte_count);
+#else
+        spdlog::error("未编译 zlib 支持，无法读取 {} 压缩的瓦片层", compression);
+        return false;
+#endif
+    } else if (compression == "zstd") {
+#ifdef ENGINE_HAS_ZSTD
+        ok = zstdInto(packed.data(), static_cast<size_t>(packed_size), gid_bytes, byte_count);
+#else
+        spdlog::error("未编译 zstd 支持，无法读取 zstd 压缩的瓦片层");
+        return false;
+#endif
+    } else {
+        spdlog::error("不支持的瓦片层压缩格式: {}", compression);
+        return false;
+    }
+
+    if (!ok) {
+        spdlog::error("瓦片层数据解压失败（压缩格式 {}，应为 {} 字节）", compression, byte_count);
+        return false;
+    }
+    fixEndian(gids);
+    return true;
+}
+
+} // namespace engine::loader
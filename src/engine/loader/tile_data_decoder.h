@@ -0,0 +1,45 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace engine::loader {
+
+/**
+ * @brief Tiled 瓦片层 data 的二进制编码解码器
+ *
+ * Tiled 可以把瓦片层的 data 保存为 base64 字符串（encoding: "base64"），
+ * 并可选 zlib / gzip / zstd 压缩（compression 字段），解码后是小端序的 uint32 gid 数组。
+ * 相比 json 整数数组，文件体积和解析开销都小得多。
+ *
+ * zlib/gzip 与 zstd 是可选依赖（编译时定义 ENGINE_HAS_ZLIB / ENGINE_HAS_ZSTD），
+ * 缺少对应库时遇到该压缩格式会报错并返回 false。
+ */
+class TileDataDecoder final {
+public:
+    TileDataDecoder() = delete;
+
+    /**
+     * @brief 解码 base64 编码（可能压缩）的瓦片层数据
+     * @param data base64 字符串
+     * @param compression 压缩格式："" / "zlib" / "gzip" / "zstd"
+     * @param tile_count 图层的瓦片数量（宽 * 高），解码结果必须恰好是这么多个 gid
+     * @param gids 输出：gid 列表（保留翻转标志位）
+     * @return 是否成功
+     */
+    static bool decodeLayer(std::string_view data, std::string_view compression, size_t tile_count, std::vector<std::uint32_t>& gids);
+
+    /**
+     * @brief 解码 base64 字符串
+     * @param data base64 字符串（允许末尾的 '=' 填充，不允许空白字符）
+     * @param out 输出缓冲区，至少要有 getDecodedSize(data) 字节
+     * @return 实际写入的字节数，输入非法时返回 -1
+     */
+    static std::ptrdiff_t decodeBase64(std::string_view data, std::uint8_t* out);
+
+    /// @brief base64 字符串解码后的最大字节数
+    static size_t getDecodedSize(std::string_view data) { return data.size() / 4 * 3 + 2; }
+};
+
+} // namespace engine::loader
@@ -0,0 +1,222 @@
+#include "tiled_json_reader.h"
+#include <array>
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+
+namespace engine::loader {
+
+namespace {
+
+/// @brief 图块集根对象中用到的字段
+constexpr std::array<std::string_view, 7> TILESET_KEYS{
+    "image", "imagewidth", "imageheight", "columns", "tilewidth", "tileheight", "tiles"
+};
+
+/// @brief 图块集 tiles 数组中每个瓦片用到的字段
+constexpr std::array<std::string_view, 11> TILESET_TILE_KEYS{
+    "id", "image", "imagewidth", "imageheight", "x", "y", "width", "height", "properties", "animation", "objectgroup"
+};
+
+template<size_t N>
+bool containsKey(const std::array<std::string_view, N>& keys, std::string_view key) {
+    return std::find(keys.begin(), keys.end(), key) != keys.end();
+}
+
+/**
+ * @brief SAX 处理器：逐个事件构建 json，同时支持
+ * 1. 按深度过滤字段（被过滤的字段整棵子树都会跳过，不分配内存）；
+ * 2. 把图层对象中的 data 数组直接解码到 gid 缓冲区。
+ */
+class SaxBuilder {
+public:
+    using json = nlohmann::json;
+    using KeyFilter = bool (*)(size_t depth, std::string_view key);     ///< @brief 返回 false 表示跳过该字段
+
+private:
+    json& root_;
+    std::vector<json*> stack_;                              ///< @brief 正在构建的对象/数组
+    std::string key_;                                       ///< @brief 当前对象中待赋值的字段名
+    KeyFilter filter_{nullptr};
+
+    std::vector<std::vector<std::uint32_t>>* gid_buffers_{nullptr};
+    std::vector<std::uint32_t>* gids_{nullptr};             ///< @brief 正在解码的 gid 缓冲区（为空表示不在 data 数组中）
+    bool data_pending_{false};                              ///< @brief 下一个值是图层的 data 字段
+
+    bool skip_next_{false};                                 ///< @brief 下一个值需要跳过
+    size_t skip_depth_{0};                                  ///< @brief 正在跳过的子树深度
+
+public:
+    std::string error_;
+
+    SaxBuilder(json& root, KeyFilter filter, std::vector<std::vector<std::uint32_t>>* gid_buffers)
+        : root_(root), filter_(filter), gid_buffers_(gid_buffers) {}
+
+    // --- 标量 ---
+    bool null() { return addValue(nullptr); }
+    bool boolean(bool val) { return addValue(val); }
+    bool number_integer(json::number_integer_t val) {
+        if (gids_) { gids_->push_back(static_cast<std::uint32_t>(val)); return true; }
+        return addValue(val);
+    }
+    bool number_unsigned(json::number_unsigned_t val) {
+        if (gids_) { gids_->push_back(static_cast<std::uint32_t>(val)); return true; }
+        return addValue(val);
+    }
+    bool number_float(json::number_float_t val, const json::string_t&) {
+        if (gids_) return fail("瓦片层 data 数组中出现了非整数");
+        return addValue(val);
+    }
+    bool string(json::string_t& val) {
+        if (gids_) return fail("瓦片层 data 数组中出现了字符串");
+        return addValue(std::move(val));
+    }
+    bool binary(json::binary_t& val) {
+        if (gids_) return fail("瓦片层 data 数组中出现了二进制数据");
+        return addValue(std::move(val));
+    }
+
+    // --- 容器 ---
+    bool start_object(std::size_t) {
+        if (gids_) return fail("瓦片层 data 数组中出现了对象");
+        if (beginSkip()) return true;
+        return push(json::object());
+    }
+    bool end_object() {
+        if (endSkip()) return true;
+        stack_.pop_back();
+        return true;
+    }
+    bool start_array(std::size_t size) {
+        if (gids_) return fail("瓦片层 data 数组中出现了嵌套数组");
+        if (beginSkip()) return true;
+        if (data_pending_) {
+            // 图层的 data 数组：解码到 gid 缓冲区，json 中只记录缓冲区序号
+            data_pending_ = false;
+            (*stack_.back())[std::string(TiledJsonReader::GID_BUFFER_KEY)] = gid_buffers_->size();
+            gids_ = &gid_buffers_->emplace_back();
+            if (size != static_cast<std::size_t>(-1)) gids_->reserve(size);
+            return true;
+        }
+        return push(json::array());
+    }
+    bool end_array() {
+        if (gids_) { gids_ = nullptr; return true; }
+        if (endSkip()) return true;
+        stack_.pop_back();
+        return true;
+    }
+
+    bool key(json::string_t& val) {
+        if (skip_depth_ > 0) return true;
+        // stack_ 深度: 1 = 根对象, 3 = 根对象中数组里的对象（如 layers[i]、tiles[i]）
+        const auto depth = stack_.size();
+        if (filter_ && !filter_(depth, val)) {
+            skip_next_ = true;
+            return true;
+        }
+        data_pending_ = gid_buffers_ && depth == 3 && val == "data";
+        key_ = std::move(val);
+        return true;
+    }
+
+    bool parse_error(std::size_t position, const std::string&, const nlohmann::detail::exception& ex) {
+        return fail(std::string(ex.what()) + " (at byte " + std::to_string(position) + ")");
+    }
+
+private:
+    bool fail(std::string message) {
+        error_ = std::move(message);
+        return false;
+    }
+
+    /// @brief 容器开始时判断是否需要跳过
+    bool beginSkip() {
+        if (skip_depth_ > 0) { ++skip_depth_; return true; }
+        if (skip_next_) { skip_next_ = false; skip_depth_ = 1; return true; }
+        return false;
+    }
+
+    /// @brief 容器结束时判断是否处于跳过状态
+    bool endSkip() {
+        if (skip_depth_ == 0) return false;
+        --skip_depth_;
+        return true;
+    }
+
+    /// @brief 把值放到当前位置，返回其指针
+    json* place(json&& value) {
+        data_pending_ = false;
+        if (stack_.empty()) {
+            root_ = std::move(value);
+            return &root_;
+        }
+        auto& parent = *stack_.back();
+        if (parent.is_array()) {
+            parent.push_back(std::move(value));
+            return &parent.back();
+        }
+        auto& slot = parent[key_];
+        slot = std::move(value);
+        return &slot;
+    }
+
+    bool addValue(json&& value) {
+        if (skip_depth_ > 0) return true;
+        if (skip_next_) { skip_next_ = false; return true; }
+        place(std::move(value));
+        return true;
+    }
+
+    bool push(json&& container) {
+        stack_.push_back(place(std::move(container)));
+        return true;
+    }
+};
+
+/// @brief 图块集字段过滤器
+bool tilesetFilter(size_t depth, std::string_view key) {
+    if (depth == 1) return containsKey(TILESET_KEYS, key);
+    if (depth == 3) return containsKey(TILESET_TILE_KEYS, key);     // 根对象中唯一保留的对象数组是 tiles
+    return true;
+}
+
+/// @brief 一次性读取整个文件（比逐字符读取流快得多）
+bool readFile(std::string_view file_path, std::string& text) {
+    std::ifstream file(std::string(file_path), std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        spdlog::error("无法打开文件: {}", file_path);
+        return false;
+    }
+    const auto size = static_cast<size_t>(file.tellg());
+    text.resize(size);
+    file.seekg(0);
+    file.read(text.data(), static_cast<std::streamsize>(size));
+    return static_cast<bool>(file);
+}
+
+bool parse(std::string_view file_path, SaxBuilder& builder) {
+    std::string text;
+    if (!readFile(file_path, text)) return false;
+    if (!nlohmann::json::sax_parse(text, &builder)) {
+        spdlog::error("解析 JSON 文件 '{}' 失败: {}", file_path, builder.error_);
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+bool TiledJsonReader::readMap(std::string_view file_path, nlohmann::json& map_json, std::vector<std::vector<std::uint32_t>>& gid_buffers) {
+    SaxBuilder builder(map_json, nullptr, &gid_buffers);
+    return parse(file_path, builder);
+}
+
+bool TiledJsonReader::readTileset(std::string_view file_path, nlohmann::json& tileset_json) {
+    SaxBuilder builder(tileset_json, &tilesetFilter, nullptr);
+    return parse(file_path, builder);
+}
+
+} // namespace engine::loader
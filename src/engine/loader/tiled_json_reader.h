@@ -0,0 +1,42 @@
+#pragma once
+#include <cstdint>
+#include <string_view>
+#include <vector>
+#include <nlohmann/json_fwd.hpp>
+
+namespace engine::loader {
+
+/**
+ * @brief Tiled JSON 文件的流式(SAX)读取器
+ *
+ * 与直接 `file >> json` 构建完整 DOM 相比：
+ * 1. 地图(.tmj)中瓦片层的 data 数组不再生成成千上万个 json 节点，而是直接解码到 gid 缓冲区，
+ *    图层 json 中只留下 GID_BUFFER_KEY 字段记录缓冲区序号；
+ * 2. 图块集(.tsj)只保留 LevelLoader 用到的字段（图片与尺寸、tiles 中的属性、动画、碰撞形状等），
+ *    其它字段（如 wangsets）在解析时直接跳过。
+ */
+class TiledJsonReader final {
+public:
+    static constexpr std::string_view GID_BUFFER_KEY{"gid_buffer"};     ///< @brief 图层 json 中记录 gid 缓冲区序号的字段
+
+    TiledJsonReader() = delete;
+
+    /**
+     * @brief 读取地图文件
+     * @param file_path 地图文件路径（.tmj）
+     * @param map_json 输出：地图 json（瓦片层的 data 数组被替换为 GID_BUFFER_KEY 字段）
+     * @param gid_buffers 输出：各瓦片层的 gid 缓冲区（追加到末尾）
+     * @return 是否成功
+     */
+    static bool readMap(std::string_view file_path, nlohmann::json& map_json, std::vector<std::vector<std::uint32_t>>& gid_buffers);
+
+    /**
+     * @brief 读取图块集文件
+     * @param file_path 图块集文件路径（.tsj）
+     * @param tileset_json 输出：只包含用到字段的图块集 json
+     * @return 是否成功
+     */
+    static bool readTileset(std::string_view file_path, nlohmann::json& tileset_json);
+};
+
+} // namespace engine::loader
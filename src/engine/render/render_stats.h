@@ -0,0 +1,25 @@
+#pragma once
+#include <cstddef>
+
+namespace engine::render {
+
+/**
+ * @brief 一帧内向 SDL 提交的绘制统计（由 Renderer 在绘制时累计，每帧重置）
+ *
+ * 用于衡量合批、图集等优化的效果。计数的是实际调用的 SDL 函数次数，
+ * 文本的顶点数由 SDL_ttf 内部决定，无法获得，不计入 vertices_。
+ */
+struct RenderStats {
+    size_t draw_calls_{0};              ///< @brief 绘制调用次数（纹理、矩形、矩形边框、文本、清屏）
+    size_t texture_draws_{0};           ///< @brief 纹理绘制次数（每次都要绑定纹理）
+    size_t texture_switches_{0};        ///< @brief 与上一次纹理绘制使用的纹理不同的次数
+    size_t color_mod_changes_{0};       ///< @brief 实际改变纹理颜色调整的次数（与该纹理当前的值相同时跳过，不计入）
+    size_t alpha_mod_changes_{0};       ///< @brief 实际改变纹理透明度调整的次数
+    size_t draw_color_changes_{0};      ///< @brief 实际改变绘制颜色的次数
+    size_t text_draws_{0};              ///< @brief 文本绘制次数
+    size_t world_draws_{0};             ///< @brief 通过视口裁剪的世界空间绘制（精灵、圆形、矩形）
+    size_t world_culled_{0};            ///< @brief 被视口裁剪掉的世界空间绘制
+    size_t vertices_{0};                ///< @brief 提交的顶点数（四边形和每圈矩形边框按4个计算，不含文本与调试UI）
+};
+
+} // namespace engine::render
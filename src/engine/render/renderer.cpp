@@ -3,6 +3,8 @@
 #include "camera.h"
 #include "image.h"
 #include <SDL3/SDL.h>
+#include <SDL3_ttf/SDL_ttf.h>
+#include <algorithm>
 #include <stdexcept> // For std::runtime_error
 #include <spdlog/spdlog.h>
 #include <entt/core/hashed_string.hpp>
@@ -29,12 +31,6 @@ Renderer::Renderer(SDL_Renderer* sdl_renderer, engine::resource::ResourceManager
 
 void Renderer::drawSprite(const Camera& camera, const component::Sprite& sprite, const glm::vec2& position, 
     const glm::vec2& size, const float rotation, const engine::utils::FColor& color) {
-    auto texture = resource_manager_->getTexture(sprite.texture_id_, sprite.texture_path_);
-    if (!texture) {
-        spdlog::error("无法为 ID {} 获取纹理。", sprite.texture_id_);
-        return;
-    }
-
     // 应用相机变换
     glm::vec2 screen_position = camera.worldToScreen(position);
 
@@ -45,9 +41,17 @@ void Renderer::drawSprite(const Camera& camera, const component::Sprite& sprite,
         size.x,
         size.y
     };
+    applyCursorOffset(dest_rect);
 
-    if (!isRectInViewport(camera, dest_rect)) { // 视口裁剪：如果精灵超出视口，则不绘制
-        // spdlog::info("精灵超出视口范围，ID: {}", sprite.getTextureId());
+    if (!isRectInViewport(camera, dest_rect)) { // 视口裁剪：如果精灵超出视口，则不绘制（放在获取纹理之前，避免无谓的查找）
+        ++frame_stats_.world_culled_;
+        return;
+    }
+    ++frame_stats_.world_draws_;
+
+    auto texture = resource_manager_->getTexture(sprite.texture_id_, sprite.texture_path_);
+    if (!texture) {
+        spdlog::error("无法为 ID {} 获取纹理。", sprite.texture_id_);
         return;
     }
 
@@ -58,32 +62,27 @@ void Renderer::drawSprite(const Camera& camera, const component::Sprite& sprite,
         sprite.src_rect_.size.y
     };
 
-    // 设置调整颜色与透明度
-    SDL_SetTextureColorModFloat(texture, color.r, color.g, color.b);
-    SDL_SetTextureAlphaModFloat(texture, color.a);
-
     // 执行绘制(默认旋转中心为精灵的中心点)
-    if (!SDL_RenderTextureRotated(renderer_, texture, &src_rect, &dest_rect, rotation, NULL, sprite.is_flipped_ ? SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE)) {
-        spdlog::error("渲染旋转纹理失败（ID: {}）：{}", sprite.texture_id_, SDL_GetError());
-    }   
+    renderTexture(texture, &src_rect, dest_rect, rotation, sprite.is_flipped_, color);
 }
 
 void Renderer::drawFilledCircle(const Camera& camera, const glm::vec2& position, const float radius, const engine::utils::FColor& color) {
+    auto screen_position = camera.worldToScreen(position);
+    SDL_FRect dest_rect = {screen_position.x - radius, screen_position.y - radius, radius * 2, radius * 2};
+    applyCursorOffset(dest_rect);
+    if (!isRectInViewport(camera, dest_rect)) {     // 视口裁剪（圆形的外接矩形）
+        ++frame_stats_.world_culled_;
+        return;
+    }
+    ++frame_stats_.world_draws_;
     // 获取引擎自带的圆形纹理
     auto circle_texture = resource_manager_->getTexture("assets/textures/UI/circle.png"_hs);
     if (!circle_texture) {
         spdlog::error("无法获取引擎自带的圆形纹理。");
         return;
     }
-    auto screen_position = camera.worldToScreen(position);
-    // 设置颜色和透明度
-    SDL_SetTextureColorModFloat(circle_texture, color.r, color.g, color.b);
-    SDL_SetTextureAlphaModFloat(circle_texture, color.a);
-    // 绘制
-    SDL_FRect dest_rect = {screen_position.x - radius, screen_position.y - radius, radius * 2, radius * 2};
-    if (!SDL_RenderTextureRotated(renderer_, circle_texture, nullptr, &dest_rect, 0.0, nullptr, SDL_FLIP_NONE)) {
-        spdlog::error("绘制填充圆形失败：{}", SDL_GetError());
-    }
+    // 绘制圆形纹理（颜色和透明度通过纹理的颜色调整设置）
+    renderTexture(circle_texture, nullptr, dest_rect, 0.0f, false, color);
 }
 
 void Renderer::drawFilledRect(const Camera& camera, const glm::vec2& position, const glm::vec2& size, const engine::utils::FColor& color) {
@@ -91,13 +90,19 @@ void Renderer::drawFilledRect(const Camera& camera, const glm::vec2& position, c
     auto screen_position = camera.worldToScreen(position);
     // 创建目标矩形
     SDL_FRect dest_rect = {screen_position.x, screen_position.y, size.x, size.y};
+    applyCursorOffset(dest_rect);
+    if (!isRectInViewport(camera, dest_rect)) {     // 视口裁剪
+        ++frame_stats_.world_culled_;
+        return;
+    }
+    ++frame_stats_.world_draws_;
     // 设置颜色并绘制
     setDrawColorFloat(color.r, color.g, color.b, color.a);
+    ++frame_stats_.draw_calls_;
+    frame_stats_.vertices_ += 4;
     if (!SDL_RenderFillRect(renderer_, &dest_rect)) {
         spdlog::error("绘制填充矩形失败：{}", SDL_GetError());
     }
-    // 恢复默认颜色
-    setDrawColorFloat(0, 0, 0, 1.0f);
 }
 
 void Renderer::drawRect(const Camera& camera, const glm::vec2& position, const glm::vec2& size, const engine::utils::FColor& color, const int thickness) {
@@ -105,9 +110,17 @@ void Renderer::drawRect(const Camera& camera, const glm::vec2& position, const g
     auto screen_position = camera.worldToScreen(position);
     // 创建目标矩形
     SDL_FRect dest_rect = {screen_position.x, screen_position.y, size.x, size.y};
+    applyCursorOffset(dest_rect);
+    if (!isRectInViewport(camera, dest_rect)) {     // 视口裁剪
+        ++frame_stats_.world_culled_;
+        return;
+    }
+    ++frame_stats_.world_draws_;
     // 设置颜色并绘制
     setDrawColorFloat(color.r, color.g, color.b, color.a);
     for (int i = 0; i < thickness; i++) {
+        ++frame_stats_.draw_calls_;
+        frame_stats_.vertices_ += 4;
         if (!SDL_RenderRect(renderer_, &dest_rect)) {
             spdlog::error("绘制矩形边框失败：{}", SDL_GetError());
         }
@@ -116,8 +129,6 @@ void Renderer::drawRect(const Camera& camera, const glm::vec2& position, const g
         dest_rect.w -= 2;
         dest_rect.h -= 2;
     }
-    // 恢复默认颜色
-    setDrawColorFloat(0, 0, 0, 1.0f);
 }
 
 void Renderer::drawUIImage(const Image& image, const glm::vec2& position, const std::optional<glm::vec2>& size) {
@@ -142,27 +153,92 @@ void Renderer::drawUIImage(const Image& image, const glm::vec2& position, const
         dest_rect.h = src_rect.value().h;
     }
 
-    // 执行绘制(未考虑UI旋转)
-    if (!SDL_RenderTextureRotated(renderer_, texture, &src_rect.value(), &dest_rect, 0.0, nullptr, image.isFlipped() ? SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE)) {
-        spdlog::error("渲染 UI Sprite 失败 (ID: {}): {}", image.getTextureId(), SDL_GetError());
+    // 执行绘制(未考虑UI旋转；纹理可能与世界中的精灵共享，颜色调整恢复为白色)
+    renderTexture(texture, &src_rect.value(), dest_rect, 0.0f, image.isFlipped(), engine::utils::FColor::white());
+}
+
+void Renderer::drawTTFText(TTF_Text* text, const glm::vec2& position, const engine::utils::FColor& color) {
+    ++frame_stats_.text_draws_;
+    ++frame_stats_.draw_calls_;
+    last_texture_ = nullptr;        // 文本使用字形图集纹理
+    TTF_SetTextColorFloat(text, color.r, color.g, color.b, color.a);
+    if (!TTF_DrawRendererText(text, position.x, position.y)) {
+        spdlog::error("绘制 TTF_Text 失败：{}", SDL_GetError());
     }
 }
 
-void Renderer::setDrawColor(Uint8 r, Uint8 g, Uint8 b, Uint8 a) {
-    if (!SDL_SetRenderDrawColor(renderer_, r, g, b, a)) {
-        spdlog::error("设置渲染绘制颜色失败：{}", SDL_GetError());
+void Renderer::renderTexture(SDL_Texture* texture, const SDL_FRect* src_rect, const SDL_FRect& dest_rect,
+                             float rotation, bool is_flipped, const engine::utils::FColor& color) {
+    if (texture != last_texture_) {
+        ++frame_stats_.texture_switches_;
+        last_texture_ = texture;
+    }
+    ++frame_stats_.texture_draws_;
+    ++frame_stats_.draw_calls_;
+    frame_stats_.vertices_ += 4;
+    // 纹理是共享的，颜色调整与该纹理当前的值不同时才需要设置
+    setTextureColor(texture, color);
+    if (!SDL_RenderTextureRotated(renderer_, texture, src_rect, &dest_rect, rotation, nullptr,
+                                  is_flipped ? SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE)) {
+        spdlog::error("渲染纹理失败：{}", SDL_GetError());
     }
 }
 
+void Renderer::applyCursorOffset(SDL_FRect& rect) const {
+    if (!follow_cursor_) return;
+    rect.x += cursor_offset_.x;
+    rect.y += cursor_offset_.y;
+}
+
+void Renderer::setDrawColor(Uint8 r, Uint8 g, Uint8 b, Uint8 a) {
+    setDrawColorFloat(r / 255.0f, g / 255.0f, b / 255.0f, a / 255.0f);
+}
+
 void Renderer::setDrawColorFloat(float r, float g, float b, float a)
 {
+    // 绘制颜色是渲染器上的状态，与当前值相同时跳过
+    if (draw_color_ && draw_color_->r == r && draw_color_->g == g && draw_color_->b == b && draw_color_->a == a) return;
+    ++frame_stats_.draw_color_changes_;
     if (!SDL_SetRenderDrawColorFloat(renderer_, r, g, b, a)) {
         spdlog::error("设置渲染绘制颜色失败：{}", SDL_GetError());
+        draw_color_.reset();
+        return;
     }
+    draw_color_ = engine::utils::FColor{r, g, b, a};
+}
+
+void Renderer::setTextureColor(SDL_Texture* texture, const engine::utils::FColor& color)
+{
+    // 颜色调整是纹理上的状态，同一纹理连续绘制时通常不变：先检查上一次使用的纹理，再在本帧用过的纹理中查找
+    if (texture_color_index_ >= texture_colors_.size() || texture_colors_[texture_color_index_].texture_ != texture) {
+        const auto it = std::find_if(texture_colors_.begin(), texture_colors_.end(),
+                                     [texture](const TextureColorState& state) { return state.texture_ == texture; });
+        texture_color_index_ = static_cast<size_t>(it - texture_colors_.begin());
+        if (it == texture_colors_.end()) {
+            // 本帧第一次使用：纹理当前的调整值未知（纹理可能已被逐出并在同一地址重新创建），必须设置
+            texture_colors_.push_back(TextureColorState{texture, color});
+            SDL_SetTextureColorModFloat(texture, color.r, color.g, color.b);
+            SDL_SetTextureAlphaModFloat(texture, color.a);
+            ++frame_stats_.color_mod_changes_;
+            ++frame_stats_.alpha_mod_changes_;
+            return;
+        }
+    }
+    auto& state = texture_colors_[texture_color_index_];
+    if (state.color_.r != color.r || state.color_.g != color.g || state.color_.b != color.b) {
+        SDL_SetTextureColorModFloat(texture, color.r, color.g, color.b);
+        ++frame_stats_.color_mod_changes_;
+    }
+    if (state.color_.a != color.a) {
+        SDL_SetTextureAlphaModFloat(texture, color.a);
+        ++frame_stats_.alpha_mod_changes_;
+    }
+    state.color_ = color;
 }
 
 void Renderer::clearScreen() {
     setDrawColorFloat(background_color_.r, background_color_.g, background_color_.b, background_color_.a);
+    ++frame_stats_.draw_calls_;
     if (!SDL_RenderClear(renderer_)) {
         spdlog::error("清除渲染器失败：{}", SDL_GetError());
     }
@@ -172,15 +248,31 @@ void Renderer::drawUIFilledRect(const engine::utils::Rect &rect, const engine::u
 {
     setDrawColorFloat(color.r, color.g, color.b, color.a);
     SDL_FRect sdl_rect = {rect.position.x, rect.position.y, rect.size.x, rect.size.y};
+    ++frame_stats_.draw_calls_;
+    frame_stats_.vertices_ += 4;
     if (!SDL_RenderFillRect(renderer_, &sdl_rect)) {
         spdlog::error("绘制填充矩形失败：{}", SDL_GetError());
     }
-    setDrawColorFloat(0, 0, 0, 1.0f);
 }
 
 void Renderer::present()
 {
     SDL_RenderPresent(renderer_);
+    cursor_offset_ = {0.0f, 0.0f};
+    // 颜色状态的记录只在一帧内有效（纹理可能在帧之间被逐出并在同一地址重新创建）
+    invalidateStateCache();
+
+    // 统计按帧重置
+    last_frame_stats_ = frame_stats_;
+    frame_stats_ = RenderStats{};
+}
+
+void Renderer::invalidateStateCache()
+{
+    texture_colors_.clear();    // 保留容量，稳定运行后不再分配内存
+    texture_color_index_ = 0;
+    draw_color_.reset();
+    last_texture_ = nullptr;
 }
 
 std::optional<SDL_FRect> Renderer::getImageSrcRect(const Image &image)
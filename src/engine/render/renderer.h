@@ -1,11 +1,15 @@
 #pragma once
 #include "image.h"
+#include "render_stats.h"
 #include "engine/component/sprite_component.h"
 #include "engine/utils/math.h"
 #include <optional>
+#include <vector>
 
 struct SDL_Renderer;
+struct SDL_Texture;
 struct SDL_FRect;
+struct TTF_Text;
 
 namespace engine::resource {
     class ResourceManager;
@@ -20,6 +24,8 @@ class Camera;
  * 包装 SDL_Renderer 并提供清除屏幕、绘制精灵和呈现最终图像的方法。
  * 在构造时初始化。依赖于一个有效的 SDL_Renderer 和 ResourceManager。
  * 构造失败会抛出异常。
+ *
+ * 各 draw 方法直接调用 SDL 绘制，并跳过与当前值相同的颜色状态设置（纹理颜色调整、绘制颜色）。
  */
 class Renderer final{
 private:
@@ -27,6 +33,22 @@ private:
     engine::resource::ResourceManager* resource_manager_ = nullptr; ///< @brief 指向 ResourceManager 的非拥有指针
 
     engine::utils::FColor background_color_{0.0f, 0.0f, 0.0f, 1.0f};///< @brief 清除屏幕的颜色（默认黑色），可调用setBgColorFloat设置
+
+    bool follow_cursor_ = false;                                    ///< @brief 之后的世界空间绘制是否跟随鼠标
+    glm::vec2 cursor_offset_{0.0f};                                 ///< @brief 跟随鼠标的绘制要加上的偏移（逻辑坐标）
+
+    /// @brief 本帧某个纹理最后设置的颜色调整
+    struct TextureColorState {
+        SDL_Texture* texture_ = nullptr;
+        engine::utils::FColor color_{};
+    };
+    std::vector<TextureColorState> texture_colors_;                 ///< @brief 本帧用过的纹理及其颜色调整（present() 时清空，保留容量）
+    size_t texture_color_index_ = 0;                                ///< @brief 上一次使用的纹理在 texture_colors_ 中的位置
+    std::optional<engine::utils::FColor> draw_color_;               ///< @brief 当前的绘制颜色（空值表示未知，下一次设置不能跳过）
+    SDL_Texture* last_texture_ = nullptr;                           ///< @brief 上一次纹理绘制使用的纹理（用于统计纹理切换）
+
+    RenderStats frame_stats_;                                       ///< @brief 本帧正在累计的统计
+    RenderStats last_frame_stats_;                                  ///< @brief 上一帧的统计
     
 public:
     /**
@@ -97,15 +119,38 @@ public:
      */
     void drawUIFilledRect(const engine::utils::Rect& rect, const engine::utils::FColor& color);
 
-    void present();                                                     ///< @brief 更新屏幕，包装 SDL_RenderPresent 函数
+    /**
+     * @brief 绘制 TTF_Text 对象（由 TextRenderer 调用）
+     *
+     * @param text TTF_Text 对象
+     * @param position 屏幕坐标中的左上角位置
+     * @param color 文本颜色
+     */
+    void drawTTFText(TTF_Text* text, const glm::vec2& position, const engine::utils::FColor& color);
+
+    void present();                                                     ///< @brief 更新屏幕，包装 SDL_RenderPresent 函数，并结算本帧的绘制统计
     void clearScreen();                                                 ///< @brief 清屏，包装 SDL_RenderClear 函数
 
-    void setDrawColor(Uint8 r, Uint8 g, Uint8 b, Uint8 a = 255);        ///< @brief 设置绘制颜色，包装 SDL_SetRenderDrawColor 函数，使用 Uint8 类型
-    void setDrawColorFloat(float r, float g, float b, float a = 1.0f);  ///< @brief 设置绘制颜色，包装 SDL_SetRenderDrawColorFloat 函数，使用 float 类型
+    /**
+     * @brief 绕过 Renderer 直接使用 SDL_Renderer 绘制之后调用（例如 ImGui），使缓存的颜色状态失效
+     */
+    void invalidateStateCache();
 
+    /**
+     * @brief 设置之后的世界空间绘制（精灵、圆形、矩形）是否跟随鼠标
+     * @note 跟随鼠标的绘制会加上 setCursorOffset() 设置的偏移，用完后应恢复为 false
+     */
+    void setFollowCursor(bool follow_cursor) { follow_cursor_ = follow_cursor; }
+
+    /**
+     * @brief 设置本帧跟随鼠标的绘制的偏移（延迟锁存）
+     * @param offset 场景渲染前重新采样的鼠标位置与更新时所用鼠标位置之差（逻辑坐标），present() 后清零
+     */
+    void setCursorOffset(const glm::vec2& offset) { cursor_offset_ = offset; }
     void setBgColorFloat(float r, float g, float b, float a = 1.0f) { background_color_ = {r, g, b, a}; }    ///< @brief 设置背景颜色，使用 float 类型
 
     SDL_Renderer* getSDLRenderer() const { return renderer_; }          ///< @brief 获取底层的 SDL_Renderer 指针
+    const RenderStats& getLastFrameStats() const { return last_frame_stats_; }  ///< @brief 获取上一帧的绘制统计
 
     // 禁用拷贝和移动语义
     Renderer(const Renderer&) = delete;
@@ -117,6 +162,14 @@ private:
     std::optional<SDL_FRect> getImageSrcRect(const Image& image);       ///< @brief 获取Image的源矩形，用于具体绘制。出现错误则返回std::nullopt并跳过绘制
     bool isRectInViewport(const Camera& camera, const SDL_FRect& rect);  ///< @brief 判断矩形是否在视口中，用于视口裁剪
 
+    void applyCursorOffset(SDL_FRect& rect) const;                      ///< @brief 跟随鼠标时给目标矩形加上延迟锁存的偏移
+    /// @brief 绘制纹理（统计纹理切换并按需设置颜色调整），src_rect 为空时绘制整个纹理
+    void renderTexture(SDL_Texture* texture, const SDL_FRect* src_rect, const SDL_FRect& dest_rect,
+                       float rotation, bool is_flipped, const engine::utils::FColor& color);
+    void setTextureColor(SDL_Texture* texture, const engine::utils::FColor& color);  ///< @brief 设置纹理的颜色与透明度调整（与当前值相同时跳过）
+    void setDrawColor(Uint8 r, Uint8 g, Uint8 b, Uint8 a = 255);        ///< @brief 设置绘制颜色，包装 SDL_SetRenderDrawColor 函数，使用 Uint8 类型
+    void setDrawColorFloat(float r, float g, float b, float a = 1.0f);  ///< @brief 设置绘制颜色，包装 SDL_SetRenderDrawColorFloat 函数，使用 float 类型
+
 };
 
 } // namespace engine::render
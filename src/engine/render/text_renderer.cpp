@@ -1,25 +1,33 @@
 #include "text_renderer.h"
 #include "camera.h"
+#include "renderer.h"
 #include "engine/resource/resource_manager.h"
 #include <SDL3_ttf/SDL_ttf.h>
 #include <spdlog/spdlog.h>
+#include <filesystem>
 #include <stdexcept>
 
 namespace engine::render {
 
-TextRenderer::TextRenderer(SDL_Renderer* sdl_renderer, engine::resource::ResourceManager* resource_manager)
-    : sdl_renderer_(sdl_renderer),
+namespace {
+    /// @brief 预热字形图集时渲染的字符（可打印 ASCII 字符）
+    constexpr std::string_view PREWARM_CHARSET =
+        " !\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_`abcdefghijklmnopqrstuvwxyz{|}~";
+}
+
+TextRenderer::TextRenderer(Renderer* renderer, engine::resource::ResourceManager* resource_manager)
+    : renderer_(renderer),
       resource_manager_(resource_manager)
 {
-    if (!sdl_renderer_ || !resource_manager_) {
-        throw std::runtime_error("TextRenderer 需要一个有效的 SDL_Renderer 和 ResourceManager。");
+    if (!renderer_ || !resource_manager_) {
+        throw std::runtime_error("TextRenderer 需要一个有效的 Renderer 和 ResourceManager。");
     }
     // 初始化 SDL_ttf
     if (!TTF_WasInit() && TTF_Init() == false) {
          throw std::runtime_error("初始化 SDL_ttf 失败: " + std::string(SDL_GetError()));
     }
 
-    text_engine_ = TTF_CreateRendererTextEngine(sdl_renderer_);
+    text_engine_ = TTF_CreateRendererTextEngine(renderer_->getSDLRenderer());
     if (!text_engine_) {
         spdlog::error("创建 TTF_TextEngine 失败: {}", SDL_GetError());
         throw std::runtime_error("创建 TTF_TextEngine 失败。");
@@ -35,6 +43,7 @@ TextRenderer::~TextRenderer() {
 
 void TextRenderer::close()
 {
+    clearCache();
     if (text_engine_) {
         TTF_DestroyRendererTextEngine(text_engine_);
         text_engine_ = nullptr;
@@ -43,37 +52,120 @@ void TextRenderer::close()
     TTF_Quit();     // 一定要确保在ResourceManager销毁之后调用
 }
 
-void TextRenderer::drawUIText(std::string_view text, entt::id_type font_id, int font_size,
-                              const glm::vec2 &position, const engine::utils::FColor &color)
+void TextRenderer::clearCache()
 {
-    /* 构造函数已经保证了必要指针不会为空，这里不需要再检查 */
-    TTF_Font* font = resource_manager_->getFont(font_id, font_size);
-    if (!font) {
-        spdlog::warn("drawUIText 获取字体失败: {} 大小 {}", font_id, font_size);
+    for (auto& cached : text_lru_) {
+        TTF_DestroyText(cached.ttf_text_);
+    }
+    text_lru_.clear();
+    text_index_.clear();
+    prewarmed_fonts_.clear();
+}
+
+void TextRenderer::prewarmFonts(std::string_view font_dir, std::initializer_list<int> font_sizes)
+{
+    std::error_code ec;
+    const std::filesystem::path dir{font_dir};
+    if (!std::filesystem::is_directory(dir, ec)) {
+        spdlog::warn("预热字形图集失败，字体目录不存在: {}", font_dir);
         return;
     }
+    for (const auto& entry : std::filesystem::directory_iterator(dir, ec)) {
+        const auto extension = entry.path().extension();
+        if (!entry.is_regular_file() || (extension != ".ttf" && extension != ".otf")) continue;
+        // 与 UI 中的用法一致：字体ID为 "目录/文件名" 的哈希
+        const auto font_path = (dir / entry.path().filename()).generic_string();
+        const auto font_id = entt::hashed_string(font_path.c_str()).value();
+        for (const int font_size : font_sizes) {
+            TTF_Font* font = resource_manager_->getFont(font_id, font_size, font_path);
+            if (!font) {
+                spdlog::warn("预热字形图集时获取字体失败: {} 大小 {}", font_path, font_size);
+                continue;
+            }
+            prewarmFont(font, font_id, font_size);
+        }
+    }
+}
 
-    // 创建临时 TTF_Text 对象   (目前效率不高，未来可以考虑使用缓存优化)
-    TTF_Text* temp_text_object = TTF_CreateText(text_engine_, font, text.data(), 0);
-    if (!temp_text_object) {
-        spdlog::error("drawUIText 创建临时 TTF_Text 失败: {}", SDL_GetError());
+void TextRenderer::prewarmFont(TTF_Font* font, entt::id_type font_id, int font_size)
+{
+    if (!prewarmed_fonts_.insert(TextKey{font_id, font_size, 0}).second) return;
+
+    // 字形在文本对象更新时渲染进 TTF_TextEngine 的图集，之后即使文本对象被销毁，图集也会保留在引擎中
+    TTF_Text* text = TTF_CreateText(text_engine_, font, PREWARM_CHARSET.data(), PREWARM_CHARSET.size());
+    if (!text) {
+        spdlog::warn("预热字形图集失败: {}", SDL_GetError());
         return;
     }
+    if (!TTF_UpdateText(text)) {
+        spdlog::warn("预热字形图集失败: {}", SDL_GetError());
+    }
+    TTF_DestroyText(text);
+    spdlog::trace("字体 {} 大小 {} 的字形图集已预热。", font_id, font_size);
+}
+
+TextRenderer::CachedText* TextRenderer::getCachedText(std::string_view text, entt::id_type font_id, int font_size,
+                                                      std::string_view font_path)
+{
+    const TextKey key{font_id, font_size, entt::hashed_string::value(text.data(), text.size())};
+    if (auto it = text_index_.find(key); it != text_index_.end()) {
+        auto& cached = *it->second;
+        if (cached.text_ == text) {
+            text_lru_.splice(text_lru_.begin(), text_lru_, it->second);     // 移到最前（不分配内存）
+            return &cached;
+        }
+        // 哈希冲突：丢弃旧对象，下面重新创建
+        TTF_DestroyText(cached.ttf_text_);
+        text_lru_.erase(it->second);
+        text_index_.erase(it);
+    }
+
+    /* 构造函数已经保证了必要指针不会为空，这里不需要再检查 */
+    TTF_Font* font = resource_manager_->getFont(font_id, font_size, font_path);
+    if (!font) {
+        spdlog::warn("获取字体失败: {} 大小 {}", font_id, font_size);
+        return nullptr;
+    }
+    prewarmFont(font, font_id, font_size);
 
-    // 先渲染一次黑色文字模拟阴影
-    TTF_SetTextColorFloat(temp_text_object, 0.0f, 0.0f, 0.0f, 1.0f);
-    if (!TTF_DrawRendererText(temp_text_object, position.x + 2, position.y + 2)) {
-        spdlog::error("drawUIText 绘制临时 TTF_Text 失败: {}", SDL_GetError());
+    TTF_Text* ttf_text = TTF_CreateText(text_engine_, font, text.empty() ? "" : text.data(), text.size());   // 长度为0表示以\0结尾，空串需传入 ""
+    if (!ttf_text) {
+        spdlog::error("创建 TTF_Text 失败: {}", SDL_GetError());
+        return nullptr;
+    }
+    int width = 0, height = 0;
+    TTF_GetTextSize(ttf_text, &width, &height);
+
+    // 缓存已满时复用最久未使用的缓存项
+    if (text_lru_.size() >= MAX_CACHED_TEXTS) {
+        auto oldest = std::prev(text_lru_.end());
+        TTF_DestroyText(oldest->ttf_text_);
+        text_index_.erase(oldest->key_);
+        text_lru_.splice(text_lru_.begin(), text_lru_, oldest);
+    } else {
+        text_lru_.emplace_front();
     }
+    auto& cached = text_lru_.front();
+    cached.key_ = key;
+    cached.text_.assign(text);
+    cached.ttf_text_ = ttf_text;
+    cached.size_ = glm::vec2(static_cast<float>(width), static_cast<float>(height));
+    text_index_.emplace(key, text_lru_.begin());
+    return &cached;
+}
 
-    // 然后正常绘制
-    TTF_SetTextColorFloat(temp_text_object, color.r, color.g, color.b, color.a);
-    if (!TTF_DrawRendererText(temp_text_object, position.x, position.y)) {
-        spdlog::error("drawUIText 绘制临时 TTF_Text 失败: {}", SDL_GetError());
+void TextRenderer::drawUIText(std::string_view text, entt::id_type font_id, int font_size,
+                              const glm::vec2 &position, const engine::utils::FColor &color)
+{
+    auto* cached = getCachedText(text, font_id, font_size);
+    if (!cached) {
+        spdlog::warn("drawUIText 获取文本对象失败: {} 大小 {}", font_id, font_size);
+        return;
     }
 
-    // 销毁临时 TTF_Text 对象
-    TTF_DestroyText(temp_text_object);
+    // 先渲染一次黑色文字模拟阴影，然后正常绘制
+    renderer_->drawTTFText(cached->ttf_text_, position + glm::vec2(2.0f, 2.0f), engine::utils::FColor::black());
+    renderer_->drawTTFText(cached->ttf_text_, position, color);
 }
 
 void TextRenderer::drawText(const Camera &camera, std::string_view text, entt::id_type font_id, int font_size, 
@@ -87,27 +179,13 @@ void TextRenderer::drawText(const Camera &camera, std::string_view text, entt::i
 }
 
 glm::vec2 TextRenderer::getTextSize(std::string_view text, entt::id_type font_id, int font_size, std::string_view font_path) {
-    /* 构造函数已经保证了必要指针不会为空，这里不需要再检查 */
-    TTF_Font* font = resource_manager_->getFont(font_id, font_size, font_path);
-    if (!font) {
-        spdlog::warn("getTextSize 获取字体失败: {} 大小 {}", font_id, font_size);
-        return glm::vec2(0.0f, 0.0f);
-    }
-
-    // 创建临时 TTF_Text 对象
-    TTF_Text* temp_text_object = TTF_CreateText(text_engine_, font, text.data(), 0);
-    if (!temp_text_object) {
-        spdlog::error("getTextSize 创建临时 TTF_Text 失败: {}", SDL_GetError());
+    // 测量结果随文本对象一起缓存，之后绘制同一字符串时直接复用
+    auto* cached = getCachedText(text, font_id, font_size, font_path);
+    if (!cached) {
+        spdlog::warn("getTextSize 获取文本对象失败: {} 大小 {}", font_id, font_size);
         return glm::vec2(0.0f, 0.0f);
     }
+    return cached->size_;
+}
 
-    int width, height;
-    TTF_GetTextSize(temp_text_object, &width, &height);
-
-    // 销毁临时 TTF_Text 对象
-    TTF_DestroyText(temp_text_object);
-
-    return glm::vec2(static_cast<float>(width), static_cast<float>(height));
-} 
-
-} // namespace engine::render 
\ No newline at end of file
+} // namespace engine::render
@@ -1,11 +1,19 @@
 #pragma once
 #include <SDL3/SDL_render.h>
+#include <cstddef>
+#include <initializer_list>
+#include <list>
+#include <string>
 #include <string_view>
+#include <unordered_map>
+#include <unordered_set>
 #include <entt/core/hashed_string.hpp>
 #include <glm/vec2.hpp>
 #include "engine/utils/math.h"
 
 struct TTF_TextEngine;
+struct TTF_Text;
+struct TTF_Font;
 
 namespace engine::resource {
     class ResourceManager;
@@ -13,32 +21,78 @@ namespace engine::resource {
 
 namespace engine::render {
     class Camera;
+    class Renderer;
 /**
  * @brief 使用 SDL_ttf 和 TTF_Text 对象处理文本渲染。
  *
  * 封装 TTF_TextEngine 并提供创建和绘制 TTF_Text 对象的方法，
  * 管理字体加载和颜色设置。
+ *
+ * 创建好的 TTF_Text 按 (字体ID, 字号, 字符串哈希) 保存在 LRU 缓存中，同时缓存其测量尺寸，
+ * 每帧重复绘制或测量相同的字符串时不再创建/销毁文本对象，也不再分配内存。
+ * 字形图集由 TTF_TextEngine 持有，字体在第一次使用（或调用 prewarmFonts）时预先渲染常用字符，
+ * 避免游戏过程中首次出现某个字符时才上传字形纹理。
+ * 绘制通过 Renderer 进行（计入其绘制统计）。
  */
 class TextRenderer final {
 private:
-    SDL_Renderer* sdl_renderer_ = nullptr;                          ///< @brief 持有渲染器的非拥有指针
+    /// @brief 文本缓存的键
+    struct TextKey {
+        entt::id_type font_id_{};
+        int font_size_{};
+        entt::id_type text_hash_{};
+        bool operator==(const TextKey&) const = default;
+    };
+    struct TextKeyHash {
+        std::size_t operator()(const TextKey& key) const noexcept {
+            std::size_t hash = std::hash<entt::id_type>{}(key.font_id_);
+            hash ^= std::hash<int>{}(key.font_size_) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            hash ^= std::hash<entt::id_type>{}(key.text_hash_) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            return hash;
+        }
+    };
+    /// @brief 缓存的文本对象
+    struct CachedText {
+        TextKey key_;
+        std::string text_;                  ///< @brief 原始字符串（用于排除哈希冲突）
+        TTF_Text* ttf_text_ = nullptr;
+        glm::vec2 size_{0.0f, 0.0f};        ///< @brief 测量得到的尺寸
+    };
+    using TextList = std::list<CachedText>;
+
+    static constexpr std::size_t MAX_CACHED_TEXTS = 256;   ///< @brief 缓存的文本对象数量上限
+
+    Renderer* renderer_ = nullptr;                                  ///< @brief 持有渲染器的非拥有指针（记录绘制命令）
     engine::resource::ResourceManager* resource_manager_ = nullptr; ///< @brief 持有资源管理器的非拥有指针
     
     TTF_TextEngine* text_engine_ = nullptr;         ///< @brief 使用SDL3引入的 TTF_TextEngine 来进行绘制
 
+    TextList text_lru_;                                                 ///< @brief 缓存的文本对象（最近使用的在前）
+    std::unordered_map<TextKey, TextList::iterator, TextKeyHash> text_index_;   ///< @brief 键到缓存项的索引
+    std::unordered_set<TextKey, TextKeyHash> prewarmed_fonts_;          ///< @brief 已预热字形图集的 (字体ID, 字号)（text_hash_ 为 0）
+
 public:
     /**
      * @brief 构造 TextRenderer。
      *
-     * @param sdl_renderer 有效的 SDL_Renderer 指针。
+     * @param renderer 有效的 Renderer 指针（提供 SDL_Renderer 并记录绘制命令）。
      * @param resource_manager 有效的 ResourceManager 指针（用于字体加载）。
      * @throws std::runtime_error 如果初始化失败。
      */
-    TextRenderer(SDL_Renderer* sdl_renderer, engine::resource::ResourceManager* resource_manager);
+    TextRenderer(Renderer* renderer, engine::resource::ResourceManager* resource_manager);
 
     ~TextRenderer();            ///< @brief 析构函数，按需调用close()。
 
     void close();               ///< @brief 显式关闭。清理 TTF_TextEngine 并关闭SDL_ttf。
+    void clearCache();          ///< @brief 销毁所有缓存的文本对象（必须在字体卸载之前调用）
+
+    /**
+     * @brief 预热目录中所有字体的字形图集（渲染一遍常用字符）。
+     *
+     * @param font_dir 字体目录（字体ID为 "目录/文件名" 的哈希，与 UI 中使用的字体路径一致）。
+     * @param font_sizes 需要预热的字号。
+     */
+    void prewarmFonts(std::string_view font_dir, std::initializer_list<int> font_sizes);
 
     /**
      * @brief 绘制UI上的字符串。
@@ -75,12 +129,24 @@ public:
      */
     glm::vec2 getTextSize(std::string_view text, entt::id_type font_id, int font_size, std::string_view font_path = "");
 
+    std::size_t getCachedTextCount() const { return text_lru_.size(); }
+
     // 禁用拷贝和移动语义
     TextRenderer(const TextRenderer&) = delete;
     TextRenderer& operator=(const TextRenderer&) = delete;
     TextRenderer(TextRenderer&&) = delete;
     TextRenderer& operator=(TextRenderer&&) = delete;
 
+private:
+    /**
+     * @brief 获取缓存的文本对象，未命中时创建（缓存满时淘汰最久未使用的对象）。
+     * @return 缓存项，失败时返回 nullptr。
+     */
+    CachedText* getCachedText(std::string_view text, entt::id_type font_id, int font_size, std::string_view font_path = "");
+
+    /// @brief 预热指定字体与字号的字形图集（每个组合只执行一次）
+    void prewarmFont(TTF_Font* font, entt::id_type font_id, int font_size);
+
 }; // class TextRenderer
 
 } // namespace engine::render
\ No newline at end of file
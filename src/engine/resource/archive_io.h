@@ -0,0 +1,21 @@
+#pragma once
+#include "asset_archive.h"
+#include <string_view>
+#include <SDL3/SDL_iostream.h>
+
+namespace engine::resource {
+
+/**
+ * @brief 为资源包中的资源创建只读的内存 IO 流（直接指向映射内存，不复制数据）
+ * @param archive 资源包，为空时返回 nullptr
+ * @param file_path 资源路径
+ * @return IO 流，资源不在包中时返回 nullptr（调用者应回退为从文件加载）
+ */
+inline SDL_IOStream* openArchiveIO(const AssetArchive* archive, std::string_view file_path) {
+    if (!archive) return nullptr;
+    const auto data = archive->find(file_path);
+    if (data.empty()) return nullptr;
+    return SDL_IOFromConstMem(data.data(), data.size());
+}
+
+} // namespace engine::resource
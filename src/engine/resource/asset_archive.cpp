@@ -0,0 +1,195 @@
+#include "asset_archive.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <unordered_map>
+#include <spdlog/spdlog.h>
+#include <entt/core/hashed_string.hpp>
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace engine::resource {
+
+AssetArchive::AssetArchive(std::string_view file_path) : path_(file_path) {
+#ifdef _WIN32
+    HANDLE file = CreateFileW(std::filesystem::path(path_).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        throw std::runtime_error("AssetArchive 错误: 无法打开资源包 " + path_);
+    }
+    LARGE_INTEGER file_size{};
+    GetFileSizeEx(file, &file_size);
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        CloseHandle(file);
+        throw std::runtime_error("AssetArchive 错误: 无法映射资源包 " + path_);
+    }
+    data_ = static_cast<const std::byte*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    file_handle_ = file;
+    mapping_handle_ = mapping;
+    size_ = static_cast<size_t>(file_size.QuadPart);
+#else
+    const int fd = ::open(path_.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("AssetArchive 错误: 无法打开资源包 " + path_);
+    }
+    struct stat st{};
+    if (::fstat(fd, &st) != 0 || st.st_size <= 0) {
+        ::close(fd);
+        throw std::runtime_error("AssetArchive 错误: 资源包为空 " + path_);
+    }
+    void* mapped = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);        // 映射建立后即可关闭文件描述符
+    if (mapped != MAP_FAILED) {
+        data_ = static_cast<const std::byte*>(mapped);
+        size_ = static_cast<size_t>(st.st_size);
+    }
+#endif
+    if (!data_) {
+        unmap();
+        throw std::runtime_error("AssetArchive 错误: 无法映射资源包 " + path_);
+    }
+
+    // --- 校验头部与 TOC ---
+    Header header;
+    if (size_ < sizeof(Header)) {
+        unmap();
+        throw std::runtime_error("AssetArchive 错误: 资源包头部不完整 " + path_);
+    }
+    std::memcpy(&header, data_, sizeof(Header));
+    if (header.magic_ != MAGIC || header.version_ != VERSION) {
+        unmap();
+        throw std::runtime_error("AssetArchive 错误: 资源包格式或版本不匹配 " + path_);
+    }
+    const size_t toc_end = sizeof(Header) + static_cast<size_t>(header.entry_count_) * sizeof(Entry);
+    if (toc_end > size_) {
+        unmap();
+        throw std::runtime_error("AssetArchive 错误: 资源包 TOC 不完整 " + path_);
+    }
+    // 映射内存按页对齐，Header 大小是 Entry 对齐的整数倍，可以直接把 TOC 解释为 Entry 数组
+    entries_ = std::span<const Entry>(reinterpret_cast<const Entry*>(data_ + sizeof(Header)), header.entry_count_);
+    for (const auto& entry : entries_) {
+        if (entry.offset_ > size_ || entry.size_ > size_ - entry.offset_) {
+            unmap();
+            throw std::runtime_error("AssetArchive 错误: 资源包条目越界 " + path_);
+        }
+    }
+    spdlog::info("已映射资源包 '{}'：{} 个资源，{:.2f} MB", path_, entries_.size(), static_cast<double>(size_) / (1024.0 * 1024.0));
+}
+
+AssetArchive::~AssetArchive() {
+    unmap();
+}
+
+void AssetArchive::unmap() {
+#ifdef _WIN32
+    if (data_) UnmapViewOfFile(data_);
+    if (mapping_handle_) CloseHandle(static_cast<HANDLE>(mapping_handle_));
+    if (file_handle_) CloseHandle(static_cast<HANDLE>(file_handle_));
+    mapping_handle_ = nullptr;
+    file_handle_ = nullptr;
+#else
+    if (data_) ::munmap(const_cast<std::byte*>(data_), size_);
+#endif
+    data_ = nullptr;
+    size_ = 0;
+    entries_ = {};
+}
+
+std::span<const std::byte> AssetArchive::find(entt::id_type id) const {
+    auto it = std::lower_bound(entries_.begin(), entries_.end(), id,
+                               [](const Entry& entry, entt::id_type value) { return entry.id_ < value; });
+    if (it == entries_.end() || it->id_ != id) return {};
+    return {data_ + it->offset_, static_cast<size_t>(it->size_)};
+}
+
+std::span<const std::byte> AssetArchive::find(std::string_view file_path) const {
+    if (auto data = find(entt::hashed_string::value(file_path.data(), file_path.size())); !data.empty()) {
+        return data;
+    }
+    // 绝对路径（如 LevelLoader 解析出的图块集图片路径）转换为相对于工作目录的路径再查找
+    std::filesystem::path path(file_path);
+    if (!path.is_absolute()) return {};
+    const auto relative = path.lexically_relative(std::filesystem::current_path()).generic_string();
+    if (relative.empty() || relative.starts_with("..")) return {};
+    return find(entt::hashed_string::value(relative.c_str(), relative.size()));
+}
+
+bool AssetArchive::write(std::string_view output_path, const std::vector<std::pair<std::string, std::filesystem::path>>& files) {
+    // --- 生成 TOC 并检查哈希冲突 ---
+    std::vector<Entry> entries;
+    entries.reserve(files.size());
+    std::unordered_map<entt::id_type, const std::string*> names;
+    for (const auto& [name, source] : files) {
+        const auto id = entt::hashed_string::value(name.c_str(), name.size());
+        if (auto [it, inserted] = names.emplace(id, &name); !inserted) {
+            spdlog::error("资源路径哈希冲突: '{}' 与 '{}'", *it->second, name);
+            return false;
+        }
+        std::error_code ec;
+        const auto size = std::filesystem::file_size(source, ec);
+        if (ec) {
+            spdlog::error("无法读取文件大小 '{}': {}", source.string(), ec.message());
+            return false;
+        }
+        entries.push_back(Entry{id, 0, 0, size});
+    }
+
+    // 按输入顺序分配数据偏移（同一目录的文件相邻），再按 id 排序 TOC
+    std::uint64_t offset = sizeof(Header) + entries.size() * sizeof(Entry);
+    for (auto& entry : entries) {
+        offset = (offset + DATA_ALIGNMENT - 1) / DATA_ALIGNMENT * DATA_ALIGNMENT;
+        entry.offset_ = offset;
+        offset += entry.size_;
+    }
+    std::vector<Entry> toc = entries;
+    std::sort(toc.begin(), toc.end(), [](const Entry& a, const Entry& b) { return a.id_ < b.id_; });
+
+    std::ofstream out(std::string(output_path), std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        spdlog::error("无法创建资源包: {}", output_path);
+        return false;
+    }
+    Header header;
+    header.entry_count_ = static_cast<std::uint32_t>(toc.size());
+    out.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+    out.write(reinterpret_cast<const char*>(toc.data()), static_cast<std::streamsize>(toc.size() * sizeof(Entry)));
+
+    // --- 写入数据区 ---
+    std::vector<char> buffer;
+    for (size_t i = 0; i < files.size(); ++i) {
+        const auto& entry = entries[i];
+        const auto padding = entry.offset_ - static_cast<std::uint64_t>(out.tellp());
+        static constexpr char ZEROS[DATA_ALIGNMENT]{};
+        out.write(ZEROS, static_cast<std::streamsize>(padding));
+
+        std::ifstream in(files[i].second, std::ios::binary);
+        buffer.resize(static_cast<size_t>(entry.size_));
+        if (!in.read(buffer.data(), static_cast<std::streamsize>(buffer.size()))) {
+            spdlog::error("读取文件失败: {}", files[i].second.string());
+            return false;
+        }
+        out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    }
+    if (!out) {
+        spdlog::error("写入资源包失败: {}", output_path);
+        return false;
+    }
+    spdlog::info("资源包已写入 '{}'：{} 个资源，{} 字节", output_path, entries.size(), offset);
+    return true;
+}
+
+} // namespace engine::resource
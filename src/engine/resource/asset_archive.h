@@ -0,0 +1,99 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <entt/core/fwd.hpp>
+
+namespace engine::resource {
+
+/**
+ * @brief 资源包（.pak）：把纹理、音频、字体等文件打包成一个文件，运行时整体内存映射。
+ *
+ * 文件布局（小端序）：
+ * 1. Header：魔数 "MWPK"、版本号、条目数量；
+ * 2. TOC：按 id 升序排列的 Entry 数组，id 为资源路径（如 "assets/textures/UI/title.png"）的 entt::hashed_string 值，
+ *    与代码中 "路径"_hs 形式的资源 id 一致；
+ * 3. 数据区：各文件原样存放，按 DATA_ALIGNMENT 对齐。
+ *
+ * 查找时对 TOC 做二分查找，返回指向映射内存的视图，不复制数据。
+ * 资源包由打包工具（tools/asset_cook）生成，见 write()。
+ */
+class AssetArchive final {
+public:
+    static constexpr std::uint32_t MAGIC{0x4B50574D};       ///< @brief "MWPK"
+    static constexpr std::uint32_t VERSION{1};
+    static constexpr std::uint64_t DATA_ALIGNMENT{16};
+
+    struct Header {
+        std::uint32_t magic_{MAGIC};
+        std::uint32_t version_{VERSION};
+        std::uint32_t entry_count_{0};
+        std::uint32_t reserved_{0};
+    };
+
+    struct Entry {
+        std::uint32_t id_{0};           ///< @brief 资源路径的哈希值
+        std::uint32_t reserved_{0};
+        std::uint64_t offset_{0};       ///< @brief 数据在文件中的偏移
+        std::uint64_t size_{0};         ///< @brief 数据大小（字节）
+    };
+
+private:
+    const std::byte* data_{nullptr};    ///< @brief 映射内存的起始地址
+    size_t size_{0};                    ///< @brief 映射的字节数
+    std::span<const Entry> entries_;    ///< @brief TOC（指向映射内存）
+    std::string path_;                  ///< @brief 资源包路径
+#ifdef _WIN32
+    void* file_handle_{nullptr};
+    void* mapping_handle_{nullptr};
+#endif
+
+public:
+    /**
+     * @brief 打开并映射资源包
+     * @param file_path 资源包路径
+     * @throws std::runtime_error 文件无法打开、映射或格式不正确
+     */
+    explicit AssetArchive(std::string_view file_path);
+    ~AssetArchive();
+
+    AssetArchive(const AssetArchive&) = delete;
+    AssetArchive& operator=(const AssetArchive&) = delete;
+    AssetArchive(AssetArchive&&) = delete;
+    AssetArchive& operator=(AssetArchive&&) = delete;
+
+    /**
+     * @brief 按 id 查找资源
+     * @return 资源数据的视图（指向映射内存），不存在时为空
+     */
+    std::span<const std::byte> find(entt::id_type id) const;
+
+    /**
+     * @brief 按文件路径查找资源
+     * @param file_path 资源路径，绝对路径会先转换为相对于工作目录的路径
+     * @return 资源数据的视图（指向映射内存），不存在时为空
+     */
+    std::span<const std::byte> find(std::string_view file_path) const;
+
+    size_t getEntryCount() const { return entries_.size(); }
+    size_t getSize() const { return size_; }
+    const std::string& getPath() const { return path_; }
+
+    /**
+     * @brief 写入资源包（打包工具使用）
+     * @param output_path 输出文件路径
+     * @param files 资源路径（作为 id 的来源） -> 源文件路径
+     * @return 是否成功（路径哈希冲突或文件读写失败时返回 false）
+     */
+    static bool write(std::string_view output_path, const std::vector<std::pair<std::string, std::filesystem::path>>& files);
+
+private:
+    void unmap();
+};
+
+} // namespace engine::resource
@@ -1,4 +1,5 @@
 #include "audio_manager.h"
+#include "archive_io.h"
 #include <spdlog/spdlog.h>
 #include <stdexcept>
 #include <entt/core/hashed_string.hpp>
@@ -43,19 +44,22 @@ MIX_Audio* AudioManager::loadSound(entt::id_type id, std::string_view file_path)
     // 首先检查缓存
     auto it = sounds_.find(id);
     if (it != sounds_.end()) {
-        return it->second.get();
+        return it->second.audio_.get();
     }
 
-    // 加载音效（predecode=true，预先解码为PCM，适合短音效）
-    spdlog::debug("加载音效: {}", id);
-    MIX_Audio* audio = MIX_LoadAudio(mixer_, file_path.data(), true);
-    if (!audio) {
+    // 登记过的音效按登记的策略载入，否则预先解码为PCM（适合短音效）
+    const auto entry_it = sound_entries_.find(id);
+    const auto policy = entry_it != sound_entries_.end() ? entry_it->second.policy_ : AudioLoadPolicy::PREDECODE;
+    spdlog::debug("加载音效: {}（{}）", id, toString(policy));
+    auto loaded = loadAudio(file_path, policy, policy != AudioLoadPolicy::STREAM);
+    if (!loaded.audio_) {
         spdlog::error("加载音效失败: '{}': {}", id, SDL_GetError());
         return nullptr;
     }
 
     // 使用unique_ptr存储在缓存中
-    sounds_.emplace(id, std::unique_ptr<MIX_Audio, MIXAudioDeleter>(audio));
+    MIX_Audio* audio = loaded.audio_.get();
+    sounds_.emplace(id, std::move(loaded));
     spdlog::debug("成功加载并缓存音效: {}", id);
     return audio;
 }
@@ -67,7 +71,11 @@ MIX_Audio* AudioManager::loadSound(entt::hashed_string str_hs) {
 MIX_Audio* AudioManager::getSound(entt::id_type id, std::string_view file_path) {
     auto it = sounds_.find(id);
     if (it != sounds_.end()) {
-        return it->second.get();
+        return it->second.audio_.get();
+    }
+    // 延迟载入的音效：使用登记的路径
+    if (auto entry_it = sound_entries_.find(id); entry_it != sound_entries_.end()) {
+        return loadSound(id, entry_it->second.path_);
     }
     // 如果未找到，判断是否提供了file_path
     if (file_path.empty()) {
@@ -83,6 +91,13 @@ MIX_Audio* AudioManager::getSound(entt::hashed_string str_hs) {
     return getSound(str_hs.value(), str_hs.data());
 }
 
+void AudioManager::registerSound(entt::id_type id, std::string_view file_path, AudioLoadPolicy policy) {
+    sound_entries_[id] = AudioEntry{std::string(file_path), policy};
+    if (policy == AudioLoadPolicy::PREDECODE) {
+        loadSound(id, file_path);
+    }
+}
+
 void AudioManager::unloadSound(entt::id_type id) {
     auto it = sounds_.find(id);
     if (it != sounds_.end()) {
@@ -105,19 +120,22 @@ MIX_Audio* AudioManager::loadMusic(entt::id_type id, std::string_view file_path)
     // 首先检查缓存
     auto it = music_.find(id);
     if (it != music_.end()) {
-        return it->second.get();
+        return it->second.audio_.get();
     }
 
-    // 加载音乐（predecode=false，流式解码，适合长音乐）
-    spdlog::debug("加载音乐: {}", id);
-    MIX_Audio* audio = MIX_LoadAudio(mixer_, file_path.data(), false);
-    if (!audio) {
+    // 只有预解码策略才解码为PCM，其余保留压缩数据，播放时解码（适合长音乐）
+    const auto entry_it = music_entries_.find(id);
+    const auto policy = entry_it != music_entries_.end() ? entry_it->second.policy_ : AudioLoadPolicy::LAZY;
+    spdlog::debug("加载音乐: {}（{}）", id, toString(policy));
+    auto loaded = loadAudio(file_path, policy, policy == AudioLoadPolicy::PREDECODE);
+    if (!loaded.audio_) {
         spdlog::error("加载音乐失败: '{}': {}", id, SDL_GetError());
         return nullptr;
     }
 
     // 使用unique_ptr存储在缓存中
-    music_.emplace(id, std::unique_ptr<MIX_Audio, MIXAudioDeleter>(audio));
+    MIX_Audio* audio = loaded.audio_.get();
+    music_.emplace(id, std::move(loaded));
     spdlog::debug("成功加载并缓存音乐: {}", id);
     return audio;
 }
@@ -129,7 +147,11 @@ MIX_Audio* AudioManager::loadMusic(entt::hashed_string str_hs) {
 MIX_Audio* AudioManager::getMusic(entt::id_type id, std::string_view file_path) {
     auto it = music_.find(id);
     if (it != music_.end()) {
-        return it->second.get();
+        return it->second.audio_.get();
+    }
+    // 登记过的音乐：使用登记的路径
+    if (auto entry_it = music_entries_.find(id); entry_it != music_entries_.end()) {
+        return loadMusic(id, entry_it->second.path_);
     }
     // 如果未找到，判断是否提供了file_path
     if (file_path.empty()) {
@@ -145,6 +167,47 @@ MIX_Audio* AudioManager::getMusic(entt::hashed_string str_hs) {
     return getMusic(str_hs.value(), str_hs.data());
 }
 
+void AudioManager::registerMusic(entt::id_type id, std::string_view file_path, AudioLoadPolicy policy) {
+    music_entries_[id] = AudioEntry{std::string(file_path), policy};
+    if (policy == AudioLoadPolicy::PREDECODE) {
+        loadMusic(id, file_path);
+    }
+}
+
+bool AudioManager::bindMusic(MIX_Track* track, entt::id_type id, std::string_view file_path) {
+    // 已常驻内存的音乐（预解码、延迟载入或手动载入的）
+    if (auto it = music_.find(id); it != music_.end()) {
+        return MIX_SetTrackAudio(track, it->second.audio_.get());
+    }
+
+    // 未登记的音乐默认流式播放
+    const auto entry_it = music_entries_.find(id);
+    const bool registered = entry_it != music_entries_.end();
+    const auto policy = registered ? entry_it->second.policy_ : AudioLoadPolicy::STREAM;
+    const std::string_view path = registered ? std::string_view(entry_it->second.path_) : file_path;
+    if (path.empty()) {
+        spdlog::error("音乐 '{}' 未登记，且未提供文件路径。", id);
+        return false;
+    }
+    if (policy != AudioLoadPolicy::STREAM) {
+        MIX_Audio* audio = loadMusic(id, path);
+        return audio && MIX_SetTrackAudio(track, audio);
+    }
+
+    // 流式播放：轨道持有 IO 流，边读边解码，更换音频或销毁轨道时关闭
+    SDL_IOStream* io = openAudioIO(path);
+    if (!io) {
+        spdlog::error("无法打开音乐 '{}': {}", path, SDL_GetError());
+        return false;
+    }
+    if (!MIX_SetTrackIOStream(track, io, true)) {
+        spdlog::error("无法流式播放音乐 '{}': {}", path, SDL_GetError());
+        return false;
+    }
+    spdlog::debug("流式播放音乐: {}", path);
+    return true;
+}
+
 void AudioManager::unloadMusic(entt::id_type id) {
     auto it = music_.find(id);
     if (it != music_.end()) {
@@ -168,4 +231,59 @@ void AudioManager::clearAudio()
     clearMusic();
 }
 
+SDL_IOStream* AudioManager::openAudioIO(std::string_view file_path) const {
+    // 资源包中的音频直接引用映射内存（映射内存的生命周期长于所有音频和轨道）
+    if (auto* io = openArchiveIO(archive_, file_path)) {
+        return io;
+    }
+    return SDL_IOFromFile(std::string(file_path).c_str(), "rb");
+}
+
+AudioManager::LoadedAudio AudioManager::loadAudio(std::string_view file_path, AudioLoadPolicy policy, bool predecode) {
+    LoadedAudio loaded;
+    loaded.policy_ = policy;
+    SDL_IOStream* io = openAudioIO(file_path);
+    if (!io) {
+        return loaded;
+    }
+    const Sint64 file_size = SDL_GetIOSize(io);
+    loaded.audio_.reset(MIX_LoadAudio_IO(mixer_, io, predecode, true));
+    if (!loaded.audio_) {
+        return loaded;
+    }
+
+    // 预解码的音频占用PCM内存，否则常驻的是整个压缩文件
+    if (predecode) {
+        SDL_AudioSpec spec;
+        const Sint64 frames = MIX_GetAudioDuration(loaded.audio_.get());
+        if (frames > 0 && MIX_GetAudioFormat(loaded.audio_.get(), &spec)) {
+            loaded.bytes_ = static_cast<size_t>(frames) * static_cast<size_t>(spec.channels) * SDL_AUDIO_BYTESIZE(spec.format);
+        }
+    } else if (file_size > 0) {
+        loaded.bytes_ = static_cast<size_t>(file_size);
+    }
+    return loaded;
+}
+
+void AudioManager::fillMemoryStats(ResourceMemoryStats& stats) const {
+    auto& policies = stats.audio_policies_;
+    for (const auto* entries : {&sound_entries_, &music_entries_}) {
+        for (const auto& [id, entry] : *entries) {
+            ++policies[static_cast<size_t>(entry.policy_)].registered_;
+        }
+    }
+    for (const auto& [id, loaded] : sounds_) {
+        ++stats.sound_count_;
+        stats.sound_bytes_ += loaded.bytes_;
+        ++policies[static_cast<size_t>(loaded.policy_)].loaded_;
+        policies[static_cast<size_t>(loaded.policy_)].bytes_ += loaded.bytes_;
+    }
+    for (const auto& [id, loaded] : music_) {
+        ++stats.music_count_;
+        stats.music_bytes_ += loaded.bytes_;
+        ++policies[static_cast<size_t>(loaded.policy_)].loaded_;
+        policies[static_cast<size_t>(loaded.policy_)].bytes_ += loaded.bytes_;
+    }
+}
+
 } // namespace engine::resource
@@ -1,5 +1,7 @@
 #pragma once
+#include "resource_manager.h"
 #include <memory>
+#include <string>
 #include <unordered_map>
 #include <string_view>
 #include <entt/core/fwd.hpp>
@@ -7,10 +9,14 @@
 
 namespace engine::resource {
 
+class AssetArchive;
+
 /**
  * @brief 管理 SDL_mixer 音效和音乐 (统一为 MIX_Audio 类型)。
  *
  * 提供音频资源的加载和缓存功能。构造失败时会抛出异常。
+ * 资源映射中的音频按 AudioLoadPolicy 登记：预解码的立即载入，其余只记录路径，
+ * 在第一次使用时载入（流式音乐则从不载入，每次播放时打开 IO 流）。
  * 仅供 ResourceManager 内部使用。
  */
 class AudioManager final{
@@ -26,12 +32,29 @@ private:
         }
     };
 
+    /// @brief 常驻内存的音频
+    struct LoadedAudio {
+        std::unique_ptr<MIX_Audio, MIXAudioDeleter> audio_;
+        AudioLoadPolicy policy_{AudioLoadPolicy::PREDECODE};    ///< @brief 载入时使用的策略
+        size_t bytes_{0};                                       ///< @brief 占用的内存（载入时计算）
+    };
+
+    /// @brief 资源映射中登记的音频
+    struct AudioEntry {
+        std::string path_;
+        AudioLoadPolicy policy_{AudioLoadPolicy::PREDECODE};
+    };
+
     MIX_Mixer* mixer_{nullptr};  ///< @brief SDL_mixer 混音器实例
+    const AssetArchive* archive_{nullptr};  ///< @brief 资源包（非拥有，为空时从散文件加载）
 
-    // 音效存储 (id -> MIX_Audio，预解码)
-    std::unordered_map<entt::id_type, std::unique_ptr<MIX_Audio, MIXAudioDeleter>> sounds_;
-    // 音乐存储 (id -> MIX_Audio，流式解码)
-    std::unordered_map<entt::id_type, std::unique_ptr<MIX_Audio, MIXAudioDeleter>> music_;
+    // 音效存储 (id -> MIX_Audio)
+    std::unordered_map<entt::id_type, LoadedAudio> sounds_;
+    // 音乐存储 (id -> MIX_Audio，流式播放的音乐不在其中)
+    std::unordered_map<entt::id_type, LoadedAudio> music_;
+    // 资源映射中登记的音效与音乐 (id -> 路径与策略)
+    std::unordered_map<entt::id_type, AudioEntry> sound_entries_;
+    std::unordered_map<entt::id_type, AudioEntry> music_entries_;
 
 public:
     /**
@@ -81,6 +104,14 @@ private:  // 仅供 ResourceManager 访问的方法
      */
     MIX_Audio* getSound(entt::hashed_string str_hs);
 
+    /**
+     * @brief 按加载策略登记音效（PREDECODE 立即载入，其余在第一次使用时载入）
+     * @param id 音效的唯一标识符
+     * @param file_path 音效文件的路径
+     * @param policy 加载策略
+     */
+    void registerSound(entt::id_type id, std::string_view file_path, AudioLoadPolicy policy);
+
     void unloadSound(entt::id_type id);    ///< @brief 卸载指定的音效资源
     void clearSounds();                     ///< @brief 清空所有音效资源
 
@@ -114,9 +145,31 @@ private:  // 仅供 ResourceManager 访问的方法
      */
     MIX_Audio* getMusic(entt::hashed_string str_hs);
 
+    /**
+     * @brief 按加载策略登记音乐（PREDECODE 立即载入，其余在第一次播放时处理）
+     * @param id 音乐的唯一标识符
+     * @param file_path 音乐文件的路径
+     * @param policy 加载策略
+     */
+    void registerMusic(entt::id_type id, std::string_view file_path, AudioLoadPolicy policy);
+
+    /**
+     * @brief 把音乐设置到播放轨道上（流式音乐打开 IO 流交给轨道，其余使用常驻内存的音频）
+     * @param track 播放轨道
+     * @param id 音乐的唯一标识符
+     * @param file_path 未登记时使用的文件路径
+     * @return 是否成功
+     */
+    bool bindMusic(MIX_Track* track, entt::id_type id, std::string_view file_path);
+
     void unloadMusic(entt::id_type id);    ///< @brief 卸载指定的音乐资源
     void clearMusic();                      ///< @brief 清空所有音乐资源
     void clearAudio();                      ///< @brief 清空所有音频资源
+
+    void setArchive(const AssetArchive* archive) { archive_ = archive; }   ///< @brief 设置资源包，包中存在的音频优先从包中加载
+    SDL_IOStream* openAudioIO(std::string_view file_path) const;          ///< @brief 打开音频的 IO 流（资源包优先）
+    LoadedAudio loadAudio(std::string_view file_path, AudioLoadPolicy policy, bool predecode);  ///< @brief 加载音频并计算内存占用
+    void fillMemoryStats(ResourceMemoryStats& stats) const;                ///< @brief 填写音频部分的内存统计
 };
 
 } // namespace engine::resource
@@ -1,4 +1,5 @@
 #include "font_manager.h"
+#include "archive_io.h"
 #include <spdlog/spdlog.h>
 #include <stdexcept>
 #include <entt/core/hashed_string.hpp>
@@ -39,7 +40,13 @@ TTF_Font* FontManager::loadFont(entt::id_type id, int point_size, std::string_vi
 
     // 缓存中不存在，则判断是否提供了
     spdlog::debug("正在加载字体：{} ({}pt)", id, point_size);
-    TTF_Font* raw_font = TTF_OpenFont(file_path.data(), point_size);
+    // 资源包中的字体：字体对象会一直引用 IO 流，映射内存的生命周期长于所有字体
+    TTF_Font* raw_font = nullptr;
+    if (auto* io = openArchiveIO(archive_, file_path)) {
+        raw_font = TTF_OpenFontIO(io, true, static_cast<float>(point_size));
+    } else {
+        raw_font = TTF_OpenFont(file_path.data(), point_size);
+    }
     if (!raw_font) {
         spdlog::error("加载字体 '{}' ({}pt) 失败：{}", id, point_size, SDL_GetError());
         return nullptr;
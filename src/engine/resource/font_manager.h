@@ -8,6 +8,8 @@
 
 namespace engine::resource {
 
+class AssetArchive;
+
 // 定义字体键类型（路径 + 大小）
 using FontKey = std::pair<entt::id_type, int>;
 
@@ -48,6 +50,7 @@ private:
     // unordered_map 的键需要能转换为哈希值，对于基础数据类型，系统会自动转换
     // 但是对于对于自定义类型（系统无法自动转化），则需要提供自定义哈希函数（第三个模版参数）
     std::unordered_map<FontKey, std::unique_ptr<TTF_Font, SDLFontDeleter>, FontKeyHash> fonts_;
+    const AssetArchive* archive_{nullptr};      ///< @brief 资源包（非拥有，为空时从散文件加载）
 
 public:
     /**
@@ -118,6 +121,8 @@ private: // 仅由 ResourceManager（和内部）访问的方法
      * @brief 清空所有缓存的字体
      */
     void clearFonts();
+
+    void setArchive(const AssetArchive* archive) { archive_ = archive; }   ///< @brief 设置资源包，包中存在的字体优先从包中加载
 };
 
 } // namespace engine::resource
@@ -2,6 +2,8 @@
 #include "texture_manager.h"
 #include "audio_manager.h"
 #include "font_manager.h"
+#include "asset_archive.h"
+#include <chrono>
 #include <fstream>
 #include <filesystem>
 #include <SDL3_mixer/SDL_mixer.h>
@@ -13,6 +15,43 @@
 
 namespace engine::resource {
 
+namespace {
+
+/**
+ * @brief 解析资源映射中的一条音频：值可以是路径字符串，也可以是 {"path": ..., "policy": "predecode" | "stream" | "lazy"}
+ *        （音效还可以带 "max_instances"，由 loadResources 读取）
+ * @param value JSON 值
+ * @param default_policy 未指定策略时使用的策略
+ * @param path 输出文件路径
+ * @return 加载策略
+ */
+AudioLoadPolicy parseAudioEntry(const nlohmann::json& value, AudioLoadPolicy default_policy, std::string& path) {
+    if (value.is_string()) {
+        path = value.get<std::string>();
+        return default_policy;
+    }
+    path = value.at("path").get<std::string>();
+    const auto name = value.value("policy", std::string(toString(default_policy)));
+    for (size_t i = 0; i < static_cast<size_t>(AudioLoadPolicy::COUNT); ++i) {
+        if (name == toString(static_cast<AudioLoadPolicy>(i))) {
+            return static_cast<AudioLoadPolicy>(i);
+        }
+    }
+    spdlog::warn("未知的音频加载策略 '{}'（{}），使用 '{}'", name, path, toString(default_policy));
+    return default_policy;
+}
+
+} // namespace
+
+std::string_view toString(AudioLoadPolicy policy) {
+    switch (policy) {
+        case AudioLoadPolicy::PREDECODE: return "predecode";
+        case AudioLoadPolicy::STREAM: return "stream";
+        case AudioLoadPolicy::LAZY: return "lazy";
+        default: return "unknown";
+    }
+}
+
 ResourceManager::~ResourceManager() = default;
 
 ResourceManager::ResourceManager(SDL_Renderer* renderer) {
@@ -33,24 +72,54 @@ void ResourceManager::clear() {
     spdlog::trace("ResourceManager 中的资源通过 clear() 清空。");
 }
 
+bool ResourceManager::mountArchive(std::string_view file_path) {
+    if (archive_) {
+        spdlog::warn("已经挂载了资源包 '{}'，忽略 '{}'", archive_->getPath(), file_path);
+        return false;
+    }
+    if (!std::filesystem::exists(file_path)) {
+        spdlog::debug("资源包 '{}' 不存在，从散文件加载资源", file_path);
+        return false;
+    }
+    try {
+        archive_ = std::make_unique<AssetArchive>(file_path);
+    } catch (const std::exception& e) {
+        spdlog::error("挂载资源包失败: {}", e.what());
+        return false;
+    }
+    texture_manager_->setArchive(archive_.get());
+    audio_manager_->setArchive(archive_.get());
+    font_manager_->setArchive(archive_.get());
+    return true;
+}
+
 void ResourceManager::loadResources(std::string_view file_path) {
     std::filesystem::path path(file_path);
     if (!std::filesystem::exists(path)) {
         spdlog::warn("资源映射文件不存在: {}", file_path);
         return;
     }
+    const auto start = std::chrono::steady_clock::now();
     std::ifstream file(path);
     nlohmann::json json;
     file >> json;
     try {
+        // 音频按加载策略登记：音效默认预解码，音乐默认流式播放（载入映射时不读取音乐文件）
+        std::string audio_path;
         if (json.contains("sound")) {
             for (const auto& [key, value] : json["sound"].items()) {
-                loadSound(entt::hashed_string(key.c_str()), value.get<std::string>());
+                const auto policy = parseAudioEntry(value, AudioLoadPolicy::PREDECODE, audio_path);
+                const entt::id_type id = entt::hashed_string(key.c_str());
+                audio_manager_->registerSound(id, audio_path, policy);
+                if (value.is_object() && value.contains("max_instances")) {
+                    sound_instance_limits_[id] = value["max_instances"].get<int>();
+                }
             }
         }
         if (json.contains("music")) {
             for (const auto& [key, value] : json["music"].items()) {
-                loadMusic(entt::hashed_string(key.c_str()), value.get<std::string>());
+                const auto policy = parseAudioEntry(value, AudioLoadPolicy::STREAM, audio_path);
+                audio_manager_->registerMusic(entt::hashed_string(key.c_str()), audio_path, policy);
             }
         }
         if (json.contains("texture")) {
@@ -66,6 +135,8 @@ void ResourceManager::loadResources(std::string_view file_path) {
     } catch (const nlohmann::json::exception& e) {
         spdlog::error("加载资源文件失败: {}", e.what());
     }
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    spdlog::info("资源映射 '{}' 载入完成，耗时 {:.2f} ms（来源: {}）", file_path, elapsed.count(), archive_ ? "资源包" : "散文件");
 }
 
 // --- 纹理接口实现 ---
@@ -78,6 +149,10 @@ SDL_Texture* ResourceManager::loadTexture(entt::hashed_string str_hs) {
     return texture_manager_->loadTexture(str_hs);
 }
 
+SDL_Texture* ResourceManager::loadTexture(entt::id_type id, std::string_view file_path, SDL_Surface* surface) {
+    return texture_manager_->loadTexture(id, file_path, surface);
+}
+
 SDL_Texture* ResourceManager::getTexture(entt::id_type id, std::string_view file_path) {
     return texture_manager_->getTexture(id, file_path);
 }
@@ -102,6 +177,28 @@ void ResourceManager::clearTextures() {
     texture_manager_->clearTextures();
 }
 
+void ResourceManager::acquireTexture(entt::id_type id) {
+    texture_manager_->acquire(id);
+}
+
+void ResourceManager::releaseTexture(entt::id_type id) {
+    texture_manager_->release(id);
+}
+
+void ResourceManager::setTextureBudget(size_t bytes) {
+    texture_manager_->setBudget(bytes);
+}
+
+// --- 生命周期管理 ---
+void ResourceManager::setActiveScope(ResourceScope* scope) {
+    active_scope_ = scope;
+    texture_manager_->setActiveScope(scope);
+}
+
+void ResourceManager::collectGarbage() {
+    texture_manager_->collectGarbage();
+}
+
 // --- 音频接口实现 ---
 MIX_Audio* ResourceManager::loadSound(entt::id_type id, std::string_view file_path) {
     return audio_manager_->loadSound(id, file_path);
@@ -127,6 +224,10 @@ void ResourceManager::clearSounds() {
     audio_manager_->clearSounds();
 }
 
+bool ResourceManager::bindMusic(MIX_Track* track, entt::id_type id, std::string_view file_path) {
+    return audio_manager_->bindMusic(track, id, file_path);
+}
+
 MIX_Audio* ResourceManager::loadMusic(entt::id_type id, std::string_view file_path) {
     return audio_manager_->loadMusic(id, file_path);
 }
@@ -180,4 +281,17 @@ void ResourceManager::clearFonts() {
     font_manager_->clearFonts();
 }
 
+// --- 统计接口实现 ---
+ResourceMemoryStats ResourceManager::getMemoryStats() const {
+    ResourceMemoryStats stats;
+    stats.texture_count_ = texture_manager_->getTextureCount();
+    stats.texture_bytes_ = texture_manager_->getTextureBytes();
+    stats.texture_budget_bytes_ = texture_manager_->budget_bytes_;
+    stats.texture_referenced_count_ = texture_manager_->getReferencedCount();
+    stats.texture_evictions_ = texture_manager_->eviction_count_;
+    stats.texture_reloads_ = texture_manager_->reload_count_;
+    audio_manager_->fillMemoryStats(stats);
+    return stats;
+}
+
 } // namespace engine::resource
@@ -1,6 +1,9 @@
 #pragma once
+#include <array>
+#include <cstdint>
 #include <memory> // 用于 std::unique_ptr
 #include <string_view> // 用于 std::string_view
+#include <unordered_map>
 #include <glm/glm.hpp>
 #include <entt/core/fwd.hpp>
 #include <nlohmann/json_fwd.hpp>
@@ -8,8 +11,10 @@
 // 前向声明 SDL 类型
 struct SDL_Renderer;
 struct SDL_Texture;
+struct SDL_Surface;
 struct MIX_Audio;
 struct MIX_Mixer;
+struct MIX_Track;
 struct TTF_Font;
 
 namespace engine::resource {
@@ -18,6 +23,46 @@ namespace engine::resource {
 class TextureManager;
 class AudioManager;
 class FontManager;
+class AssetArchive;
+class ResourceScope;
+
+/**
+ * @brief 音频的加载策略（在 resource_mapping.json 中按资源指定）
+ */
+enum class AudioLoadPolicy : std::uint8_t {
+    PREDECODE,  ///< @brief 载入映射时即解码为PCM常驻内存（音效的默认策略）
+    STREAM,     ///< @brief 播放时才解码。音乐直接从文件/资源包流式读取，不常驻内存（音乐的默认策略）；音效常驻压缩数据
+    LAZY,       ///< @brief 第一次播放时才载入（音效解码为PCM，音乐常驻压缩数据），适合很少播放的音频
+    COUNT,
+};
+
+std::string_view toString(AudioLoadPolicy policy);
+
+/**
+ * @brief 某种加载策略下的音频统计
+ */
+struct AudioPolicyStats {
+    size_t registered_{0};      ///< @brief 资源映射中登记的音频数量
+    size_t loaded_{0};          ///< @brief 常驻内存的音频数量
+    size_t bytes_{0};           ///< @brief 常驻内存（PCM 或压缩数据，字节）
+};
+
+/**
+ * @brief 资源缓存的内存统计（估算值，用于调试面板）
+ */
+struct ResourceMemoryStats {
+    size_t texture_count_{0};   ///< @brief 纹理数量
+    size_t texture_bytes_{0};   ///< @brief 纹理显存（字节）
+    size_t texture_budget_bytes_{0};        ///< @brief 纹理显存预算（0 = 不限制）
+    size_t texture_referenced_count_{0};    ///< @brief 被作用域引用的纹理数量（其余可被逐出）
+    size_t texture_evictions_{0};           ///< @brief 累计逐出的纹理数量
+    size_t texture_reloads_{0};             ///< @brief 累计重新载入的纹理数量
+    size_t sound_count_{0};     ///< @brief 常驻内存的音效数量
+    size_t sound_bytes_{0};     ///< @brief 音效占用的内存（字节）
+    size_t music_count_{0};     ///< @brief 常驻内存的音乐数量（流式播放的音乐不常驻）
+    size_t music_bytes_{0};     ///< @brief 音乐占用的内存（字节）
+    std::array<AudioPolicyStats, static_cast<size_t>(AudioLoadPolicy::COUNT)> audio_policies_{};    ///< @brief 按加载策略分类的音频统计
+};
 
 /**
  * @brief 作为访问各种资源管理器的中央控制点（外观模式 Facade）。
@@ -26,9 +71,12 @@ class FontManager;
 class ResourceManager final{
 private:
     // 使用 unique_ptr 确保所有权和自动清理
+    std::unique_ptr<AssetArchive> archive_;     ///< @brief 资源包（可选）。声明在最前面，保证最后析构（字体、音乐会一直引用映射内存）
     std::unique_ptr<TextureManager> texture_manager_;
     std::unique_ptr<AudioManager> audio_manager_;
     std::unique_ptr<FontManager> font_manager_;
+    ResourceScope* active_scope_ = nullptr;     ///< @brief 活动的资源作用域（非拥有）
+    std::unordered_map<entt::id_type, int> sound_instance_limits_;  ///< @brief 资源映射中指定的音效实例上限（音效ID -> 上限）
 
 public:
     /**
@@ -47,6 +95,16 @@ public:
     ResourceManager(ResourceManager&&) = delete;
     ResourceManager& operator=(ResourceManager&&) = delete;
 
+    /**
+     * @brief 挂载资源包，之后包中存在的资源都从映射内存加载，不在包中的资源依然从文件加载
+     * @param file_path 资源包路径
+     * @return 是否挂载成功（文件不存在时返回 false，不视为错误）
+     * @note 必须在载入任何资源之前调用，只能挂载一次
+     */
+    bool mountArchive(std::string_view file_path);
+    bool hasArchive() const { return archive_ != nullptr; }    ///< @brief 是否挂载了资源包
+    const AssetArchive* getArchive() const { return archive_.get(); }  ///< @brief 获取资源包（未挂载时为nullptr，只读访问可跨线程）
+
     // 加载资源
     void loadResources(std::string_view file_path);
 
@@ -54,12 +112,25 @@ public:
     // -- Texture --
     SDL_Texture* loadTexture(entt::id_type id, std::string_view file_path);         ///< @brief 载入纹理资源(通过id + 文件路径)
     SDL_Texture* loadTexture(entt::hashed_string str_hs);                           ///< @brief 载入纹理资源(通过字符串哈希值)
+    SDL_Texture* loadTexture(entt::id_type id, std::string_view file_path, SDL_Surface* surface);   ///< @brief 用已解码的图片创建纹理(不获取surface所有权)
     SDL_Texture* getTexture(entt::id_type id, std::string_view file_path = "");     ///< @brief 尝试获取已加载纹理的指针，如果未加载则尝试加载(通过id + 文件路径)
     SDL_Texture* getTexture(entt::hashed_string str_hs);                            ///< @brief 尝试获取已加载纹理的指针，如果未加载则尝试加载(通过字符串哈希值)
     void unloadTexture(entt::id_type id);                                           ///< @brief 卸载指定的纹理资源
     glm::vec2 getTextureSize(entt::id_type id, std::string_view file_path = "");    ///< @brief 获取指定纹理的尺寸(通过id + 文件路径)
     glm::vec2 getTextureSize(entt::hashed_string str_hs);                           ///< @brief 获取指定纹理的尺寸(通过字符串哈希值)
     void clearTextures();                                                           ///< @brief 清空所有纹理资源
+    void acquireTexture(entt::id_type id);                                          ///< @brief 增加纹理的引用计数
+    void releaseTexture(entt::id_type id);                                          ///< @brief 减少纹理的引用计数（归零后可被逐出）
+    void setTextureBudget(size_t bytes);                                            ///< @brief 设置纹理显存预算（0 = 不限制）
+
+    // -- Lifetime --
+    void setActiveScope(ResourceScope* scope);                                      ///< @brief 设置活动的资源作用域（之后用到的资源登记到其中）
+    ResourceScope* getActiveScope() const { return active_scope_; }                 ///< @brief 获取活动的资源作用域
+    /**
+     * @brief 帧末调用：资源超出预算时逐出没有引用、最久未使用的纹理
+     * @note 必须在本帧呈现之后调用
+     */
+    void collectGarbage();
 
     // -- Sound Effects --
     MIX_Audio* loadSound(entt::id_type id, std::string_view file_path);             ///< @brief 载入音效资源(通过id + 文件路径)
@@ -68,8 +139,18 @@ public:
     MIX_Audio* getSound(entt::hashed_string str_hs);                                ///< @brief 尝试获取已加载音效的指针，如果未加载则尝试加载(通过字符串哈希值)
     void unloadSound(entt::id_type id);                                             ///< @brief 卸载指定的音效资源
     void clearSounds();                                                             ///< @brief 清空所有音效资源
+    /// @brief 资源映射中为音效指定的同时播放实例上限（{"path", "max_instances"}，未指定的音效使用默认上限）
+    const std::unordered_map<entt::id_type, int>& getSoundInstanceLimits() const { return sound_instance_limits_; }
 
     // -- Music --
+    /**
+     * @brief 把音乐设置到播放轨道上：流式策略的音乐直接从文件/资源包读取，其它策略使用常驻内存的音频
+     * @param track 播放轨道
+     * @param id 音乐ID
+     * @param file_path 文件路径（未在资源映射中登记时使用，默认为流式播放）
+     * @return 是否成功
+     */
+    bool bindMusic(MIX_Track* track, entt::id_type id, std::string_view file_path = "");
     MIX_Audio* loadMusic(entt::id_type id, std::string_view file_path);             ///< @brief 载入音乐资源(通过id + 文件路径)
     MIX_Audio* loadMusic(entt::hashed_string str_hs);                               ///< @brief 载入音乐资源(通过字符串哈希值)
     MIX_Audio* getMusic(entt::id_type id, std::string_view file_path = "");         ///< @brief 尝试获取已加载音乐的指针，如果未加载则尝试加载(通过id + 文件路径)
@@ -87,6 +168,9 @@ public:
     TTF_Font* getFont(entt::hashed_string str_hs, int point_size);                        ///< @brief 尝试获取已加载字体的指针，如果未加载则尝试加载(通过字符串哈希值)
     void unloadFont(entt::id_type id, int point_size);                              ///< @brief 卸载指定的字体资源
     void clearFonts();                                                              ///< @brief 清空所有字体资源
+
+    // -- Statistics --
+    ResourceMemoryStats getMemoryStats() const;                                     ///< @brief 获取资源缓存的内存统计（调试用）
 };
 
 } // namespace engine::resource
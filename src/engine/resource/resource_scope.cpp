@@ -0,0 +1,34 @@
+#include "resource_scope.h"
+#include "resource_manager.h"
+#include <atomic>
+#include <spdlog/spdlog.h>
+
+namespace engine::resource {
+
+namespace {
+std::atomic<std::uint32_t> next_serial{1};  // 0 表示纹理尚未登记到任何作用域
+}
+
+ResourceScope::ResourceScope(ResourceManager& resource_manager, std::string_view name)
+    : resource_manager_(resource_manager), name_(name), serial_(next_serial++) {
+}
+
+ResourceScope::~ResourceScope() {
+    if (resource_manager_.getActiveScope() == this) {
+        resource_manager_.setActiveScope(nullptr);
+    }
+    release();
+}
+
+void ResourceScope::release() {
+    if (textures_.empty()) return;
+    spdlog::debug("资源作用域 '{}' 释放 {} 个纹理的引用", name_, textures_.size());
+    for (auto id : textures_) {
+        resource_manager_.releaseTexture(id);
+    }
+    textures_.clear();
+    // 换一个序号，之后再用到的纹理会重新登记
+    serial_ = next_serial++;
+}
+
+} // namespace engine::resource
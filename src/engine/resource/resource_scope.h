@@ -0,0 +1,52 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <entt/core/fwd.hpp>
+
+namespace engine::resource {
+
+class ResourceManager;
+
+/**
+ * @brief 资源作用域：一组共同持有引用的资源（通常一个场景一个）
+ *
+ * 作用域被设为活动作用域时，第一次用到的纹理会被登记并持有一个引用；
+ * release() 或析构时归还所有引用。引用归零的纹理不会立即释放，
+ * 只有显存超出预算时才会按最近使用时间被逐出，因此在场景之间共享的纹理切换场景时不会被反复载入。
+ */
+class ResourceScope final {
+    ResourceManager& resource_manager_;
+    std::string name_;                                  ///< @brief 名称（用于日志）
+    std::uint32_t serial_{0};                           ///< @brief 唯一序号
+    std::unordered_set<entt::id_type> textures_;        ///< @brief 持有引用的纹理
+
+public:
+    /**
+     * @brief 构造函数
+     * @param resource_manager 资源管理器（必须比作用域存活更久）
+     * @param name 名称
+     */
+    ResourceScope(ResourceManager& resource_manager, std::string_view name);
+    ~ResourceScope();   ///< @brief 归还所有引用，如果自己是活动作用域则取消
+
+    // 禁止拷贝和移动
+    ResourceScope(const ResourceScope&) = delete;
+    ResourceScope& operator=(const ResourceScope&) = delete;
+    ResourceScope(ResourceScope&&) = delete;
+    ResourceScope& operator=(ResourceScope&&) = delete;
+
+    /**
+     * @brief 登记纹理
+     * @return 是否是新登记的（调用者需要为新登记的纹理增加引用计数）
+     */
+    bool addTexture(entt::id_type id) { return textures_.insert(id).second; }
+    void release();                                     ///< @brief 归还所有引用（作用域之后仍可继续使用）
+
+    std::uint32_t getSerial() const { return serial_; }
+    std::string_view getName() const { return name_; }
+    size_t getTextureCount() const { return textures_.size(); }
+};
+
+} // namespace engine::resource
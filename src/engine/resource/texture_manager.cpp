@@ -1,7 +1,12 @@
 #include "texture_manager.h"
+#include "archive_io.h"
+#include "resource_scope.h"
 #include <SDL3_image/SDL_image.h> // 用于 IMG_LoadTexture, IMG_Init, IMG_Quit
 #include <spdlog/spdlog.h>
+#include <algorithm>
+#include <chrono>
 #include <stdexcept>
+#include <vector>
 #include <entt/core/hashed_string.hpp>
 
 namespace engine::resource {
@@ -16,28 +21,51 @@ TextureManager::TextureManager(SDL_Renderer* renderer) : renderer_(renderer) {
 
 SDL_Texture* TextureManager::loadTexture(entt::id_type id, std::string_view file_path) {
     // 检查是否已加载
-    auto it = textures_.find(id);
-    if (it != textures_.end()) {
-        return it->second.get();
+    if (auto* entry = touch(id); entry) {
+        return entry->texture_.get();
     }
 
-    // 如果没加载则尝试加载纹理
-    SDL_Texture* raw_texture = IMG_LoadTexture(renderer_, file_path.data());
+    // 如果没加载则尝试加载纹理（优先从资源包的映射内存中解码）
+    const auto start = std::chrono::steady_clock::now();
+    SDL_Texture* raw_texture = nullptr;
+    if (auto* io = openArchiveIO(archive_, file_path)) {
+        raw_texture = IMG_LoadTexture_IO(renderer_, io, true);
+    } else {
+        raw_texture = IMG_LoadTexture(renderer_, std::string(file_path).c_str());
+    }
     if (!raw_texture) {
-        spdlog::error("加载纹理失败: '{}': {}", file_path.data(), SDL_GetError());
+        spdlog::error("加载纹理失败: '{}': {}", file_path, SDL_GetError());
         return nullptr;
     }
 
     // 载入纹理时，设置纹理缩放模式为最邻近插值(必不可少，否则TileLayer渲染中会出现边缘空隙/模糊)
     if (!SDL_SetTextureScaleMode(raw_texture, SDL_SCALEMODE_NEAREST)) {
-        spdlog::warn("无法为纹理 '{}' 设置最邻近缩放：{}", file_path.data(), SDL_GetError());
+        spdlog::warn("无法为纹理 '{}' 设置最邻近缩放：{}", file_path, SDL_GetError());
     }
 
-    // 使用带有自定义删除器的 unique_ptr 存储加载的纹理
-    textures_.emplace(id, std::unique_ptr<SDL_Texture, SDLTextureDeleter>(raw_texture));
-    spdlog::debug("成功加载并缓存纹理: {}", file_path.data());
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return insert(id, file_path, raw_texture, elapsed.count());
+}
 
-    return raw_texture;
+SDL_Texture* TextureManager::loadTexture(entt::id_type id, std::string_view file_path, SDL_Surface* surface) {
+    if (auto* entry = touch(id); entry) {
+        return entry->texture_.get();
+    }
+    if (!surface) {
+        return loadTexture(id, file_path);
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    SDL_Texture* raw_texture = SDL_CreateTextureFromSurface(renderer_, surface);
+    if (!raw_texture) {
+        spdlog::error("创建纹理失败: '{}': {}", file_path, SDL_GetError());
+        return nullptr;
+    }
+    if (!SDL_SetTextureScaleMode(raw_texture, SDL_SCALEMODE_NEAREST)) {
+        spdlog::warn("无法为纹理 '{}' 设置最邻近缩放：{}", file_path, SDL_GetError());
+    }
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return insert(id, file_path, raw_texture, elapsed.count());
 }
 
 SDL_Texture* TextureManager::loadTexture(entt::hashed_string str_hs) {
@@ -46,9 +74,14 @@ SDL_Texture* TextureManager::loadTexture(entt::hashed_string str_hs) {
 
 SDL_Texture* TextureManager::getTexture(entt::id_type id, std::string_view file_path) {
     // 查找现有纹理
-    auto it = textures_.find(id);
-    if (it != textures_.end()) {
-        return it->second.get();
+    if (auto* entry = touch(id); entry) {
+        return entry->texture_.get();
+    }
+
+    // 被逐出的纹理：使用原来的路径重新载入
+    if (auto it = evicted_.find(id); it != evicted_.end()) {
+        const std::string path = it->second;
+        return loadTexture(id, path);
     }
 
     // 如果未找到，判断是否提供了file_path
@@ -69,14 +102,14 @@ glm::vec2 TextureManager::getTextureSize(entt::id_type id, std::string_view file
     // 获取纹理
     SDL_Texture* texture = getTexture(id, file_path);
     if (!texture) {
-        spdlog::error("无法获取纹理: {}", file_path.data());
+        spdlog::error("无法获取纹理: {}", file_path);
         return glm::vec2(0);
     }
 
     // 获取纹理尺寸
     glm::vec2 size;
     if (!SDL_GetTextureSize(texture, &size.x, &size.y)) {
-        spdlog::error("无法查询纹理尺寸: {}", file_path.data());
+        spdlog::error("无法查询纹理尺寸: {}", file_path);
         return glm::vec2(0);
     }
     return size;
@@ -86,10 +119,17 @@ glm::vec2 TextureManager::getTextureSize(entt::hashed_string str_hs) {
     return getTextureSize(str_hs.value(), str_hs.data());
 }
 
+size_t TextureManager::getReferencedCount() const {
+    return static_cast<size_t>(std::count_if(textures_.begin(), textures_.end(), [](const auto& pair) {
+        return pair.second.ref_count_ > 0;
+    }));
+}
+
 void TextureManager::unloadTexture(entt::id_type id) {
     auto it = textures_.find(id);
     if (it != textures_.end()) {
         spdlog::debug("卸载纹理: id = {}", id);
+        total_bytes_ -= it->second.bytes_;
         textures_.erase(it); // unique_ptr 通过自定义删除器处理删除
     } else {
         spdlog::warn("尝试卸载不存在的纹理: id = {}", id);
@@ -101,6 +141,93 @@ void TextureManager::clearTextures() {
         spdlog::debug("正在清除所有 {} 个缓存的纹理。", textures_.size());
         textures_.clear(); // unique_ptr 处理所有元素的删除
     }
+    evicted_.clear();
+    total_bytes_ = 0;
+}
+
+void TextureManager::acquire(entt::id_type id) {
+    if (auto it = textures_.find(id); it != textures_.end()) {
+        ++it->second.ref_count_;
+    }
+}
+
+void TextureManager::release(entt::id_type id) {
+    // 纹理可能已被手动卸载，找不到时忽略
+    if (auto it = textures_.find(id); it != textures_.end() && it->second.ref_count_ > 0) {
+        --it->second.ref_count_;
+    }
+}
+
+void TextureManager::collectGarbage() {
+    const auto frame = frame_++;
+    if (budget_bytes_ == 0 || total_bytes_ <= budget_bytes_) {
+        return;
+    }
+
+    // 候选：没有引用、且本帧没有使用的纹理，最久未使用的排在前面
+    std::vector<std::pair<std::uint64_t, entt::id_type>> candidates;
+    for (const auto& [id, entry] : textures_) {
+        if (entry.ref_count_ == 0 && entry.last_used_ < frame) {
+            candidates.emplace_back(entry.last_used_, id);
+        }
+    }
+    std::sort(candidates.begin(), candidates.end());
+
+    for (const auto& [last_used, id] : candidates) {
+        if (total_bytes_ <= budget_bytes_) break;
+        auto it = textures_.find(id);
+        const auto start = std::chrono::steady_clock::now();
+        const size_t bytes = it->second.bytes_;
+        evicted_[id] = std::move(it->second.path_);
+        textures_.erase(it);
+        total_bytes_ -= bytes;
+        ++eviction_count_;
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        spdlog::info("逐出纹理 '{}'：{:.1f} KB，{} 帧未使用，耗时 {:.3f} ms（显存 {:.1f} / {:.1f} MB）",
+                     evicted_[id], bytes / 1024.0, frame - last_used, elapsed.count(),
+                     total_bytes_ / (1024.0 * 1024.0), budget_bytes_ / (1024.0 * 1024.0));
+    }
+    if (total_bytes_ > budget_bytes_) {
+        spdlog::warn("纹理显存 {:.1f} MB 超出预算 {:.1f} MB，但剩余的纹理都在使用中",
+                     total_bytes_ / (1024.0 * 1024.0), budget_bytes_ / (1024.0 * 1024.0));
+    }
+}
+
+TextureManager::TextureEntry* TextureManager::touch(entt::id_type id) {
+    auto it = textures_.find(id);
+    if (it == textures_.end()) {
+        return nullptr;
+    }
+    auto& entry = it->second;
+    entry.last_used_ = frame_;
+    // 只在作用域切换后的第一次使用时查找作用域，平时只是一次整数比较
+    if (active_scope_ && entry.scope_serial_ != active_scope_->getSerial()) {
+        entry.scope_serial_ = active_scope_->getSerial();
+        if (active_scope_->addTexture(id)) {
+            ++entry.ref_count_;
+        }
+    }
+    return &entry;
+}
+
+SDL_Texture* TextureManager::insert(entt::id_type id, std::string_view file_path, SDL_Texture* texture, double load_ms) {
+    TextureEntry entry;
+    entry.texture_.reset(texture);
+    entry.path_ = std::string(file_path);
+    // SDL3 中 SDL_Texture 的格式与尺寸是公开的只读字段
+    entry.bytes_ = static_cast<size_t>(texture->w) * static_cast<size_t>(texture->h) * SDL_BYTESPERPIXEL(texture->format);
+    total_bytes_ += entry.bytes_;
+    textures_.emplace(id, std::move(entry));
+
+    if (auto it = evicted_.find(id); it != evicted_.end()) {
+        evicted_.erase(it);
+        ++reload_count_;
+        spdlog::info("重新载入被逐出的纹理 '{}'：耗时 {:.3f} ms", file_path, load_ms);
+    } else {
+        spdlog::debug("成功加载并缓存纹理: {}（{:.3f} ms）", file_path, load_ms);
+    }
+    touch(id);      // 登记到活动作用域
+    return texture;
 }
 
 } // namespace engine::resource
@@ -1,5 +1,7 @@
 #pragma once
+#include <cstdint>
 #include <memory>
+#include <string>
 #include <unordered_map>
 #include <string_view>
 #include <SDL3/SDL_render.h>
@@ -8,11 +10,18 @@
 
 namespace engine::resource {
 
+class AssetArchive;
+class ResourceScope;
+
 /**
  * @brief 管理 SDL_Texture 资源的加载、存储和检索。
  *
  * 在构造时初始化。使用文件路径作为键，确保纹理只加载一次并正确释放。
  * 依赖于一个有效的 SDL_Renderer，构造失败会抛出异常。
+ *
+ * 每个纹理有一个引用计数：活动的资源作用域（通常属于当前场景）第一次用到某个纹理时持有一个引用，
+ * 作用域释放时归还。显存超出预算时，在帧末按最近使用时间逐出没有引用的纹理；
+ * 被逐出的纹理保留路径，再次使用时自动重新载入。
  */
 class TextureManager final{
     friend class ResourceManager;
@@ -27,10 +36,29 @@ private:
         }
     };
 
-    // 存储文件路径和指向管理纹理的 unique_ptr 的映射。(容器的键不可使用entt::hashed_string)
-    std::unordered_map<entt::id_type, std::unique_ptr<SDL_Texture, SDLTextureDeleter>> textures_;
+    /// @brief 缓存的纹理
+    struct TextureEntry {
+        std::unique_ptr<SDL_Texture, SDLTextureDeleter> texture_;
+        std::string path_;                  ///< @brief 文件路径（逐出后重新载入用）
+        size_t bytes_{0};                   ///< @brief 显存估算值
+        int ref_count_{0};                  ///< @brief 持有该纹理的作用域数量
+        std::uint64_t last_used_{0};        ///< @brief 最近一次使用的帧序号
+        std::uint32_t scope_serial_{0};     ///< @brief 最近一次登记到的作用域序号（避免每次使用都查找作用域）
+    };
+
+    // 存储文件路径和纹理条目的映射。(容器的键不可使用entt::hashed_string)
+    std::unordered_map<entt::id_type, TextureEntry> textures_;
+    std::unordered_map<entt::id_type, std::string> evicted_;    ///< @brief 被逐出的纹理 -> 文件路径
 
     SDL_Renderer* renderer_ = nullptr; // 指向主渲染器的非拥有指针
+    const AssetArchive* archive_ = nullptr;    ///< @brief 资源包（非拥有，为空时从散文件加载）
+    ResourceScope* active_scope_ = nullptr;    ///< @brief 活动的资源作用域（非拥有，为空时不登记）
+
+    std::uint64_t frame_{1};            ///< @brief 帧序号（collectGarbage 时递增）
+    size_t total_bytes_{0};             ///< @brief 所有纹理的显存估算值
+    size_t budget_bytes_{0};            ///< @brief 显存预算（0 = 不限制）
+    size_t eviction_count_{0};          ///< @brief 累计逐出次数
+    size_t reload_count_{0};            ///< @brief 累计重新载入次数
 
 public:
     /**
@@ -66,6 +94,16 @@ private: // 仅供 ResourceManager 访问的方法
      * @note 如果纹理未加载，则从字符串对应的文件路径加载纹理，并返回加载的纹理的指针
      */
     SDL_Texture* loadTexture(entt::hashed_string str_hs);
+
+    /**
+     * @brief 用已解码的图片创建纹理（图片可以在工作线程中预先解码，纹理必须在主线程创建）
+     * @param id 纹理的唯一标识符, 通过entt::hashed_string生成
+     * @param file_path 纹理文件的路径（用于日志）
+     * @param surface 已解码的图片（不获取所有权）
+     * @return 加载的纹理的指针
+     * @note 如果纹理已经加载，则直接返回已加载的纹理的指针
+     */
+    SDL_Texture* loadTexture(entt::id_type id, std::string_view file_path, SDL_Surface* surface);
     
     /**
      * @brief 获取纹理
@@ -114,6 +152,28 @@ private: // 仅供 ResourceManager 访问的方法
      * @brief 清空所有纹理资源
      */
     void clearTextures();
+
+    void setArchive(const AssetArchive* archive) { archive_ = archive; }   ///< @brief 设置资源包，包中存在的纹理优先从包中加载
+    size_t getTextureCount() const { return textures_.size(); }    ///< @brief 已加载的纹理数量
+    size_t getTextureBytes() const { return total_bytes_; }        ///< @brief 所有纹理占用的显存估算值（宽 x 高 x 每像素字节数）
+    size_t getReferencedCount() const;                              ///< @brief 被作用域引用的纹理数量
+
+    // --- 生命周期管理 ---
+    void setActiveScope(ResourceScope* scope) { active_scope_ = scope; }   ///< @brief 设置活动的资源作用域
+    void setBudget(size_t bytes) { budget_bytes_ = bytes; }                ///< @brief 设置显存预算（0 = 不限制）
+    void acquire(entt::id_type id);     ///< @brief 增加引用计数
+    void release(entt::id_type id);     ///< @brief 减少引用计数（归零后可被逐出，但不会立即释放）
+
+    /**
+     * @brief 帧末调用：显存超出预算时，按最近使用时间逐出没有引用的纹理
+     * @note 必须在本帧呈现（Renderer::present）之后调用，Renderer 在一帧内会缓存纹理指针
+     */
+    void collectGarbage();
+
+    /// @brief 查找纹理条目，找到时记录使用时间并登记到活动作用域
+    TextureEntry* touch(entt::id_type id);
+    /// @brief 创建纹理条目（统计显存，记录重新载入）
+    SDL_Texture* insert(entt::id_type id, std::string_view file_path, SDL_Texture* texture, double load_ms);
 };
 
 } // namespace engine::resource
@@ -2,6 +2,8 @@
 #include "scene_manager.h"
 #include "engine/core/context.h"
 #include "engine/ui/ui_manager.h"
+#include "engine/resource/resource_manager.h"
+#include "engine/resource/resource_scope.h"
 #include "engine/utils/events.h"
 #include <spdlog/spdlog.h>
 #include <entt/signal/dispatcher.hpp>
@@ -12,6 +14,7 @@ Scene::Scene(std::string_view name, engine::core::Context& context)
     : scene_name_(name),
       context_(context), 
       ui_manager_(std::make_unique<engine::ui::UIManager>()),
+      resource_scope_(std::make_unique<engine::resource::ResourceScope>(context.getResourceManager(), name)),
       is_initialized_(false) {
     spdlog::trace("场景 '{}' 构造完成。", scene_name_);
 }
@@ -43,6 +46,7 @@ void Scene::clean() {
     if (!is_initialized_) return;
     
     registry_.clear();
+    resource_scope_->release();     // 归还场景用到的资源的引用（资源在超出预算时才会被逐出）
     is_initialized_ = false;        // 清理完成后，设置场景为未初始化
     spdlog::trace("场景 '{}' 清理完成。", scene_name_);
 }
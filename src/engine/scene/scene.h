@@ -12,6 +12,10 @@ namespace engine::ui {
     class UIManager;
 }
 
+namespace engine::resource {
+    class ResourceScope;
+}
+
 namespace engine::scene {
     class SceneManager;
 
@@ -26,6 +30,7 @@ protected:
     std::string scene_name_;                            ///< @brief 场景名称
     engine::core::Context& context_;                    ///< @brief 上下文引用（隐式，构造时传入）
     std::unique_ptr<engine::ui::UIManager> ui_manager_; ///< @brief UI管理器(初始化时自动创建)
+    std::unique_ptr<engine::resource::ResourceScope> resource_scope_;   ///< @brief 场景使用的资源（clean 时释放引用）
     entt::registry registry_;                           ///< @brief ECS注册表
     
     bool is_initialized_ = false;                       ///< @brief 场景是否已初始化(非当前场景很可能未被删除，因此需要初始化标志避免重复初始化)
@@ -54,6 +59,12 @@ public:
     virtual void render();                      ///< @brief 渲染场景。
     virtual void clean();                       ///< @brief 清理场景。
 
+    /**
+     * @brief 场景是否可以切换进来（例如后台预加载是否完成）。
+     * @note 返回 false 时 SceneManager 保留挂起的切换操作，当前场景继续运行，每帧重新检查。
+     */
+    virtual bool isReady() const { return true; }
+
     /// @brief 请求弹出当前场景。
     void requestPopScene();
 
@@ -74,6 +85,7 @@ public:
     entt::registry& getRegistry() { return registry_; }                      ///< @brief 获取注册表引用
 
     engine::core::Context& getContext() const { return context_; }                  ///< @brief 获取上下文引用
+    engine::resource::ResourceScope& getResourceScope() { return *resource_scope_; }    ///< @brief 获取场景的资源作用域
 
 };
 
@@ -1,6 +1,7 @@
 #include "scene_manager.h"
 #include "scene.h"
 #include "engine/core/context.h"
+#include "engine/resource/resource_manager.h"
 #include <spdlog/spdlog.h>
 #include <entt/signal/dispatcher.hpp>
 
@@ -56,6 +57,7 @@ void SceneManager::close() {
         }
         scene_stack_.pop_back();
     }
+    pending_scene_.reset();     // 场景持有资源作用域，必须在资源管理器之前销毁（销毁的作用域会自动取消活动状态）
     // 断开事件处理函数 (一次断开所有和当前实例绑定的回调函数)
     context_.getDispatcher().disconnect(this);
 }
@@ -81,6 +83,10 @@ void SceneManager::processPendingActions()
     if (pending_action_ == PendingAction::None) {
         return;
     }
+    // 待切换的场景尚未就绪（如后台预加载未完成）时，保持挂起，当前场景继续运行
+    if (pending_scene_ && !pending_scene_->isReady()) {
+        return;
+    }
 
     switch (pending_action_) {
         case PendingAction::Pop:
@@ -106,19 +112,22 @@ void SceneManager::pushScene(std::unique_ptr<Scene>&& scene) {
     }
     spdlog::debug("正在将场景 '{}' 压入栈。", scene->getName());
 
-    // 初始化新场景
+    // 初始化新场景（初始化期间载入的资源登记到新场景的作用域）
     if (!scene->isInitialized()) { // 确保只初始化一次
+        context_.getResourceManager().setActiveScope(&scene->getResourceScope());
         if (!scene->init()) {
             spdlog::error("场景 '{}' 初始化失败。", scene->getName());
             // 场景初始化失败则退出游戏
             context_.getDispatcher().trigger<engine::utils::QuitEvent>();
             scene->clean();
+            updateActiveResourceScope();
             return;
         }
     }
 
     // 将新场景移入栈顶
     scene_stack_.push_back(std::move(scene));
+    updateActiveResourceScope();
 }
 
 void SceneManager::popScene() {
@@ -133,6 +142,7 @@ void SceneManager::popScene() {
         scene_stack_.back()->clean();       // 显式调用清理
     }
     scene_stack_.pop_back();
+    updateActiveResourceScope();
     if (scene_stack_.empty()) {
         spdlog::warn("弹出最后一个场景，退出游戏。");
         context_.getDispatcher().trigger<engine::utils::QuitEvent>();
@@ -154,18 +164,27 @@ void SceneManager::replaceScene(std::unique_ptr<Scene>&& scene) {
         scene_stack_.pop_back();
     }
 
-    // 初始化新场景
+    // 初始化新场景（初始化期间载入的资源登记到新场景的作用域）
     if (!scene->isInitialized()) {
+        context_.getResourceManager().setActiveScope(&scene->getResourceScope());
         if (!scene->init()) {
             spdlog::error("场景 '{}' 初始化失败。", scene->getName());
             context_.getDispatcher().trigger<engine::utils::QuitEvent>();
             scene->clean();
+            updateActiveResourceScope();
             return;
         }
     }
 
     // 将新场景压入栈顶
     scene_stack_.push_back(std::move(scene));
+    updateActiveResourceScope();
+}
+
+void SceneManager::updateActiveResourceScope() {
+    // 栈顶场景的作用域为活动作用域（下层场景继续渲染时用到的资源也会登记到栈顶场景）
+    Scene* current_scene = getCurrentScene();
+    context_.getResourceManager().setActiveScope(current_scene ? &current_scene->getResourceScope() : nullptr);
 }
 
 } // namespace engine::scene
\ No newline at end of file
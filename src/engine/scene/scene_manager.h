@@ -56,6 +56,7 @@ private:
     void pushScene(std::unique_ptr<Scene>&& scene);         ///< @brief 将一个新场景压入栈顶，使其成为活动场景。
     void popScene();                                        ///< @brief 移除栈顶场景。
     void replaceScene(std::unique_ptr<Scene>&& scene);      ///< @brief 清理场景栈所有场景，将此场景设为栈顶场景。
+    void updateActiveResourceScope();                       ///< @brief 把栈顶场景的资源作用域设为活动作用域。
     
 };
 
@@ -1,6 +1,8 @@
 #include "animation_system.h"
+#include "engine/debug/alloc_tracker.h"
 #include "engine/component/animation_component.h"
 #include "engine/component/sprite_component.h"
+#include "engine/defs/tags.h"
 #include <entt/entity/registry.hpp>
 #include <entt/signal/dispatcher.hpp>
 
@@ -16,7 +18,9 @@ AnimationSystem::~AnimationSystem() {
 }
 
 void AnimationSystem::update(float dt) {
+    ENGINE_ALLOC_SCOPE("AnimationSystem");
     auto view = registry_.view<engine::component::AnimationComponent, engine::component::SpriteComponent>();
+    const auto& visible = registry_.storage<engine::defs::VisibleTag>();
     for (auto entity : view) {
         auto& anim_component = view.get<engine::component::AnimationComponent>(entity);
         auto& sprite_component = view.get<engine::component::SpriteComponent>(entity);
@@ -41,7 +45,9 @@ void AnimationSystem::update(float dt) {
         const auto& current_frame = current_animation.frames_[anim_component.current_frame_index_];
 
         // 检查是否需要切换到下一帧
+        bool frame_changed = false;
         if (anim_component.current_time_ms_ >= current_frame.duration_ms_) {
+            frame_changed = true;
             anim_component.current_time_ms_ -= current_frame.duration_ms_;
             anim_component.current_frame_index_++;
 
@@ -65,6 +71,12 @@ void AnimationSystem::update(float dt) {
             }
         }
         
+        // 帧没有变化时只需同步上一帧可见的实体（可见性在渲染开始时才计算，本帧刚进入视口的实体
+        // 其源矩形在上一次换帧时已经写入）；屏幕外的实体只推进计时，换帧时才改写源矩形
+        if (!frame_changed && !visible.contains(entity)) {
+            continue;
+        }
+
         // 更新 SpriteComponent 的源矩形 （根据当前动画帧的源矩形信息）
         const auto& next_frame = current_animation.frames_[anim_component.current_frame_index_];
         sprite_component.sprite_.src_rect_ = next_frame.src_rect_;
@@ -77,7 +89,12 @@ void AnimationSystem::onPlayAnimationEvent(const engine::utils::PlayAnimationEve
         anim->current_animation_id_ = event.animation_id_;      // 替换动画ID
         anim->current_frame_index_ = 0;
         anim->current_time_ms_ = 0.0f;
-        anim->animations_.at(event.animation_id_).loop_ = event.loop_;
+        auto& animation = anim->animations_.at(event.animation_id_);
+        animation.loop_ = event.loop_;
+        // 立即同步第一帧的源矩形（屏幕外的实体在下一次换帧前不会再同步）
+        if (auto sprite = registry_.try_get<engine::component::SpriteComponent>(event.entity_); sprite && !animation.frames_.empty()) {
+            sprite->sprite_.src_rect_ = animation.frames_.front().src_rect_;
+        }
     }
 }
 
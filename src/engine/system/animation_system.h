@@ -9,6 +9,7 @@ namespace engine::system {
  * @brief 动画系统
  * 
  * 负责更新实体的动画组件，并同步到精灵组件。
+ * 只在换帧、切换动画时同步精灵的源矩形；帧不变时只重复同步上一帧可见（拥有 VisibleTag）的实体。
  */
 class AnimationSystem {
     // 将依赖保存为成员变量，方便回调函数使用
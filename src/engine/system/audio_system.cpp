@@ -1,10 +1,14 @@
 #include "audio_system.h"
 #include "engine/core/context.h"
 #include "engine/component/audio_component.h"
+#include "engine/component/transform_component.h"
+#include "engine/render/camera.h"
 #include "engine/audio/audio_player.h"
 #include <entt/entity/registry.hpp>
 #include <entt/signal/dispatcher.hpp>
 #include <entt/core/hashed_string.hpp>
+#include <glm/common.hpp>
+#include <glm/geometric.hpp>
 #include <spdlog/spdlog.h>
 
 using namespace entt::literals;
@@ -23,29 +27,48 @@ AudioSystem::AudioSystem(entt::registry& registry, engine::core::Context& contex
 }
 
 void AudioSystem::onPlaySoundEvent(const engine::utils::PlaySoundEvent& event) {
+    auto& audio_player = context_.getAudioPlayer();
     // 如果没有传入目标实体，则直接播放全局音效
     if (event.entity_ == entt::null) {
-        spdlog::info("播放全局音效: {}", event.sound_id_);
-        context_.getAudioPlayer().playSound(event.sound_id_);
+        spdlog::trace("播放全局音效: {}", event.sound_id_);
+        audio_player.playSound(event.sound_id_, event.priority_);
+        return;
     }
+
+    const float gain = getDistanceGain(event.entity_);
     // 如果有传入目标实体，且实体有音效组件
-    else if (auto audio_component = registry_.try_get<engine::component::AudioComponent>(event.entity_); audio_component) {
+    if (auto audio_component = registry_.try_get<engine::component::AudioComponent>(event.entity_); audio_component) {
         auto it = audio_component->sounds_.find(event.sound_id_);
         // 先尝试在目标实体的音效集合中查找
         if (it != audio_component->sounds_.end()) {
-            spdlog::info("实体 ID: {} 中找到了音效: {}", entt::to_integral(event.entity_), it->second);
-            context_.getAudioPlayer().playSound(it->second);
+            spdlog::trace("实体 ID: {} 中找到了音效: {}", entt::to_integral(event.entity_), it->second);
+            audio_player.playSound(it->second, event.priority_, gain);
         // 如果没找到，则播放全局音效
         } else {
-            spdlog::info("实体 ID: {} 中没有找到音效: {}", entt::to_integral(event.entity_), event.sound_id_);
-            context_.getAudioPlayer().playSound(event.sound_id_);
+            spdlog::trace("实体 ID: {} 中没有找到音效: {}", entt::to_integral(event.entity_), event.sound_id_);
+            audio_player.playSound(event.sound_id_, event.priority_, gain);
         }
     }
     // 如果有传入目标实体，但实体没有音效组件，也尝试播放全局音效
     else {
-        spdlog::info("实体 ID: {} 中没有音效组件，尝试播放全局音效: {}", entt::to_integral(event.entity_), event.sound_id_);
-        context_.getAudioPlayer().playSound(event.sound_id_);
+        spdlog::trace("实体 ID: {} 中没有音效组件，尝试播放全局音效: {}", entt::to_integral(event.entity_), event.sound_id_);
+        audio_player.playSound(event.sound_id_, event.priority_, gain);
     }
 }
 
+float AudioSystem::getDistanceGain(entt::entity entity) const {
+    const auto* transform = registry_.valid(entity) ? registry_.try_get<engine::component::TransformComponent>(entity) : nullptr;
+    if (!transform) return 1.0f;
+
+    // 到视口矩形的距离（视口内为0）
+    const auto& camera = context_.getCamera();
+    const glm::vec2 min = camera.getPosition();
+    const glm::vec2 max = min + camera.getViewportSize();
+    const glm::vec2 offset = glm::max(glm::max(min - transform->position_, transform->position_ - max), glm::vec2(0.0f));
+    const float distance = glm::length(offset);
+    if (distance >= MAX_DISTANCE) return 0.0f;
+    if (distance <= ATTENUATION_START) return 1.0f;
+    return 1.0f - (distance - ATTENUATION_START) / (MAX_DISTANCE - ATTENUATION_START);
+}
+
 } // namespace engine::system
\ No newline at end of file
@@ -10,16 +10,23 @@ namespace engine::system {
 
 /**
  * @brief 音频系统，负责处理播放音频事件。
+ *
+ * 带有位置的实体音效会按与相机视口的距离衰减，超出最大距离的直接剔除，
+ * 之后交给 AudioPlayer 的声部管理器决定是否真正播放。
  */
 class AudioSystem{
     entt::registry& registry_;
     engine::core::Context& context_;
 
 public:
+    static constexpr float ATTENUATION_START{64.0f};    ///< @brief 视口外开始衰减的距离
+    static constexpr float MAX_DISTANCE{320.0f};        ///< @brief 视口外超出该距离的音效不播放
+
     AudioSystem(entt::registry& registry, engine::core::Context& context);
     ~AudioSystem();
 
 private:
     void onPlaySoundEvent(const engine::utils::PlaySoundEvent& event);
+    float getDistanceGain(entt::entity entity) const;   ///< @brief 根据实体到视口的距离计算音量（无位置时为1）
 };
-} // namespace engine::system
\ No newline at end of file
+} // namespace engine::system
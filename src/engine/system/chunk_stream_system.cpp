@@ -0,0 +1,208 @@
+#include "chunk_stream_system.h"
+#include "engine/debug/alloc_tracker.h"
+#include "engine/defs/tags.h"
+#include "engine/render/camera.h"
+#include "engine/component/transform_component.h"
+#include "engine/component/sprite_component.h"
+#include "engine/component/render_component.h"
+#include "engine/component/animation_component.h"
+#include <algorithm>
+#include <stdexcept>
+#include <glm/common.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/core/hashed_string.hpp>
+#include <spdlog/spdlog.h>
+
+namespace engine::system {
+
+ChunkStreamSystem::ChunkStreamSystem(entt::registry& registry,
+                                     std::unique_ptr<engine::loader::TileChunkMap> chunk_map,
+                                     std::pmr::memory_resource& frame_resource)
+    : registry_(registry), frame_resource_(frame_resource), chunk_map_(std::move(chunk_map)) {
+    if (!chunk_map_) {
+        throw std::runtime_error("ChunkStreamSystem 构造失败: 分块瓦片地图为空。");
+    }
+    worker_ = std::jthread([this](std::stop_token stop_token) { workerLoop(stop_token); });
+    const auto chunk_count = chunk_map_->getChunkCount();
+    spdlog::info("区块流式加载系统启动，图层数: {}, 区块: {}x{}, 常驻gid数据: {} 字节",
+                 chunk_map_->getLayers().size(), chunk_count.x, chunk_count.y, chunk_map_->getResidentBytes());
+}
+
+ChunkStreamSystem::~ChunkStreamSystem() {
+    // 先停止后台线程，再销毁实体（jthread 析构也会自动停止，这里显式调用保证顺序清晰）
+    worker_.request_stop();
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+    // 场景清理时注册表可能已被清空，只销毁仍然有效的实体
+    for (auto& [key, entities] : resident_chunks_) {
+        for (auto entity : entities) {
+            if (registry_.valid(entity)) registry_.destroy(entity);
+        }
+    }
+}
+
+void ChunkStreamSystem::preload(const engine::render::Camera& camera) {
+    glm::ivec2 min_chunk, max_chunk;
+    if (!chunkRange(camera, LOAD_MARGIN, min_chunk, max_chunk)) return;
+    for (size_t layer = 0; layer < chunk_map_->getLayers().size(); ++layer) {
+        for (int y = min_chunk.y; y <= max_chunk.y; ++y) {
+            for (int x = min_chunk.x; x <= max_chunk.x; ++x) {
+                const auto key = makeKey(layer, glm::ivec2(x, y));
+                if (resident_chunks_.contains(key)) continue;
+                instantiateChunk(ChunkBuild{key, chunk_map_->collectChunk(layer, glm::ivec2(x, y))});
+            }
+        }
+    }
+    spdlog::info("预加载区块完成，区块数量: {}, 瓦片实体数量: {}", resident_chunks_.size(), getResidentTileCount());
+}
+
+void ChunkStreamSystem::update(const engine::render::Camera& camera) {
+    ENGINE_ALLOC_SCOPE("ChunkStreamSystem");
+    // 1. 提交相机附近尚未加载的区块
+    glm::ivec2 min_chunk, max_chunk;
+    if (chunkRange(camera, LOAD_MARGIN, min_chunk, max_chunk)) {
+        std::pmr::vector<std::uint64_t> new_requests(&frame_resource_);   // 帧内临时容器
+        for (size_t layer = 0; layer < chunk_map_->getLayers().size(); ++layer) {
+            for (int y = min_chunk.y; y <= max_chunk.y; ++y) {
+                for (int x = min_chunk.x; x <= max_chunk.x; ++x) {
+                    const auto key = makeKey(layer, glm::ivec2(x, y));
+                    if (resident_chunks_.contains(key) || pending_chunks_.contains(key)) continue;
+                    pending_chunks_.insert(key);
+                    new_requests.push_back(key);
+                }
+            }
+        }
+        if (!new_requests.empty()) {
+            {
+                std::lock_guard lock(mutex_);
+                requests_.insert(requests_.end(), new_requests.begin(), new_requests.end());
+            }
+            condition_.notify_one();
+        }
+    }
+
+    // 2. 取出后台线程准备好的区块，每帧最多实例化 MAX_CHUNKS_PER_FRAME 个
+    std::pmr::vector<ChunkBuild> ready(&frame_resource_);
+    {
+        std::lock_guard lock(mutex_);
+        const auto count = std::min<size_t>(finished_.size(), MAX_CHUNKS_PER_FRAME);
+        ready.assign(std::make_move_iterator(finished_.begin()), std::make_move_iterator(finished_.begin() + count));
+        finished_.erase(finished_.begin(), finished_.begin() + count);
+    }
+    glm::ivec2 keep_min, keep_max;
+    const bool keep_valid = chunkRange(camera, UNLOAD_MARGIN, keep_min, keep_max);
+    for (const auto& build : ready) {
+        pending_chunks_.erase(build.key_);
+        // 准备期间相机已经远离的区块直接丢弃
+        const auto chunk = keyChunk(build.key_);
+        if (!keep_valid || glm::any(glm::lessThan(chunk, keep_min)) || glm::any(glm::greaterThan(chunk, keep_max))) continue;
+        instantiateChunk(build);
+    }
+
+    // 3. 卸载远处的区块
+    unloadFarChunks(camera);
+}
+
+size_t ChunkStreamSystem::getResidentTileCount() const {
+    size_t count = 0;
+    for (const auto& [key, entities] : resident_chunks_) {
+        count += entities.size();
+    }
+    return count;
+}
+
+void ChunkStreamSystem::workerLoop(std::stop_token stop_token) {
+    while (!stop_token.stop_requested()) {
+        std::uint64_t key = 0;
+        {
+            std::unique_lock lock(mutex_);
+            // 等待新的请求或停止信号 (stop_token 被请求停止时会自动唤醒)
+            if (!condition_.wait(lock, stop_token, [this] { return !requests_.empty(); })) {
+                return;
+            }
+            key = requests_.front();
+            requests_.pop_front();
+        }
+        // 在锁外准备区块数据（TileChunkMap 载入后只读，可安全并发读取）
+        ChunkBuild build{key, chunk_map_->collectChunk(keyLayer(key), keyChunk(key))};
+        std::lock_guard lock(mutex_);
+        finished_.push_back(std::move(build));
+    }
+}
+
+bool ChunkStreamSystem::chunkRange(const engine::render::Camera& camera, int margin, glm::ivec2& min_chunk, glm::ivec2& max_chunk) const {
+    const auto chunk_world_size = chunk_map_->getChunkWorldSize();
+    const auto chunk_count = chunk_map_->getChunkCount();
+    if (chunk_count.x <= 0 || chunk_count.y <= 0 || chunk_world_size.x <= 0.0f || chunk_world_size.y <= 0.0f) return false;
+
+    const auto view_min = camera.getPosition();
+    const auto view_max = view_min + camera.getViewportSize();
+    min_chunk = glm::ivec2(glm::floor(view_min / chunk_world_size)) - glm::ivec2(margin);
+    max_chunk = glm::ivec2(glm::floor(view_max / chunk_world_size)) + glm::ivec2(margin);
+    // 相机完全在地图外
+    if (glm::any(glm::greaterThanEqual(min_chunk, chunk_count)) || glm::any(glm::lessThan(max_chunk, glm::ivec2(0)))) return false;
+
+    min_chunk = glm::clamp(min_chunk, glm::ivec2(0), chunk_count - glm::ivec2(1));
+    max_chunk = glm::clamp(max_chunk, glm::ivec2(0), chunk_count - glm::ivec2(1));
+    return true;
+}
+
+void ChunkStreamSystem::instantiateChunk(const ChunkBuild& build) {
+    const auto& layer = chunk_map_->getLayers()[keyLayer(build.key_)];
+    // 只为有瓦片信息的瓦片创建实体（载入时已经过滤，这里只做保护），避免留下没有组件的实体
+    const auto tile_count = static_cast<size_t>(std::count_if(build.tiles_.begin(), build.tiles_.end(),
+        [this](const auto& tile) { return chunk_map_->getTileInfo(tile.gid_) != nullptr; }));
+    std::vector<entt::entity> entities(tile_count);
+    registry_.create(entities.begin(), entities.end());     // 批量创建实体
+
+    // 与 BasicEntityBuilder 中瓦片的构建方式保持一致
+    const auto animation_id = entt::hashed_string("tile");
+    size_t next = 0;
+    for (const auto& tile : build.tiles_) {
+        const auto* tile_info = chunk_map_->getTileInfo(tile.gid_);
+        if (!tile_info) continue;
+        const auto entity = entities[next++];
+        registry_.emplace<engine::component::SpriteComponent>(entity, tile_info->sprite_);
+        registry_.emplace<engine::component::TransformComponent>(entity, tile.position_);
+        registry_.emplace<engine::component::RenderComponent>(entity, layer.render_layer_, tile.position_.y);
+        if (tile_info->animation_) {
+            std::unordered_map<entt::id_type, engine::component::Animation> animations;
+            animations.emplace(animation_id, tile_info->animation_.value());
+            registry_.emplace<engine::component::AnimationComponent>(entity, std::move(animations), animation_id);
+        }
+        registry_.emplace<engine::defs::StaticTag>(entity);     // VisibilitySystem 据此把瓦片增量插入空间索引
+    }
+    resident_chunks_.emplace(build.key_, std::move(entities));
+}
+
+void ChunkStreamSystem::unloadFarChunks(const engine::render::Camera& camera) {
+    glm::ivec2 keep_min, keep_max;
+    const bool keep_valid = chunkRange(camera, UNLOAD_MARGIN, keep_min, keep_max);
+    for (auto it = resident_chunks_.begin(); it != resident_chunks_.end();) {
+        const auto chunk = keyChunk(it->first);
+        if (keep_valid && glm::all(glm::greaterThanEqual(chunk, keep_min)) && glm::all(glm::lessThanEqual(chunk, keep_max))) {
+            ++it;
+            continue;
+        }
+        registry_.destroy(it->second.begin(), it->second.end());
+        it = resident_chunks_.erase(it);
+    }
+}
+
+std::uint64_t ChunkStreamSystem::makeKey(size_t layer_index, glm::ivec2 chunk) {
+    // 16位图层 + 24位区块x + 24位区块y
+    return (static_cast<std::uint64_t>(layer_index) << 48) |
+           (static_cast<std::uint64_t>(chunk.x & 0xFFFFFF) << 24) |
+           static_cast<std::uint64_t>(chunk.y & 0xFFFFFF);
+}
+
+size_t ChunkStreamSystem::keyLayer(std::uint64_t key) {
+    return static_cast<size_t>(key >> 48);
+}
+
+glm::ivec2 ChunkStreamSystem::keyChunk(std::uint64_t key) {
+    return glm::ivec2(static_cast<int>((key >> 24) & 0xFFFFFF), static_cast<int>(key & 0xFFFFFF));
+}
+
+} // namespace engine::system
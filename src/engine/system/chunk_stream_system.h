@@ -0,0 +1,111 @@
+#pragma once
+#include "engine/loader/tile_chunk_map.h"
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <stop_token>
+#include <condition_variable>
+#include <unordered_map>
+#include <unordered_set>
+#include <entt/entity/fwd.hpp>
+
+namespace engine::render {
+    class Camera;
+}
+
+namespace engine::system {
+
+/**
+ * @brief 区块流式加载系统
+ *
+ * 持有 TileChunkMap，根据相机位置决定哪些区块需要常驻：
+ * 1. 相机附近（视口外扩 LOAD_MARGIN 个区块）尚未加载的区块，提交给后台线程准备瓦片数据；
+ * 2. 主线程每帧最多实例化 MAX_CHUNKS_PER_FRAME 个准备好的区块（注册表不是线程安全的，实体只能在主线程创建）；
+ * 3. 超出 UNLOAD_MARGIN 个区块的已加载区块被销毁，因此常驻实体数量只与视口大小有关，与地图大小无关。
+ */
+class ChunkStreamSystem {
+    /// @brief 后台线程准备好的区块
+    struct ChunkBuild {
+        std::uint64_t key_{0};
+        std::vector<engine::loader::TileInstance> tiles_;
+    };
+
+    entt::registry& registry_;
+    std::pmr::memory_resource& frame_resource_;                    ///< @brief 帧内临时容器使用的内存（通常是 FrameArena）
+    std::unique_ptr<engine::loader::TileChunkMap> chunk_map_;      ///< @brief 分块瓦片地图（载入后只读，后台线程也会访问）
+
+    std::unordered_map<std::uint64_t, std::vector<entt::entity>> resident_chunks_;  ///< @brief 已实例化的区块 -> 瓦片实体
+    std::unordered_set<std::uint64_t> pending_chunks_;             ///< @brief 已提交给后台线程、尚未实例化的区块
+
+    // --- 与后台线程共享的数据（由 mutex_ 保护） ---
+    std::mutex mutex_;
+    std::condition_variable_any condition_;
+    std::deque<std::uint64_t> requests_;                           ///< @brief 待准备的区块
+    std::vector<ChunkBuild> finished_;                             ///< @brief 已准备好的区块
+
+    std::jthread worker_;                                          ///< @brief 后台线程（析构时自动请求停止并等待结束）
+
+public:
+    static constexpr int LOAD_MARGIN{1};            ///< @brief 视口外预加载的区块圈数
+    static constexpr int UNLOAD_MARGIN{2};          ///< @brief 超出视口该圈数的区块才卸载（大于LOAD_MARGIN，避免在边界处反复加载）
+    static constexpr int MAX_CHUNKS_PER_FRAME{2};   ///< @brief 每帧最多实例化的区块数量，保证帧时间平稳
+
+    /**
+     * @brief 构造函数
+     * @param registry 注册表
+     * @param chunk_map 分块瓦片地图
+     * @param frame_resource 帧内临时容器使用的内存（默认使用全局堆）
+     */
+    ChunkStreamSystem(entt::registry& registry,
+                      std::unique_ptr<engine::loader::TileChunkMap> chunk_map,
+                      std::pmr::memory_resource& frame_resource = *std::pmr::get_default_resource());
+    ~ChunkStreamSystem();
+
+    // 禁止拷贝和移动
+    ChunkStreamSystem(const ChunkStreamSystem&) = delete;
+    ChunkStreamSystem& operator=(const ChunkStreamSystem&) = delete;
+    ChunkStreamSystem(ChunkStreamSystem&&) = delete;
+    ChunkStreamSystem& operator=(ChunkStreamSystem&&) = delete;
+
+    /**
+     * @brief 在主线程中同步加载相机附近的所有区块（场景初始化时调用，避免首帧缺失地面）
+     * @param camera 相机
+     */
+    void preload(const engine::render::Camera& camera);
+
+    /**
+     * @brief 根据相机位置提交加载请求、实例化准备好的区块、卸载远处的区块
+     * @param camera 相机
+     */
+    void update(const engine::render::Camera& camera);
+
+    size_t getResidentChunkCount() const { return resident_chunks_.size(); }    ///< @brief 已实例化的区块数量
+    size_t getResidentTileCount() const;                                         ///< @brief 已实例化的瓦片实体数量
+    const engine::loader::TileChunkMap& getChunkMap() const { return *chunk_map_; }
+
+private:
+    void workerLoop(std::stop_token stop_token);                    ///< @brief 后台线程：从请求队列取出区块并准备瓦片数据
+
+    /**
+     * @brief 计算相机附近的区块范围（包含两端）
+     * @param camera 相机
+     * @param margin 视口外扩的区块圈数
+     * @param min_chunk 输出：最小区块坐标
+     * @param max_chunk 输出：最大区块坐标
+     * @return 范围是否有效（相机完全在地图外则无效）
+     */
+    bool chunkRange(const engine::render::Camera& camera, int margin, glm::ivec2& min_chunk, glm::ivec2& max_chunk) const;
+
+    void instantiateChunk(const ChunkBuild& build);                 ///< @brief 在主线程中为区块创建瓦片实体
+    void unloadFarChunks(const engine::render::Camera& camera);     ///< @brief 卸载远处的区块
+
+    static std::uint64_t makeKey(size_t layer_index, glm::ivec2 chunk);
+    static size_t keyLayer(std::uint64_t key);
+    static glm::ivec2 keyChunk(std::uint64_t key);
+};
+
+} // namespace engine::system
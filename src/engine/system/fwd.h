@@ -9,5 +9,7 @@ class AnimationSystem;
 class MovementSystem;
 class YSortSystem;
 class AudioSystem;
+class VisibilitySystem;
+class ChunkStreamSystem;
 
 }   // namespace engine::system
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "movement_system.h"
+#include "engine/debug/alloc_tracker.h"
 #include "engine/component/velocity_component.h"
 #include "engine/component/transform_component.h"
 #include <spdlog/spdlog.h>
@@ -6,6 +7,7 @@
 namespace engine::system {
 
 void MovementSystem::update(entt::registry& registry, float delta_time) {
+    ENGINE_ZERO_ALLOC_SCOPE("MovementSystem");
     spdlog::trace("MovementSystem::update");
     // 获取感兴趣的实体 view
     auto view = registry.view<engine::component::VelocityComponent, engine::component::TransformComponent>();
@@ -1,34 +1,64 @@
 #include "render_system.h"
+#include "visibility_system.h"
+#include "engine/debug/alloc_tracker.h"
 #include "engine/render/renderer.h"
 #include "engine/render/camera.h"
 #include "engine/component/transform_component.h"
 #include "engine/component/sprite_component.h"
 #include "engine/component/render_component.h"
+#include "engine/defs/tags.h"
 #include <spdlog/spdlog.h>
 
 namespace engine::system {
 
-void RenderSystem::update(entt::registry& registry, render::Renderer& renderer, const render::Camera& camera) {
+namespace {
+
+/// @brief 绘制一个实体（位置 = 变换组件的位置 + 精灵的偏移，大小 = 精灵的大小 * 变换组件的缩放）
+void drawEntity(render::Renderer& renderer, const render::Camera& camera, const component::RenderComponent& render,
+                const component::TransformComponent& transform, const component::SpriteComponent& sprite) {
+    auto position = transform.position_ + sprite.offset_;
+    auto size = sprite.size_ * transform.scale_;
+    // 绘制时应用Render组件中的颜色调整参数
+    renderer.drawSprite(camera, sprite.sprite_, position, size, transform.rotation_, render.color_);
+}
+
+} // namespace
+
+void RenderSystem::update(entt::registry& registry, render::Renderer& renderer, const render::Camera& camera, const VisibilitySystem& visibility) {
+    ENGINE_ZERO_ALLOC_SCOPE("RenderSystem");
     spdlog::trace("RenderSystem::update");
 
-    // 对 RenderComponent storage 排序，比较规则由 RenderComponent::operator< 定义。
-    registry.sort<component::RenderComponent>([](const auto& lhs, const auto& rhs) {
-        return lhs < rhs;
+    // 只对可见的动态实体（VisibilitySystem 的输出）排序，比较规则由 RenderComponent::operator< 定义。
+    // VisibleTag 是空类型，比较函数接收的是实体，因此需要自行获取 RenderComponent。
+    registry.sort<defs::VisibleTag>([&registry](const entt::entity lhs, const entt::entity rhs) {
+        return registry.get<component::RenderComponent>(lhs) < registry.get<component::RenderComponent>(rhs);
     });
 
+    // 静态实体已由 VisibilitySystem 排好序，按顺序插入到动态实体之间（顺序相同时静态实体先绘制）
+    const auto& static_visible = visibility.getStaticVisible();
+    auto static_it = static_visible.begin();
+    auto drawStaticUntil = [&](const component::RenderComponent* limit) {
+        for (; static_it != static_visible.end(); ++static_it) {
+            if (limit && (static_it->layer_ == limit->layer ? static_it->depth_ > limit->depth : static_it->layer_ > limit->layer)) break;
+            const auto [render, transform, sprite] = registry.get<component::RenderComponent,
+                component::TransformComponent, component::SpriteComponent>(static_it->entity_);
+            drawEntity(renderer, camera, render, transform, sprite);
+        }
+    };
+
     // EnTT 的 view 默认会选择元素最少的 storage 驱动迭代。
-    // 显式指定使用 RenderComponent，才能保证遍历顺序与上面的排序一致。
-    auto view = registry.view<component::RenderComponent, component::TransformComponent, component::SpriteComponent>();
-    view.use<component::RenderComponent>();
+    // 显式指定使用 VisibleTag，才能保证遍历顺序与上面的排序一致。
+    auto view = registry.view<defs::VisibleTag, component::RenderComponent, component::TransformComponent, component::SpriteComponent>();
+    view.use<defs::VisibleTag>();
     for (auto entity : view) {
         const auto& render = view.get<component::RenderComponent>(entity);
-        const auto& transform = view.get<component::TransformComponent>(entity);
-        const auto& sprite = view.get<component::SpriteComponent>(entity);
-        auto position = transform.position_ + sprite.offset_;   // 位置 = 变换组件的位置 + 精灵的偏移
-        auto size = sprite.size_ * transform.scale_;            // 大小 = 精灵的大小 * 变换组件的缩放
-        // 绘制时应用Render组件中的颜色调整参数
-        renderer.drawSprite(camera, sprite.sprite_, position, size, transform.rotation_, render.color_);
+        drawStaticUntil(&render);
+        // 跟随鼠标的实体按渲染前重新采样的鼠标位置修正
+        renderer.setFollowCursor(registry.all_of<defs::FollowCursorTag>(entity));
+        drawEntity(renderer, camera, render, view.get<component::TransformComponent>(entity), view.get<component::SpriteComponent>(entity));
+        renderer.setFollowCursor(false);
     }
+    drawStaticUntil(nullptr);
 }
 
 } // namespace engine::system 
@@ -7,12 +7,14 @@ namespace engine::render {
 }
 
 namespace engine::system {
+class VisibilitySystem;
 
 /**
  * @brief 渲染系统
  * 
- * 负责遍历所有带有 TransformComponent 和 SpriteComponent 的实体，
- * 并使用 Renderer 将它们绘制到屏幕上。
+ * 负责遍历所有带有 TransformComponent 和 SpriteComponent 的可见实体（由 VisibilitySystem 计算），
+ * 并使用 Renderer 将它们绘制到屏幕上。可见的动态实体（VisibleTag）每帧排序，
+ * 可见的静态实体使用 VisibilitySystem 缓存的已排序列表，两者按绘制顺序归并。
  */
 class RenderSystem {
 public:
@@ -22,8 +24,9 @@ public:
      * @param registry entt::registry 的引用
      * @param renderer Renderer 的引用
      * @param camera Camera 的引用
+     * @param visibility 本帧已更新过的可见性系统
      */
-    void update(entt::registry& registry, render::Renderer& renderer, const render::Camera& camera);
+    void update(entt::registry& registry, render::Renderer& renderer, const render::Camera& camera, const VisibilitySystem& visibility);
 };
 
 } // namespace engine::system 
\ No newline at end of file
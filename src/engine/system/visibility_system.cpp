@@ -0,0 +1,240 @@
+#include "visibility_system.h"
+#include "engine/debug/alloc_tracker.h"
+#include "engine/defs/tags.h"
+#include "engine/render/camera.h"
+#include "engine/component/transform_component.h"
+#include "engine/component/sprite_component.h"
+#include "engine/component/render_component.h"
+#include <algorithm>
+#include <cmath>
+#include <glm/common.hpp>
+#include <entt/entity/registry.hpp>
+#include <spdlog/spdlog.h>
+
+namespace engine::system {
+
+namespace {
+
+/// @brief 计算实体的世界矩形（与RenderSystem中的绘制位置、大小保持一致）
+engine::utils::Rect worldRect(const engine::component::TransformComponent& transform,
+                              const engine::component::SpriteComponent& sprite) {
+    return engine::utils::Rect{transform.position_ + sprite.offset_, sprite.size_ * transform.scale_};
+}
+
+/// @brief 两个矩形是否相交 (AABB)
+bool overlaps(const engine::utils::Rect& a, const engine::utils::Rect& b) {
+    return a.position.x + a.size.x >= b.position.x && a.position.x <= b.position.x + b.size.x &&
+           a.position.y + a.size.y >= b.position.y && a.position.y <= b.position.y + b.size.y;
+}
+
+} // namespace
+
+VisibilitySystem::VisibilitySystem(entt::registry& registry)
+    : registry_(registry) {
+    // 记录静态实体的增删，更新时再同步到索引（不关心组件内容，因此不监听 on_update）
+    registry_.on_construct<engine::defs::StaticTag>().connect<&VisibilitySystem::onStaticConstruct>(this);
+    registry_.on_destroy<engine::defs::StaticTag>().connect<&VisibilitySystem::onStaticDestroy>(this);
+}
+
+VisibilitySystem::~VisibilitySystem() {
+    registry_.on_construct<engine::defs::StaticTag>().disconnect(this);
+    registry_.on_destroy<engine::defs::StaticTag>().disconnect(this);
+}
+
+void VisibilitySystem::update(const engine::render::Camera& camera) {
+    ENGINE_ALLOC_SCOPE("VisibilitySystem");
+    // 视口矩形（世界坐标），向外扩展一定边距
+    const engine::utils::Rect view_rect{camera.getPosition() - glm::vec2(VIEW_MARGIN),
+                                        camera.getViewportSize() + glm::vec2(VIEW_MARGIN * 2.0f)};
+
+    // 1. 静态实体：同步增删（必要时整体重建）；视口或索引变化时重新查询，否则直接复用缓存（不写入 VisibleTag）
+    // 大批量增删（如场景清空）时整体重建比逐个删除更快
+    if (!index_dirty_ && added_.size() + removed_.size() > indexed_.size()) {
+        index_dirty_ = true;
+    }
+    if (index_dirty_) {
+        rebuildIndex();
+    } else if (!added_.empty() || !removed_.empty()) {
+        applyChanges();
+    }
+    if (!cache_valid_ ||
+        cached_view_rect_.position != view_rect.position ||
+        cached_view_rect_.size != view_rect.size) {
+        queryStatic(view_rect);
+    }
+
+    // 2. 动态实体：数量较少，每帧重新检测
+    registry_.clear<engine::defs::VisibleTag>();
+    auto view = registry_.view<engine::component::TransformComponent,
+                               engine::component::SpriteComponent,
+                               engine::component::RenderComponent>(entt::exclude<engine::defs::StaticTag>);
+    for (auto entity : view) {
+        const auto& transform = view.get<engine::component::TransformComponent>(entity);
+        const auto& sprite = view.get<engine::component::SpriteComponent>(entity);
+        if (overlaps(worldRect(transform, sprite), view_rect)) {
+            registry_.emplace<engine::defs::VisibleTag>(entity);
+        }
+    }
+}
+
+void VisibilitySystem::setWorldBounds(const engine::utils::Rect& world_bounds) {
+    world_bounds_ = world_bounds;
+    index_dirty_ = true;
+}
+
+void VisibilitySystem::rebuildIndex() {
+    cells_.clear();
+    indexed_.clear();
+    added_.clear();
+    removed_.clear();
+    grid_size_ = glm::ivec2(0);
+    cache_valid_ = false;
+    index_dirty_ = false;
+
+    auto view = registry_.view<engine::defs::StaticTag,
+                               engine::component::TransformComponent,
+                               engine::component::SpriteComponent,
+                               engine::component::RenderComponent>();
+
+    // 第一遍：确定网格范围（未指定世界范围时使用所有静态实体的包围盒）
+    bool has_entity = false;
+    glm::vec2 min_pos{0.0f};
+    glm::vec2 max_pos{0.0f};
+    for (auto entity : view) {
+        const auto rect = worldRect(view.get<engine::component::TransformComponent>(entity),
+                                    view.get<engine::component::SpriteComponent>(entity));
+        if (!has_entity) {
+            min_pos = rect.position;
+            max_pos = rect.position + rect.size;
+            has_entity = true;
+        } else {
+            min_pos = glm::min(min_pos, rect.position);
+            max_pos = glm::max(max_pos, rect.position + rect.size);
+        }
+    }
+    if (world_bounds_) {
+        min_pos = world_bounds_->position;
+        max_pos = world_bounds_->position + world_bounds_->size;
+    } else if (!has_entity) {
+        return;
+    }
+
+    grid_origin_ = min_pos;
+    grid_size_ = glm::ivec2(static_cast<int>(std::floor((max_pos.x - min_pos.x) / CELL_SIZE)) + 1,
+                            static_cast<int>(std::floor((max_pos.y - min_pos.y) / CELL_SIZE)) + 1);
+    cells_.resize(static_cast<size_t>(grid_size_.x) * static_cast<size_t>(grid_size_.y));
+
+    // 第二遍：把实体放入所有与之相交的网格单元（跨越多个单元的实体在查询时去重）
+    indexed_.reserve(view.size_hint());
+    for (auto entity : view) {
+        const auto rect = worldRect(view.get<engine::component::TransformComponent>(entity),
+                                    view.get<engine::component::SpriteComponent>(entity));
+        insertEntry(entity, rect);
+        indexed_.emplace(entity, rect);
+    }
+    spdlog::info("静态实体空间索引重建完成，实体数量: {}, 网格: {}x{}", indexed_.size(), grid_size_.x, grid_size_.y);
+}
+
+void VisibilitySystem::applyChanges() {
+    // 只有与缓存视口相交的变化才需要重新查询（例如视口外预加载、卸载的区块不影响缓存）
+    bool affects_view = false;
+    for (auto entity : removed_) {
+        auto it = indexed_.find(entity);
+        if (it == indexed_.end()) continue;     // 尚未插入索引就被移除
+        eraseEntry(entity, it->second);
+        affects_view = affects_view || overlaps(it->second, cached_view_rect_);
+        indexed_.erase(it);
+    }
+    removed_.clear();
+
+    for (auto entity : added_) {
+        // 新增后又被销毁的实体、组件不完整的实体不进入索引
+        if (!registry_.valid(entity) || indexed_.contains(entity) ||
+            !registry_.all_of<engine::defs::StaticTag, engine::component::TransformComponent,
+                              engine::component::SpriteComponent, engine::component::RenderComponent>(entity)) {
+            continue;
+        }
+        const auto rect = worldRect(registry_.get<engine::component::TransformComponent>(entity),
+                                    registry_.get<engine::component::SpriteComponent>(entity));
+        if (cells_.empty()) {       // 网格尚未建立（之前没有任何静态实体），整体重建
+            rebuildIndex();
+            return;
+        }
+        insertEntry(entity, rect);
+        indexed_.emplace(entity, rect);
+        affects_view = affects_view || overlaps(rect, cached_view_rect_);
+    }
+    added_.clear();
+
+    if (affects_view) {
+        cache_valid_ = false;
+    }
+}
+
+void VisibilitySystem::insertEntry(entt::entity entity, const engine::utils::Rect& rect) {
+    // 超出网格范围的部分被限制在边缘单元中，查询结果仍然正确
+    const auto min_cell = cellOf(rect.position);
+    const auto max_cell = cellOf(rect.position + rect.size);
+    for (int y = min_cell.y; y <= max_cell.y; ++y) {
+        for (int x = min_cell.x; x <= max_cell.x; ++x) {
+            cells_[y * grid_size_.x + x].push_back(Entry{entity, rect});
+        }
+    }
+}
+
+void VisibilitySystem::eraseEntry(entt::entity entity, const engine::utils::Rect& rect) {
+    const auto min_cell = cellOf(rect.position);
+    const auto max_cell = cellOf(rect.position + rect.size);
+    for (int y = min_cell.y; y <= max_cell.y; ++y) {
+        for (int x = min_cell.x; x <= max_cell.x; ++x) {
+            auto& cell = cells_[y * grid_size_.x + x];
+            // 单元内的顺序无关紧要，与最后一个元素交换后删除
+            auto it = std::find_if(cell.begin(), cell.end(), [entity](const Entry& entry) { return entry.entity_ == entity; });
+            if (it != cell.end()) {
+                *it = cell.back();
+                cell.pop_back();
+            }
+        }
+    }
+}
+
+void VisibilitySystem::queryStatic(const engine::utils::Rect& view_rect) {
+    static_visible_.clear();
+    cached_view_rect_ = view_rect;
+    cache_valid_ = true;
+    if (cells_.empty()) return;
+
+    const auto min_cell = cellOf(view_rect.position);
+    const auto max_cell = cellOf(view_rect.position + view_rect.size);
+    for (int y = min_cell.y; y <= max_cell.y; ++y) {
+        for (int x = min_cell.x; x <= max_cell.x; ++x) {
+            for (const auto& entry : cells_[y * grid_size_.x + x]) {
+                if (!overlaps(entry.rect_, view_rect)) continue;
+                // 去重：只在实体与查询范围相交的第一个单元中收集
+                const auto first_cell = glm::max(cellOf(entry.rect_.position), min_cell);
+                if (first_cell.x != x || first_cell.y != y) continue;
+                const auto& render = registry_.get<engine::component::RenderComponent>(entry.entity_);
+                static_visible_.push_back(StaticVisible{entry.entity_, render.layer, render.depth});
+            }
+        }
+    }
+    // 按绘制顺序排序（与 RenderComponent::operator< 一致），渲染时直接与动态实体归并
+    std::sort(static_visible_.begin(), static_visible_.end(), [](const StaticVisible& lhs, const StaticVisible& rhs) {
+        return lhs.layer_ == rhs.layer_ ? lhs.depth_ < rhs.depth_ : lhs.layer_ < rhs.layer_;
+    });
+}
+
+glm::ivec2 VisibilitySystem::cellOf(const glm::vec2& world_pos) const {
+    const auto cell = glm::ivec2(glm::floor((world_pos - grid_origin_) / CELL_SIZE));
+    return glm::clamp(cell, glm::ivec2(0), grid_size_ - glm::ivec2(1));
+}
+
+void VisibilitySystem::onStaticConstruct(entt::registry&, entt::entity entity) {
+    if (!index_dirty_) added_.push_back(entity);    // 等待整体重建时不需要记录
+}
+
+void VisibilitySystem::onStaticDestroy(entt::registry&, entt::entity entity) {
+    if (!index_dirty_) removed_.push_back(entity);
+}
+
+} // namespace engine::system
@@ -0,0 +1,93 @@
+#pragma once
+#include "engine/utils/math.h"
+#include <optional>
+#include <unordered_map>
+#include <vector>
+#include <glm/vec2.hpp>
+#include <entt/entity/fwd.hpp>
+#include <entt/entity/entity.hpp>
+
+namespace engine::render {
+    class Camera;
+}
+
+namespace engine::system {
+
+/**
+ * @brief 可见性系统
+ *
+ * 每帧在渲染开始时根据相机视口计算一次可见实体集合（在所有逻辑更新之后，本帧新建或移动的实体也能正确显示）。
+ * - 动态实体逐个进行AABB检测，结果以 VisibleTag 的形式写入注册表，供 RenderSystem、AnimationSystem 以及游戏层的渲染系统共享；
+ * - 拥有 StaticTag 的实体（关卡瓦片等）保存在均匀网格空间索引中，查询结果按绘制顺序排好后缓存（getStaticVisible()），
+ *   只有视口或索引变化时才重新查询和排序，相机不动时静态瓦片没有每帧的可见性与排序开销。静态实体不会被加上 VisibleTag。
+ *
+ * 静态实体的增删（例如 ChunkStreamSystem 加载、卸载区块）只在网格中增量插入、删除对应的条目，
+ * 不会重建整个索引；变化与缓存的视口不相交时也不需要重新查询。只有首次使用或大批量增删时才整体重建。
+ * 流式加载的地图应通过 setWorldBounds() 指定整张地图的范围，使网格一开始就覆盖所有区块。
+ */
+class VisibilitySystem {
+public:
+    /// @brief 可见的静态实体及其绘制顺序（查询时缓存 RenderComponent 的图层与深度）
+    struct StaticVisible {
+        entt::entity entity_{entt::null};
+        int layer_{0};
+        float depth_{0.0f};
+    };
+
+private:
+    /// @brief 空间索引中的条目，缓存实体的世界矩形，查询时不需要再访问组件
+    struct Entry {
+        entt::entity entity_{entt::null};
+        engine::utils::Rect rect_{};
+    };
+
+    entt::registry& registry_;
+
+    // --- 静态实体空间索引（均匀网格） ---
+    glm::vec2 grid_origin_{0.0f};                       ///< @brief 网格左上角的世界坐标
+    glm::ivec2 grid_size_{0};                           ///< @brief 网格列数和行数
+    std::vector<std::vector<Entry>> cells_;             ///< @brief 网格单元，按行优先排列
+    std::optional<engine::utils::Rect> world_bounds_;   ///< @brief 网格覆盖的世界范围（空值表示按现有静态实体的包围盒确定）
+    std::unordered_map<entt::entity, engine::utils::Rect> indexed_;    ///< @brief 已在索引中的静态实体 -> 世界矩形（增量删除时定位网格单元）
+    std::vector<entt::entity> added_;                   ///< @brief 上次更新后新增的静态实体（更新时插入索引）
+    std::vector<entt::entity> removed_;                 ///< @brief 上次更新后移除的静态实体（更新时从索引中删除）
+    bool index_dirty_{true};                            ///< @brief 需要整体重建索引（首次使用、网格范围变化）
+
+    // --- 静态实体查询缓存 ---
+    std::vector<StaticVisible> static_visible_;         ///< @brief 上一次查询得到的可见静态实体（按绘制顺序排序）
+    engine::utils::Rect cached_view_rect_{};            ///< @brief 上一次查询使用的视口矩形
+    bool cache_valid_{false};                           ///< @brief 查询缓存是否有效
+
+public:
+    static constexpr float CELL_SIZE{128.0f};           ///< @brief 网格单元边长（像素）
+    static constexpr float VIEW_MARGIN{32.0f};          ///< @brief 视口外扩边距，保证血量条等附属绘制不会在边缘被提前裁掉
+
+    explicit VisibilitySystem(entt::registry& registry);
+    ~VisibilitySystem();
+
+    /**
+     * @brief 重新计算可见实体集合（在渲染开始时、所有绘制系统之前调用）
+     * @param camera 相机，用于确定视口范围
+     */
+    void update(const engine::render::Camera& camera);
+
+    /// @brief 可见的静态实体，已按 RenderComponent 的顺序（图层、深度）排序
+    const std::vector<StaticVisible>& getStaticVisible() const { return static_visible_; }
+
+    /// @brief 设置网格覆盖的世界范围（如整张地图），下一次更新时重建索引
+    void setWorldBounds(const engine::utils::Rect& world_bounds);
+    size_t getIndexedCount() const { return indexed_.size(); }      ///< @brief 索引中的静态实体数量
+
+private:
+    void rebuildIndex();                                            ///< @brief 重建静态实体空间索引
+    void applyChanges();                                            ///< @brief 把上次更新后增删的静态实体增量同步到索引中
+    void insertEntry(entt::entity entity, const engine::utils::Rect& rect);    ///< @brief 把实体插入所有与之相交的网格单元
+    void eraseEntry(entt::entity entity, const engine::utils::Rect& rect);     ///< @brief 从所有与之相交的网格单元中删除实体
+    void queryStatic(const engine::utils::Rect& view_rect);         ///< @brief 查询与视口相交的静态实体，排序后保存到 static_visible_
+    glm::ivec2 cellOf(const glm::vec2& world_pos) const;            ///< @brief 世界坐标所在的网格单元（已限制在网格范围内）
+
+    void onStaticConstruct(entt::registry& registry, entt::entity entity);     ///< @brief 静态实体新增回调，记录待插入的实体
+    void onStaticDestroy(entt::registry& registry, entt::entity entity);       ///< @brief 静态实体移除回调，记录待删除的实体
+};
+
+} // namespace engine::system
@@ -1,4 +1,5 @@
 #include "ysort_system.h"
+#include "engine/debug/alloc_tracker.h"
 #include "engine/component/render_component.h"
 #include "engine/component/transform_component.h"
 #include <entt/entity/registry.hpp>
@@ -6,6 +7,7 @@
 namespace engine::system {
 
 void YSortSystem::update(entt::registry& registry) {
+    ENGINE_ZERO_ALLOC_SCOPE("YSortSystem");
     // 让RenderComponent的深度depth等于TransformComponent的y坐标
     auto view = registry.view<component::RenderComponent, const component::TransformComponent>();
     for (auto entity : view) {
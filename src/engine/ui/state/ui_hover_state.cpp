@@ -1,6 +1,4 @@
 #include "ui_hover_state.h"
-#include "ui_normal_state.h"
-#include "ui_pressed_state.h"
 #include "engine/ui/ui_interactive.h"
 #include "engine/input/input_manager.h"
 #include "engine/core/context.h"
@@ -11,37 +9,30 @@ using namespace entt::literals;
 
 namespace engine::ui::state {
 
-UIHoverState::UIHoverState(engine::ui::UIInteractive* owner)
-    : UIState(owner)
+void UIHoverState::enter()
 {
     owner_->getContext().getInputManager().onAction("mouse_left"_hs).connect<&UIHoverState::onMousePressed>(this);
+    owner_->setCurrentImage("hover"_hs);
+    owner_->hover_enter();
+    spdlog::debug("切换到悬停状态");
 }
 
-UIHoverState::~UIHoverState()
+void UIHoverState::exit()
 {
     owner_->getContext().getInputManager().onAction("mouse_left"_hs).disconnect<&UIHoverState::onMousePressed>(this);
 }
 
-void UIHoverState::enter()
-{
-    owner_->setCurrentImage("hover"_hs);
-    owner_->hover_enter();
-    spdlog::debug("切换到悬停状态");
-}
-
-void UIHoverState::update(float, engine::core::Context& context)
+void UIHoverState::update(float, engine::core::Context&)
 {
-    auto& input_manager = context.getInputManager();
-    auto mouse_pos = input_manager.getLogicalMousePosition();
-    if (!owner_->isPointInside(mouse_pos)) {                // 如果鼠标不在UI元素内，则设置正常状态
+    if (!owner_->isHovered()) {                // 如果鼠标不在UI元素内，则设置正常状态
         owner_->hover_leave();
-        owner_->setNextState(std::make_unique<UINormalState>(owner_));
+        owner_->setNextState(UIStateType::NORMAL);
     }
 }
 
 bool UIHoverState::onMousePressed()
 {
-    owner_->setNextState(std::make_unique<UIPressedState>(owner_));
+    owner_->setNextState(UIStateType::PRESSED);
     return true;
 }
 
@@ -11,11 +11,12 @@ namespace engine::ui::state {
 class UIHoverState final: public UIState {
     friend class engine::ui::UIInteractive;
 public:
-    UIHoverState(engine::ui::UIInteractive* owner);
-    ~UIHoverState();
+    UIHoverState(engine::ui::UIInteractive* owner) : UIState(owner) {}
+    ~UIHoverState() override = default;
 
 private:
     void enter() override;
+    void exit() override;
     void update(float delta_time, engine::core::Context& context) override;
 
     bool onMousePressed();  ///< @brief 鼠标按下回调函数 (不再使用轮询“isActionPressed”)
@@ -1,5 +1,4 @@
 #include "ui_normal_state.h"
-#include "ui_hover_state.h"
 #include "engine/ui/ui_interactive.h"
 #include "engine/input/input_manager.h"
 #include "engine/core/context.h"
@@ -17,13 +16,11 @@ void UINormalState::enter()
     spdlog::debug("切换到正常状态");
 }
 
-void UINormalState::update(float, engine::core::Context& context)
+void UINormalState::update(float, engine::core::Context&)
 {
-    auto& input_manager = context.getInputManager();
-    auto mouse_pos = input_manager.getLogicalMousePosition();
-    if (owner_->isPointInside(mouse_pos)) {         // 如果鼠标在UI元素内，则切换到悬停状态
+    if (owner_->isHovered()) {         // 如果鼠标在UI元素内(且未被遮挡)，则切换到悬停状态
         owner_->playSound("ui_hover"_hs);
-        owner_->setNextState(std::make_unique<UIHoverState>(owner_));
+        owner_->setNextState(UIStateType::HOVER);
     }
 }
 
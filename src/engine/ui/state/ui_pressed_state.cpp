@@ -1,6 +1,4 @@
 #include "ui_pressed_state.h"
-#include "ui_normal_state.h"
-#include "ui_hover_state.h"
 #include "engine/ui/ui_interactive.h"
 #include "engine/input/input_manager.h"
 #include "engine/core/context.h"
@@ -11,34 +9,27 @@ using namespace entt::literals;
 
 namespace engine::ui::state {
 
-UIPressedState::UIPressedState(engine::ui::UIInteractive* owner)
-    : UIState(owner)
+void UIPressedState::enter()
 {
     owner_->getContext().getInputManager().onAction("mouse_left"_hs, engine::input::ActionState::RELEASED).connect<&UIPressedState::onMouseReleased>(this);
+    owner_->setCurrentImage("pressed"_hs);
+    owner_->playSound("ui_click"_hs);
+    spdlog::debug("切换到按下状态");
 }
 
-UIPressedState::~UIPressedState()
+void UIPressedState::exit()
 {
     owner_->getContext().getInputManager().onAction("mouse_left"_hs, engine::input::ActionState::RELEASED).disconnect<&UIPressedState::onMouseReleased>(this);
 }
 
-void UIPressedState::enter()
-{
-    owner_->setCurrentImage("pressed"_hs);
-    owner_->playSound("ui_click"_hs);
-    spdlog::debug("切换到按下状态");
-}
-
 bool UIPressedState::onMouseReleased()
 {
-    auto& input_manager = owner_->getContext().getInputManager();
-    auto mouse_pos = input_manager.getLogicalMousePosition();
-    if (owner_->isPointInside(mouse_pos)) {
-        owner_->setNextState(std::make_unique<UIHoverState>(owner_));
+    if (owner_->isHovered()) {
+        owner_->setNextState(UIStateType::HOVER);
         owner_->clicked();
     }
     else {
-        owner_->setNextState(std::make_unique<UINormalState>(owner_));
+        owner_->setNextState(UIStateType::NORMAL);
     }
     return true;
 }
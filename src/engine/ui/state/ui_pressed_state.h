@@ -11,11 +11,12 @@ namespace engine::ui::state {
 class UIPressedState final: public UIState {
     friend class engine::ui::UIInteractive;
 public:
-    UIPressedState(engine::ui::UIInteractive* owner);
-    ~UIPressedState();
+    UIPressedState(engine::ui::UIInteractive* owner) : UIState(owner) {}
+    ~UIPressedState() override = default;
 
 private:
     void enter() override;
+    void exit() override;
 
     bool onMouseReleased();
 };
@@ -1,5 +1,4 @@
 #pragma once
-#include <memory>
 
 namespace engine::core {
     class Context;
@@ -11,11 +10,20 @@ namespace engine::ui {
 
 namespace engine::ui::state {
 
+/// @brief 可交互UI元素的状态类型
+enum class UIStateType {
+    NORMAL,     ///< @brief 正常
+    HOVER,      ///< @brief 悬停
+    PRESSED,    ///< @brief 按下
+};
+
 /**
  * @brief 可交互UI元素在特定状态下的行为接口。
  *
  * 该接口定义了所有具体UI状态必须实现的通用操作，
  * 例如处理输入事件、更新状态逻辑以及确定视觉表现。
+ * 每个可交互元素在构造时持有所有状态对象，状态切换只改变指针，不分配内存；
+ * 需要监听输入的状态在 enter() 中连接、在 exit() 中断开。
  */
 class UIState {
     friend class engine::ui::UIInteractive;
@@ -38,6 +46,7 @@ public:
 protected:
     // --- 核心方法 --- 
     virtual void enter() = 0;
+    virtual void exit() {}
     virtual void update(float, engine::core::Context&) {}
 };
 
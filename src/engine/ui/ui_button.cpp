@@ -1,5 +1,4 @@
 #include "ui_button.h"
-#include "state/ui_normal_state.h"
 #include <spdlog/spdlog.h>
 
 using namespace entt::literals;
@@ -22,7 +21,7 @@ UIButton::UIButton(engine::core::Context& context,
     addImage("pressed"_hs, std::move(pressed_image));
 
     // 设置默认状态为"normal"
-    setState(std::make_unique<engine::ui::state::UINormalState>(this));
+    setState(engine::ui::state::UIStateType::NORMAL);
 
     spdlog::trace("UIButton 构造完成");
 }
@@ -10,28 +10,12 @@ UIElement::UIElement(glm::vec2 position, glm::vec2 size)
     : position_(std::move(position)), size_(std::move(size)) {
 }   
 
-void UIElement::update(float delta_time, engine::core::Context& context) {
-    // 如果元素不可见，直接返回 false
-    if (!visible_) return; 
-
-    // 遍历所有子节点，并删除标记了移除的元素
-    for (auto it = children_.begin(); it != children_.end();) {
-        if (*it && !(*it)->isNeedRemove()) {
-            (*it)->update(delta_time, context);
-            ++it;
-        } else {
-            it = children_.erase(it);
-        }
-    }
+void UIElement::update(float, engine::core::Context&) {
+    // 基类没有需要更新的内容，子元素由UIManager的更新列表负责
 }
 
-void UIElement::render(engine::core::Context& context) {
-    if (!visible_) return;
-
-    // 渲染子元素
-    for (const auto& child : children_) {
-        if (child) child->render(context);
-    }
+void UIElement::render(engine::core::Context&) {
+    // 基类没有需要绘制的内容，子元素由UIManager的绘制列表负责
 }
 
 void UIElement::addChild(std::unique_ptr<UIElement> child, int order_index) {
@@ -41,6 +25,7 @@ void UIElement::addChild(std::unique_ptr<UIElement> child, int order_index) {
             child->setOrderIndex(order_index);
         }
         children_.push_back(std::move(child));
+        markTreeDirty();
     }
 }
 
@@ -55,6 +40,7 @@ std::unique_ptr<UIElement> UIElement::removeChild(UIElement* child_ptr) {
         std::unique_ptr<UIElement> removed_child = std::move(*it);
         children_.erase(it);
         removed_child->setParent(nullptr);      // 清除父指针
+        markTreeDirty();
         return removed_child;                   // 返回被移除的子元素（可以挂载到别处）
     }
     return nullptr; // 未找到子元素
@@ -69,6 +55,7 @@ std::unique_ptr<UIElement> UIElement::removeChildById(entt::id_type id) {
         std::unique_ptr<UIElement> removed_child = std::move(*it);
         children_.erase(it);
         removed_child->setParent(nullptr);      // 清除父指针
+        markTreeDirty();
         return removed_child;                   // 返回被移除的子元素（可以挂载到别处）
     }
     return nullptr; // 未找到子元素
@@ -79,6 +66,20 @@ void UIElement::removeAllChildren() {
         child->setParent(nullptr); // 清除父指针
     }
     children_.clear();
+    markTreeDirty();
+}
+
+void UIElement::removePendingChildren() {
+    auto it = std::remove_if(children_.begin(), children_.end(), [](const std::unique_ptr<UIElement>& p) {
+        return !p || p->isNeedRemove();
+    });
+    if (it != children_.end()) {
+        children_.erase(it, children_.end());
+        markTreeDirty();
+    }
+    for (auto& child : children_) {
+        child->removePendingChildren();
+    }
 }
 
 UIElement* UIElement::getChildById(entt::id_type id) const {
@@ -93,10 +94,81 @@ UIElement* UIElement::getChildById(entt::id_type id) const {
 }
 
 glm::vec2 UIElement::getScreenPosition() const {
-    if (parent_) {
-        return parent_->getScreenPosition() + position_;
+    if (transform_dirty_) {
+        // 根元素的位置已经是相对屏幕的绝对位置
+        screen_position_ = parent_ ? parent_->getScreenPosition() + position_ : position_;
+        transform_dirty_ = false;
+    }
+    return screen_position_;
+}
+
+void UIElement::setPosition(glm::vec2 position) {
+    position_ = std::move(position);
+    markTransformDirty();
+    markBoundsDirty();
+}
+
+void UIElement::setSize(glm::vec2 size) {
+    size_ = std::move(size);
+    markBoundsDirty();
+}
+
+void UIElement::setParent(UIElement* parent) {
+    parent_ = parent;
+    markTransformDirty();
+}
+
+void UIElement::setVisible(bool visible) {
+    if (visible_ == visible) return;
+    visible_ = visible;
+    markTreeDirty();
+}
+
+void UIElement::setNeedRemove(bool need_remove) {
+    if (need_remove_ == need_remove) return;
+    need_remove_ = need_remove;
+    markTreeDirty();
+}
+
+void UIElement::markTransformDirty() {
+    // 缓存有效的元素，其祖先的缓存一定也有效；因此已经是脏的元素，其子孙也都是脏的，无需继续向下
+    if (transform_dirty_) return;
+    transform_dirty_ = true;
+    for (auto& child : children_) {
+        child->markTransformDirty();
+    }
+}
+
+UIElement* UIElement::getRoot() {
+    auto* root = this;
+    while (root->parent_) {
+        root = root->parent_;
+    }
+    return root;
+}
+
+void UIElement::markTreeDirty() {
+    getRoot()->tree_dirty_ = true;
+}
+
+void UIElement::markBoundsDirty() {
+    getRoot()->bounds_dirty_ = true;
+}
+
+void UIElement::collectVisible(std::vector<UIElement*>& draw_list, std::vector<UIElement*>& update_list,
+                               std::vector<UIElement*>& hit_list) {
+    if (!visible_ || need_remove_) return;
+    draw_list.push_back(this);
+    if (hit_testable_) {
+        hit_list.push_back(this);
+    }
+    for (auto& child : children_) {
+        child->collectVisible(draw_list, update_list, hit_list);
+    }
+    // 子元素先于父元素更新（与之前递归更新的顺序一致）
+    if (updatable_) {
+        update_list.push_back(this);
     }
-    return position_; // 根元素的位置已经是相对屏幕的绝对位置
 }
 
 void UIElement::sortChildrenByOrderIndex() {
@@ -104,6 +176,7 @@ void UIElement::sortChildrenByOrderIndex() {
     std::stable_sort(children_.begin(), children_.end(), [](const std::unique_ptr<UIElement>& a, const std::unique_ptr<UIElement>& b) {
         return a->getOrderIndex() < b->getOrderIndex();
     });
+    markTreeDirty();
 }
 
 engine::utils::Rect UIElement::getBounds() const {
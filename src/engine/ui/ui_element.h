@@ -16,6 +16,11 @@ namespace engine::ui {
  * 定义了位置、大小、可见性、状态等通用属性。
  * 管理子元素的层次结构。
  * 提供事件处理、更新和渲染的虚方法。
+ *
+ * update/render 只处理元素自身，不再递归子元素：UIManager 把元素树展开为绘制列表和更新列表，
+ * 只在树结构变化（增删子元素、排序、可见性变化、标记移除）时重建。
+ * 屏幕位置会被缓存，setPosition 或父节点变化时才将自身及所有子孙标记为需要重新计算。
+ * 命中测试由 UIManager 的空间索引完成，结果通过 isHovered() 提供给元素。
  */
 class UIElement {
 protected:
@@ -23,9 +28,17 @@ protected:
     glm::vec2 size_;                                        ///< @brief 元素大小
     bool visible_ = true;                                   ///< @brief 元素当前是否可见
     bool need_remove_ = false;                              ///< @brief 是否需要移除(延迟删除)
+    bool updatable_ = false;                                ///< @brief 是否需要每帧更新(重写了update的派生类需设为true)
+    bool hit_testable_ = false;                             ///< @brief 是否参与命中测试(加入UIManager的空间索引)
+    bool hovered_ = false;                                  ///< @brief 鼠标是否位于该元素上(由UIManager设置)
     int order_index_ = 0;                                   ///< @brief 一个用于排序的索引
     entt::id_type id_ = entt::null;                         ///< @brief 可用于标记或查找的ID    
 
+    mutable glm::vec2 screen_position_{0.0f, 0.0f};         ///< @brief 缓存的屏幕位置
+    mutable bool transform_dirty_ = true;                   ///< @brief 缓存的屏幕位置是否需要重新计算
+    bool tree_dirty_ = false;                               ///< @brief 子树结构是否发生变化(只在根节点上设置)
+    bool bounds_dirty_ = false;                             ///< @brief 子树中是否有元素的边界发生变化(只在根节点上设置)
+
     UIElement* parent_ = nullptr;                           ///< @brief 指向父节点的非拥有指针
     std::vector<std::unique_ptr<UIElement>> children_;      ///< @brief 子元素列表(容器)
 
@@ -42,7 +55,7 @@ public:
      */
     virtual ~UIElement() = default;
 
-    // --- 核心虚循环方法 --- (没有使用init和clean，注意构造函数和析构函数的使用)
+    // --- 核心虚循环方法 --- (没有使用init和clean，注意构造函数和析构函数的使用；只处理自身，子元素由UIManager遍历)
     virtual void update(float delta_time, engine::core::Context& context);
     virtual void render(engine::core::Context& context);
 
@@ -52,23 +65,32 @@ public:
     std::unique_ptr<UIElement> removeChild(UIElement* child_ptr);   ///< @brief 将指定子元素从列表中移除，并返回其智能指针
     std::unique_ptr<UIElement> removeChildById(entt::id_type id);   ///< @brief 根据ID移除子元素，并返回其智能指针
     void removeAllChildren();                                       ///< @brief 移除所有子元素
+    void removePendingChildren();                                   ///< @brief 递归移除所有标记了need_remove_的子元素(在帧末调用)
 
     // --- Getters and Setters ---
     const glm::vec2& getSize() const { return size_; }              ///< @brief 获取元素大小
     const glm::vec2& getPosition() const { return position_; }      ///< @brief 获取元素位置(相对于父节点)
     bool isVisible() const { return visible_; }                     ///< @brief 检查元素是否可见
     bool isNeedRemove() const { return need_remove_; }              ///< @brief 检查元素是否需要移除
+    bool isUpdatable() const { return updatable_; }                 ///< @brief 检查元素是否需要每帧更新
+    bool isHitTestable() const { return hit_testable_; }            ///< @brief 检查元素是否参与命中测试
+    bool isHovered() const { return hovered_; }                     ///< @brief 检查鼠标是否位于该元素上(考虑遮挡)
+    bool isTreeDirty() const { return tree_dirty_; }                ///< @brief 检查子树结构是否发生变化
+    bool isBoundsDirty() const { return bounds_dirty_; }            ///< @brief 检查子树中是否有元素的边界发生变化
     int getOrderIndex() const { return order_index_; }              ///< @brief 获取元素的排序索引
     UIElement* getParent() const { return parent_; }                ///< @brief 获取父元素
     const std::vector<std::unique_ptr<UIElement>>& getChildren() const { return children_; } ///< @brief 获取子元素列表
     UIElement* getChildById(entt::id_type id) const;                                    ///< @brief 根据ID获取子元素
     entt::id_type getId() const { return id_; }                                         ///< @brief 获取自身的ID
 
-    void setSize(glm::vec2 size) { size_ = std::move(size); }           ///< @brief 设置元素大小
-    void setVisible(bool visible) { visible_ = visible; }           ///< @brief 设置元素的可见性
-    void setParent(UIElement* parent) { parent_ = parent; }         ///< @brief 设置父节点
-    void setPosition(glm::vec2 position) { position_ = std::move(position); }   ///< @brief 设置元素位置(相对于父节点)
-    void setNeedRemove(bool need_remove) { need_remove_ = need_remove; }    ///< @brief 设置元素是否需要移除
+    void setSize(glm::vec2 size);                                   ///< @brief 设置元素大小
+    void setHovered(bool hovered) { hovered_ = hovered; }           ///< @brief 设置鼠标是否位于该元素上(由UIManager调用)
+    void setVisible(bool visible);                                  ///< @brief 设置元素的可见性
+    void setParent(UIElement* parent);                              ///< @brief 设置父节点
+    void setPosition(glm::vec2 position);                           ///< @brief 设置元素位置(相对于父节点)
+    void setNeedRemove(bool need_remove);                           ///< @brief 设置元素是否需要移除(在帧末移除)
+    void clearTreeDirty() { tree_dirty_ = false; bounds_dirty_ = false; }   ///< @brief 清除子树变化标记(UIManager重建列表后调用)
+    void clearBoundsDirty() { bounds_dirty_ = false; }              ///< @brief 清除边界变化标记(UIManager重建空间索引后调用)
     void setOrderIndex(int order_index) { order_index_ = order_index; }     ///< @brief 设置元素的排序索引
     void setId(entt::id_type id) { id_ = id; }                              ///< @brief 设置元素的ID
 
@@ -79,6 +101,23 @@ public:
     glm::vec2 getScreenPosition() const;                            ///< @brief 获取(计算)元素在屏幕上位置
     bool isPointInside(const glm::vec2& point) const;               ///< @brief 检查给定点是否在元素的边界内
 
+    /**
+     * @brief 按绘制顺序(先序遍历)收集可见的子树
+     * @param draw_list 输出：需要绘制的元素
+     * @param update_list 输出：需要每帧更新的元素(子元素在父元素之前)
+     * @param hit_list 输出：参与命中测试的元素(按绘制顺序)
+     */
+    void collectVisible(std::vector<UIElement*>& draw_list, std::vector<UIElement*>& update_list,
+                        std::vector<UIElement*>& hit_list);
+
+protected:
+    void markTransformDirty();                                      ///< @brief 将自身及所有子孙的屏幕位置标记为需要重新计算
+    void markTreeDirty();                                           ///< @brief 通知根节点：子树结构发生了变化
+    void markBoundsDirty();                                         ///< @brief 通知根节点：子树中有元素的边界发生了变化
+    UIElement* getRoot();                                           ///< @brief 获取所在树的根节点
+
+public:
+
     // --- 禁用拷贝和移动语义 ---
     UIElement(const UIElement&) = delete;
     UIElement& operator=(const UIElement&) = delete;
@@ -59,9 +59,6 @@ void UIImage::render(engine::core::Context& context) {
     } else {
         context.getRenderer().drawUIImage(image_, position, size_);
     }
-
-    // 渲染子元素（调用基类方法）
-    UIElement::render(context);
 }
 
 } // namespace engine::ui 
\ No newline at end of file
@@ -1,5 +1,4 @@
 #include "ui_interactive.h"
-#include "state/ui_state.h"
 #include "engine/core/context.h"
 #include "engine/render/renderer.h"
 #include "engine/resource/resource_manager.h"
@@ -11,35 +10,51 @@ using namespace entt::literals;
 
 namespace engine::ui {
 
-UIInteractive::~UIInteractive() = default;
+UIInteractive::~UIInteractive()
+{
+    // 断开当前状态的输入监听
+    if (state_) state_->exit();
+}
 
 UIInteractive::UIInteractive(engine::core::Context &context, glm::vec2 position, glm::vec2 size)
-    : UIElement(std::move(position), std::move(size)), context_(context)
+    : UIElement(std::move(position), std::move(size)),
+      context_(context),
+      normal_state_(this),
+      hover_state_(this),
+      pressed_state_(this)
 {
+    updatable_ = true;      // 需要每帧更新状态
+    hit_testable_ = true;   // 参与命中测试
     spdlog::trace("UIInteractive 构造完成");
 }
 
-void UIInteractive::setState(std::unique_ptr<engine::ui::state::UIState> state)
+void UIInteractive::setState(engine::ui::state::UIStateType type)
 {
-    if (!state) {
-        spdlog::warn("尝试设置空的状态！");
-        return;
-    }
-
-    state_ = std::move(state);
+    if (state_) state_->exit();
+    state_ = getStateObject(type);
     state_->enter();
 }
 
-void UIInteractive::setNextState(std::unique_ptr<engine::ui::state::UIState> state)
+void UIInteractive::setNextState(engine::ui::state::UIStateType type)
+{
+    next_state_ = getStateObject(type);
+}
+
+engine::ui::state::UIState* UIInteractive::getStateObject(engine::ui::state::UIStateType type)
 {
-    next_state_ = std::move(state);
+    switch (type) {
+        case engine::ui::state::UIStateType::HOVER: return &hover_state_;
+        case engine::ui::state::UIStateType::PRESSED: return &pressed_state_;
+        case engine::ui::state::UIStateType::NORMAL: break;
+    }
+    return &normal_state_;
 }
 
 void UIInteractive::addImage(entt::id_type name_id, engine::render::Image image)
 {
     // 可交互UI元素必须有一个size用于交互检测，因此如果参数列表中没有指定，则用图片大小作为size
     if (size_.x == 0.0f && size_.y == 0.0f) {
-        size_ = context_.getResourceManager().getTextureSize(image.getTextureId());
+        setSize(context_.getResourceManager().getTextureSize(image.getTextureId()));
     }
     // 添加图片 (如果name_id已存在，则替换)
     images_.insert_or_assign(name_id, std::move(image));
@@ -70,13 +85,13 @@ void UIInteractive::playSound(entt::id_type name_id)
 {
     // 先尝试在自定义sounds_中查找（map的值）
     if (auto it = sounds_.find(name_id); it != sounds_.end()) {
-        if (context_.getAudioPlayer().playSound(it->second) == -1) {
+        if (context_.getAudioPlayer().playSound(it->second, engine::audio::SOUND_PRIORITY_HIGH) == -1) {
             spdlog::warn("Sound '{}' 未找到或无法播放", name_id);
         }
     } 
     // 如果自定义sounds_中没有找到，则使用默认音效（map的键）
     else {
-        if (context_.getAudioPlayer().playSound(name_id) == -1) {
+        if (context_.getAudioPlayer().playSound(name_id, engine::audio::SOUND_PRIORITY_HIGH) == -1) {
             spdlog::error("Sound '{}' 未找到或无法播放", name_id);
         }
     }
@@ -84,14 +99,13 @@ void UIInteractive::playSound(entt::id_type name_id)
 
 void UIInteractive::update(float delta_time, engine::core::Context &context)
 {
-    // 先更新子节点
-    UIElement::update(delta_time, context);
-
-    // 再更新自己（状态）
+    // 更新状态（子节点由UIManager在此之前更新）
     if (state_ && interactive_) {
         if (next_state_) {
-            setState(std::move(next_state_));
-            next_state_.reset();
+            state_->exit();
+            state_ = next_state_;
+            next_state_ = nullptr;
+            state_->enter();
         } 
         state_->update(delta_time, context);
     }
@@ -101,11 +115,8 @@ void UIInteractive::render(engine::core::Context &context)
 {
     if (!visible_ ) return;
 
-    // 先渲染自身
+    // 渲染自身
     context.getRenderer().drawUIImage(images_[current_image_id_], getScreenPosition(), size_);
-
-    // 再渲染子元素（调用基类方法）
-    UIElement::render(context);
 }
 
 } // namespace engine::ui
\ No newline at end of file
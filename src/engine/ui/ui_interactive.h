@@ -1,9 +1,10 @@
 #pragma once
 #include "ui_element.h"
-#include "state/ui_state.h"
+#include "state/ui_normal_state.h"
+#include "state/ui_hover_state.h"
+#include "state/ui_pressed_state.h"
 #include "engine/render/image.h"   // 需要引入头文件而不是前置声明（map容器创建时可能会检查内部元素是否有析构定义）
 #include <unordered_map>
-#include <memory>
 #include <entt/entity/fwd.hpp>
 
 namespace engine::core {
@@ -16,14 +17,17 @@ namespace engine::ui {
  * @brief 可交互UI元素的基类,继承自UIElement
  *
  * 定义了可交互UI元素的通用属性和行为。
- * 管理UI状态的切换和交互逻辑。
+ * 管理UI状态的切换和交互逻辑（状态对象随元素一起创建，切换时不分配内存）。
  * 提供事件处理、更新和渲染的虚方法。
  */
 class UIInteractive : public UIElement {
 protected:
     engine::core::Context& context_;                        ///< @brief 可交互元素很可能需要其他引擎组件
-    std::unique_ptr<engine::ui::state::UIState> state_;     ///< @brief 当前状态
-    std::unique_ptr<engine::ui::state::UIState> next_state_;///< @brief 下一个状态，用于处理状态切换
+    engine::ui::state::UINormalState normal_state_;         ///< @brief 正常状态
+    engine::ui::state::UIHoverState hover_state_;           ///< @brief 悬停状态
+    engine::ui::state::UIPressedState pressed_state_;       ///< @brief 按下状态
+    engine::ui::state::UIState* state_ = nullptr;           ///< @brief 当前状态(指向上面的状态之一)
+    engine::ui::state::UIState* next_state_ = nullptr;      ///< @brief 下一个状态，用于处理状态切换
     std::unordered_map<entt::id_type, engine::render::Image> images_;   ///< @brief 图片集合
     std::unordered_map<entt::id_type, entt::id_type> sounds_;           ///< @brief 音效集合，key为音效名称ID，value为音效ID
     entt::id_type current_image_id_ = entt::null;           ///< @brief 当前显示的图片ID
@@ -46,9 +50,9 @@ public:
 
     // --- Getters and Setters ---
     engine::core::Context& getContext() const { return context_; }
-    void setState(std::unique_ptr<engine::ui::state::UIState> state);       ///< @brief 设置当前状态
-    void setNextState(std::unique_ptr<engine::ui::state::UIState> state);   ///< @brief 设置下一个状态
-    engine::ui::state::UIState* getState() const { return state_.get(); }   ///< @brief 获取当前状态
+    void setState(engine::ui::state::UIStateType type);                     ///< @brief 设置当前状态(立即切换)
+    void setNextState(engine::ui::state::UIStateType type);                 ///< @brief 设置下一个状态(下次更新时切换)
+    engine::ui::state::UIState* getState() const { return state_; }         ///< @brief 获取当前状态
 
     void setInteractive(bool interactive) { interactive_ = interactive; }   ///< @brief 设置是否可交互
     bool isInteractive() const { return interactive_; }                     ///< @brief 获取是否可交互
@@ -56,6 +60,9 @@ public:
     // --- 核心方法 ---
     void update(float delta_time, engine::core::Context& context) override;
     void render(engine::core::Context& context) override;
+
+private:
+    engine::ui::state::UIState* getStateObject(engine::ui::state::UIStateType type);
 };
 
 } // namespace engine::ui
\ No newline at end of file
@@ -23,13 +23,10 @@ UILabel::UILabel(engine::render::TextRenderer& text_renderer,
     spdlog::trace("UILabel 构造完成");
 }
 
-void UILabel::render(engine::core::Context& context) {
+void UILabel::render(engine::core::Context&) {
     if (!visible_ || text_.empty()) return;
 
     text_renderer_.drawUIText(text_, font_id_, font_size_, getScreenPosition(), text_fcolor_);
-
-    // 渲染子元素（调用基类方法）
-    UIElement::render(context);
 }
 
 void UILabel::setText(std::string_view text)
@@ -1,6 +1,8 @@
 #include "ui_manager.h"
 #include "ui_panel.h"
 #include "ui_element.h"
+#include "engine/core/context.h"
+#include "engine/input/input_manager.h"
 #include <spdlog/spdlog.h>
 
 namespace engine::ui {
@@ -30,24 +32,63 @@ void UIManager::addElement(std::unique_ptr<UIElement> element) {
 void UIManager::clearElements() {
     if (root_element_) {
         root_element_->removeAllChildren();
+        hovered_ = nullptr;
         spdlog::trace("所有UI元素已从UI管理器中清除。");
     }
 }
 
 void UIManager::update(float delta_time, engine::core::Context& context) {
-    if (root_element_ && root_element_->isVisible()) {
-        // 从根元素开始向下更新
-        root_element_->update(delta_time, context);
+    if (!root_element_) return;
+    refresh(context);
+    updateHover(context);
+    for (auto* element : update_list_) {
+        element->update(delta_time, context);
     }
+    // 帧末：统一处理本帧内发生的移除和结构变化
+    refresh(context);
 }
 
 void UIManager::render(engine::core::Context& context) {
-    if (root_element_ && root_element_->isVisible()) {
-        // 从根元素开始向下渲染
-        root_element_->render(context);
+    if (!root_element_) return;
+    refresh(context);
+    for (auto* element : draw_list_) {
+        element->render(context);
     }
 }
 
+void UIManager::refresh(engine::core::Context& context) {
+    if (root_element_->isTreeDirty()) {
+        root_element_->removePendingChildren();
+        root_element_->clearTreeDirty();
+
+        draw_list_.clear();
+        update_list_.clear();
+        hit_list_.clear();
+        root_element_->collectVisible(draw_list_, update_list_, hit_list_);
+        // 原来的悬停元素可能已被移除，不能再访问；仍在树中的元素统一清除悬停标记后重新查询
+        hovered_ = nullptr;
+        for (auto* element : hit_list_) {
+            element->setHovered(false);
+        }
+        spdlog::trace("UI绘制列表已重建：{} 个绘制元素，{} 个更新元素，{} 个可交互元素。",
+                      draw_list_.size(), update_list_.size(), hit_list_.size());
+    } else if (root_element_->isBoundsDirty()) {
+        root_element_->clearBoundsDirty();
+    } else {
+        return;
+    }
+    spatial_index_.build(hit_list_);
+    updateHover(context);
+}
+
+void UIManager::updateHover(engine::core::Context& context) {
+    auto* hit = spatial_index_.query(context.getInputManager().getLogicalMousePosition());
+    if (hit == hovered_) return;
+    if (hovered_) hovered_->setHovered(false);
+    if (hit) hit->setHovered(true);
+    hovered_ = hit;
+}
+
 UIPanel* UIManager::getRootElement() const {
     return root_element_.get();
 }
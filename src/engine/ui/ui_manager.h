@@ -1,5 +1,7 @@
 #pragma once
+#include "ui_spatial_index.h"
 #include <memory>
+#include <vector>
 #include <glm/vec2.hpp>
 
 namespace engine::core {
@@ -17,10 +19,19 @@ namespace engine::ui {
  *
  * 负责UI元素的生命周期管理（通过根元素）、渲染调用和输入事件分发。
  * 每个需要UI的场景（如菜单、游戏HUD）应该拥有一个UIManager实例。
+ *
+ * 元素树被展开为绘制列表和更新列表，只有树结构变化时才重建；
+ * 标记了移除的元素在本帧更新结束后统一移除，遍历过程中不会修改子元素容器。
+ * 可交互元素的边界存入空间索引，每帧只查询一次鼠标下的最上层元素，并设置其悬停标记。
  */
 class UIManager final {
 private:
     std::unique_ptr<UIPanel> root_element_;     ///< @brief 一个UIPanel作为根节点(UI元素)
+    std::vector<UIElement*> draw_list_;         ///< @brief 按绘制顺序排列的可见元素(非拥有指针)
+    std::vector<UIElement*> update_list_;       ///< @brief 需要每帧更新的可见元素(非拥有指针)
+    std::vector<UIElement*> hit_list_;          ///< @brief 参与命中测试的可见元素(非拥有指针)
+    UISpatialIndex spatial_index_;              ///< @brief 命中测试用的空间索引
+    UIElement* hovered_ = nullptr;              ///< @brief 当前鼠标下的最上层元素(非拥有指针)
 
 public:
     UIManager();        ///< @brief 构造函数将创建默认的根节点。
@@ -42,6 +53,9 @@ public:
     UIManager(UIManager&&) = delete;
     UIManager& operator=(UIManager&&) = delete;
 
+private:
+    void refresh(engine::core::Context& context);       ///< @brief 如果元素树发生了变化，移除标记了移除的元素并重建列表和空间索引
+    void updateHover(engine::core::Context& context);   ///< @brief 查询鼠标下的最上层元素，更新悬停标记
 };
 
 } // namespace engine::ui
\ No newline at end of file
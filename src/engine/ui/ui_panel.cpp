@@ -18,8 +18,6 @@ void UIPanel::render(engine::core::Context& context) {
     if (background_color_) {
         context.getRenderer().drawUIFilledRect(getBounds(), background_color_.value());
     }
-
-    UIElement::render(context); // 调用基类渲染方法(绘制子节点)
 }
 
 } // namespace engine::ui 
\ No newline at end of file
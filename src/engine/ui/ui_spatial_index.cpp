@@ -0,0 +1,102 @@
+#include "ui_spatial_index.h"
+#include "ui_element.h"
+#include <algorithm>
+#include <cmath>
+#include <glm/common.hpp>
+
+namespace engine::ui {
+
+void UISpatialIndex::build(const std::vector<UIElement*>& elements) {
+    clear();
+    if (elements.empty()) return;
+
+    // 1. 记录边界，并计算所有边界的包围盒
+    glm::vec2 min_pos{0.0f, 0.0f}, max_pos{0.0f, 0.0f};
+    for (auto* element : elements) {
+        const auto bounds = element->getBounds();
+        if (bounds.size.x <= 0.0f || bounds.size.y <= 0.0f) continue;     // 没有尺寸的元素无法被命中
+        if (elements_.empty()) {
+            min_pos = bounds.position;
+            max_pos = bounds.position + bounds.size;
+        } else {
+            min_pos = glm::min(min_pos, bounds.position);
+            max_pos = glm::max(max_pos, bounds.position + bounds.size);
+        }
+        elements_.push_back(element);
+        bounds_.push_back(bounds);
+    }
+    if (elements_.empty()) return;
+
+    origin_ = min_pos;
+    const auto extent = max_pos - min_pos;
+    cell_size_ = std::max({CELL_SIZE, extent.x / MAX_CELLS_PER_AXIS, extent.y / MAX_CELLS_PER_AXIS});
+    columns_ = std::max(1, static_cast<int>(std::ceil(extent.x / cell_size_)));
+    rows_ = std::max(1, static_cast<int>(std::ceil(extent.y / cell_size_)));
+
+    // 2. 计数排序：先统计每个网格中的元素数量，再依次填入（每个元素可能跨越多个网格）
+    cell_start_.assign(static_cast<size_t>(columns_) * rows_ + 1, 0);
+    for (const auto& bounds : bounds_) {
+        const int c0 = toColumn(bounds.position.x), c1 = toColumn(bounds.position.x + bounds.size.x);
+        const int r0 = toRow(bounds.position.y), r1 = toRow(bounds.position.y + bounds.size.y);
+        for (int r = r0; r <= r1; ++r) {
+            for (int c = c0; c <= c1; ++c) {
+                ++cell_start_[cellIndex(c, r) + 1];
+            }
+        }
+    }
+    for (size_t i = 1; i < cell_start_.size(); ++i) {
+        cell_start_[i] += cell_start_[i - 1];
+    }
+    cell_items_.resize(cell_start_.back());
+    cell_cursor_.assign(cell_start_.begin(), cell_start_.end() - 1);
+    for (std::uint32_t i = 0; i < bounds_.size(); ++i) {
+        const auto& bounds = bounds_[i];
+        const int c0 = toColumn(bounds.position.x), c1 = toColumn(bounds.position.x + bounds.size.x);
+        const int r0 = toRow(bounds.position.y), r1 = toRow(bounds.position.y + bounds.size.y);
+        for (int r = r0; r <= r1; ++r) {
+            for (int c = c0; c <= c1; ++c) {
+                cell_items_[cell_cursor_[cellIndex(c, r)]++] = i;
+            }
+        }
+    }
+}
+
+void UISpatialIndex::clear() {
+    elements_.clear();
+    bounds_.clear();
+    cell_start_.clear();
+    cell_items_.clear();
+    columns_ = 0;
+    rows_ = 0;
+}
+
+UIElement* UISpatialIndex::query(const glm::vec2& point) const {
+    if (elements_.empty()) return nullptr;
+    const auto local = point - origin_;
+    if (local.x < 0.0f || local.y < 0.0f) return nullptr;
+    const int column = static_cast<int>(local.x / cell_size_);
+    const int row = static_cast<int>(local.y / cell_size_);
+    if (column >= columns_ || row >= rows_) return nullptr;
+
+    // 网格内的元素序号是升序的，倒序查找即可得到最上层（最后绘制）的元素
+    const auto cell = cellIndex(column, row);
+    for (auto i = cell_start_[cell + 1]; i > cell_start_[cell]; --i) {
+        const auto index = cell_items_[i - 1];
+        const auto& bounds = bounds_[index];
+        if (point.x >= bounds.position.x && point.x < bounds.position.x + bounds.size.x &&
+            point.y >= bounds.position.y && point.y < bounds.position.y + bounds.size.y) {
+            return elements_[index];
+        }
+    }
+    return nullptr;
+}
+
+int UISpatialIndex::toColumn(float x) const {
+    return std::clamp(static_cast<int>((x - origin_.x) / cell_size_), 0, columns_ - 1);
+}
+
+int UISpatialIndex::toRow(float y) const {
+    return std::clamp(static_cast<int>((y - origin_.y) / cell_size_), 0, rows_ - 1);
+}
+
+} // namespace engine::ui
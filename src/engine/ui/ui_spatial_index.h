@@ -0,0 +1,57 @@
+#pragma once
+#include "engine/utils/math.h"
+#include <cstdint>
+#include <vector>
+#include <glm/vec2.hpp>
+
+namespace engine::ui {
+    class UIElement;
+}
+
+namespace engine::ui {
+
+/**
+ * @brief UI 命中测试用的均匀网格空间索引
+ *
+ * 由 UIManager 在元素树或布局发生变化时，用可交互元素的缓存边界重建；
+ * 查询时只检查鼠标所在网格中的元素，开销与元素总数无关。
+ * 内部数组在重建时复用，元素数量稳定后不再分配内存。
+ */
+class UISpatialIndex final {
+    static constexpr float CELL_SIZE = 64.0f;       ///< @brief 默认网格边长（逻辑像素）
+    static constexpr int MAX_CELLS_PER_AXIS = 64;   ///< @brief 每个方向的最大网格数（元素分布很广时放大网格）
+
+    std::vector<UIElement*> elements_;              ///< @brief 参与命中测试的元素（按绘制顺序，后绘制的在上层）
+    std::vector<engine::utils::Rect> bounds_;       ///< @brief 元素边界（与 elements_ 一一对应）
+    std::vector<std::uint32_t> cell_start_;         ///< @brief 每个网格在 cell_items_ 中的起始位置（长度为网格数 + 1）
+    std::vector<std::uint32_t> cell_items_;         ///< @brief 按网格排列的元素序号
+    std::vector<std::uint32_t> cell_cursor_;        ///< @brief 重建时的填充位置（复用以避免分配）
+    glm::vec2 origin_{0.0f, 0.0f};                  ///< @brief 网格左上角（屏幕坐标）
+    float cell_size_ = CELL_SIZE;                   ///< @brief 实际网格边长
+    int columns_ = 0;
+    int rows_ = 0;
+
+public:
+    /**
+     * @brief 重建索引
+     * @param elements 参与命中测试的元素（按绘制顺序排列）
+     */
+    void build(const std::vector<UIElement*>& elements);
+    void clear();
+
+    /**
+     * @brief 查询位于给定点上的最上层元素
+     * @param point 屏幕坐标
+     * @return 命中的元素，没有命中时返回 nullptr
+     */
+    UIElement* query(const glm::vec2& point) const;
+
+    size_t size() const { return elements_.size(); }
+
+private:
+    int cellIndex(int column, int row) const { return row * columns_ + column; }
+    int toColumn(float x) const;
+    int toRow(float y) const;
+};
+
+} // namespace engine::ui
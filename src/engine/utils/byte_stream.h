@@ -0,0 +1,94 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <entt/entity/entity.hpp>
+
+namespace engine::utils {
+
+/**
+ * @brief 二进制写入工具：把平凡可复制的值按内存布局依次追加到字符串末尾（用于快照、录像等二进制格式）
+ */
+class ByteWriter {
+    std::string& out_;
+
+public:
+    explicit ByteWriter(std::string& out) : out_(out) {}
+
+    template<typename Type>
+    void put(const Type& value) {
+        static_assert(std::is_trivially_copyable_v<Type>);
+        out_.append(reinterpret_cast<const char*>(&value), sizeof(Type));
+    }
+
+    void putString(std::string_view str) {
+        put(static_cast<std::uint32_t>(str.size()));
+        out_.append(str);
+    }
+
+    void putEntity(entt::entity entity) { put(entt::to_integral(entity)); }
+
+    /// @brief 先占位，写完后再用 patch() 回填（用于事先不知道数量的计数）
+    std::size_t reserve() {
+        const auto offset = out_.size();
+        put(std::uint32_t{0});
+        return offset;
+    }
+
+    void patch(std::size_t offset, std::uint32_t value) {
+        std::memcpy(out_.data() + offset, &value, sizeof(value));
+    }
+};
+
+/**
+ * @brief 二进制读取工具：与 ByteWriter 对应。数据不足时不会越界，而是置失败标志并返回默认值，读完后检查 ok()
+ */
+class ByteReader {
+    const char* current_;
+    const char* end_;
+    bool ok_{true};
+
+public:
+    explicit ByteReader(std::string_view data) : current_(data.data()), end_(data.data() + data.size()) {}
+
+    template<typename Type>
+    Type get() {
+        static_assert(std::is_trivially_copyable_v<Type>);
+        Type value{};
+        if (!ok_ || remaining() < sizeof(Type)) {
+            ok_ = false;
+            return value;
+        }
+        std::memcpy(&value, current_, sizeof(Type));
+        current_ += sizeof(Type);
+        return value;
+    }
+
+    std::string getString() {
+        const auto size = get<std::uint32_t>();
+        if (!ok_ || remaining() < size) {
+            ok_ = false;
+            return {};
+        }
+        std::string str(current_, size);
+        current_ += size;
+        return str;
+    }
+
+    entt::entity getEntity() { return entt::entity{get<entt::id_type>()}; }
+
+    /// @brief 读取数量，并粗略检查剩余数据是否足够（每项至少 min_size 字节），防止损坏的数据导致过量分配
+    std::uint32_t getCount(std::size_t min_size) {
+        const auto count = get<std::uint32_t>();
+        if (static_cast<std::size_t>(count) * min_size > remaining()) ok_ = false;
+        return ok_ ? count : 0;
+    }
+
+    std::size_t remaining() const { return static_cast<std::size_t>(end_ - current_); }
+    bool ok() const { return ok_; }
+};
+
+} // namespace engine::utils
@@ -1,5 +1,6 @@
 #pragma once
 #include <memory>
+#include <string>
 #include <entt/entity/entity.hpp>
 
 namespace engine::scene {
@@ -41,6 +42,13 @@ struct AnimationEvent {
 struct PlaySoundEvent {
     entt::entity entity_{entt::null};           ///< @brief 目标实体（可以为空，即播放全局音效）
     entt::id_type sound_id_{entt::null};        ///< @brief 音效ID
+    int priority_{1};                           ///< @brief 优先级（engine::audio::SOUND_PRIORITY_*，默认 NORMAL）
+};
+
+/// @brief 后台文件写入完成事件（由 AsyncFileWriter 在主线程加入队列）
+struct FileWrittenEvent {
+    std::string path_;                          ///< @brief 文件路径
+    bool success_{false};                       ///< @brief 是否写入成功
 };
 
 } // namespace engine::utils
\ No newline at end of file
@@ -0,0 +1,108 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <utility>
+
+namespace engine::utils {
+
+/**
+ * @brief 可设定种子的随机数流（xoshiro128**）
+ *
+ * 同一种子在任何平台、任何标准库实现下都产生相同的序列（不使用 std::uniform_int_distribution 与 std::shuffle，
+ * 它们的结果由标准库实现决定），因此可以配合输入录像完整复现一局游戏。
+ * 由场景持有并放入注册表上下文（engine::utils::Random&），需要随机数的系统从上下文获取。
+ */
+class Random final {
+public:
+    using State = std::array<std::uint32_t, 4>;
+
+private:
+    std::uint64_t seed_{0};     ///< @brief 初始种子
+    State state_{};             ///< @brief 当前状态（可保存到快照中，恢复后继续产生相同的序列）
+
+public:
+    explicit Random(std::uint64_t seed = 0) { setSeed(seed); }
+
+    /// @brief 生成一个不可预测的种子（来自 std::random_device）
+    static std::uint64_t makeSeed() {
+        std::random_device device;
+        return (static_cast<std::uint64_t>(device()) << 32) | device();
+    }
+
+    /// @brief 重新设定种子（用 splitmix64 展开为内部状态）
+    void setSeed(std::uint64_t seed) {
+        seed_ = seed;
+        for (auto& word : state_) {
+            seed += 0x9E3779B97F4A7C15ull;
+            std::uint64_t z = seed;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            word = static_cast<std::uint32_t>((z ^ (z >> 31)) >> 32);
+        }
+    }
+
+    std::uint64_t getSeed() const { return seed_; }
+    const State& getState() const { return state_; }
+    void setState(const State& state) { state_ = state; }
+
+    /// @brief 下一个 32 位随机数
+    std::uint32_t next() {
+        const auto result = rotl(state_[1] * 5, 7) * 9;
+        const auto t = state_[1] << 9;
+        state_[2] ^= state_[0];
+        state_[3] ^= state_[1];
+        state_[1] ^= state_[2];
+        state_[0] ^= state_[3];
+        state_[2] ^= t;
+        state_[3] = rotl(state_[3], 11);
+        return result;
+    }
+
+    /**
+     * @brief 生成 [min, max] 范围内均匀分布的整数（无偏差）
+     */
+    int randomInt(int min, int max) {
+        if (max <= min) return min;
+        const auto range = static_cast<std::uint32_t>(static_cast<std::int64_t>(max) - min) + 1u;
+        if (range == 0u) return static_cast<int>(next());    // 覆盖整个 32 位范围
+        // Lemire 的乘法取区间法，拒绝落在不完整区段的值
+        auto product = static_cast<std::uint64_t>(next()) * range;
+        auto low = static_cast<std::uint32_t>(product);
+        if (low < range) {
+            const auto threshold = (0u - range) % range;
+            while (low < threshold) {
+                product = static_cast<std::uint64_t>(next()) * range;
+                low = static_cast<std::uint32_t>(product);
+            }
+        }
+        return static_cast<int>(static_cast<std::int64_t>(min) + static_cast<std::int64_t>(product >> 32));
+    }
+
+    /**
+     * @brief 生成 [min, max) 范围内均匀分布的浮点数
+     */
+    float randomFloat(float min, float max) {
+        return min + (max - min) * static_cast<float>(next() >> 8) * (1.0f / 16777216.0f);
+    }
+
+    /**
+     * @brief 随机打乱区间（Fisher-Yates）
+     */
+    template<typename RandomIt>
+    void shuffle(RandomIt first, RandomIt last) {
+        const auto size = static_cast<int>(std::distance(first, last));
+        for (int i = size - 1; i > 0; --i) {
+            using std::swap;
+            swap(first[i], first[randomInt(0, i)]);
+        }
+    }
+
+private:
+    static constexpr std::uint32_t rotl(std::uint32_t x, int k) {
+        return (x << k) | (x >> (32 - k));
+    }
+};
+
+} // namespace engine::utils
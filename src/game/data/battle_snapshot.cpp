@@ -0,0 +1,838 @@
+#include "battle_snapshot.h"
+#include "engine/component/name_component.h"
+#include "engine/component/transform_component.h"
+#include "engine/component/sprite_component.h"
+#include "engine/component/render_component.h"
+#include "engine/component/animation_component.h"
+#include "engine/component/audio_component.h"
+#include "engine/component/velocity_component.h"
+#include "engine/component/tilelayer_component.h"
+#include "engine/defs/tags.h"
+#include "engine/utils/byte_stream.h"
+#include "game/component/blocked_by_component.h"
+#include "game/component/blocker_component.h"
+#include "game/component/class_name_component.h"
+#include "game/component/cost_regen_component.h"
+#include "game/component/enemy_component.h"
+#include "game/component/place_occupied_component.h"
+#include "game/component/player_component.h"
+#include "game/component/projectile_component.h"
+#include "game/component/skill_component.h"
+#include "game/component/stats_component.h"
+#include "game/component/target_component.h"
+#include "game/component/unit_prep_component.h"
+#include "game/defs/tags.h"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <unordered_map>
+#include <entt/entity/registry.hpp>
+#include <spdlog/spdlog.h>
+
+namespace game::data {
+
+namespace {
+
+constexpr std::uint32_t MAGIC{0x53534D4D};      ///< @brief "MMSS"
+constexpr std::uint32_t VERSION{3};             ///< @brief 修改快照格式或组件列表时递增
+constexpr std::size_t MIN_ZERO_RUN{8};          ///< @brief 增量编码中短于该长度的相同字节段并入不同字节段
+
+enum class Kind : std::uint32_t {
+    FULL,       ///< @brief 完整快照
+    DELTA,      ///< @brief 增量快照
+};
+
+struct Header {
+    std::uint32_t magic_{MAGIC};
+    std::uint32_t version_{VERSION};
+    Kind kind_{Kind::FULL};
+    std::uint32_t reserved_{0};
+    std::uint64_t size_{0};         ///< @brief 完整快照：数据段字节数；增量快照：还原后的完整快照字节数
+    std::uint64_t base_hash_{0};    ///< @brief 增量快照：基准快照的哈希值
+    std::uint64_t hash_{0};         ///< @brief 完整快照：数据段的哈希值；增量快照：还原后的完整快照的哈希值
+};
+
+static_assert(std::is_trivially_copyable_v<Header>, "快照头部必须是平凡可复制的");
+
+// --- FNV-1a 64 ---
+constexpr std::uint64_t FNV_OFFSET{14695981039346656037ull};
+constexpr std::uint64_t FNV_PRIME{1099511628211ull};
+
+std::uint64_t fnv1a(std::string_view data) {
+    std::uint64_t hash = FNV_OFFSET;
+    for (const auto byte : data) {
+        hash = (hash ^ static_cast<unsigned char>(byte)) * FNV_PRIME;
+    }
+    return hash;
+}
+
+bool readHeader(std::string_view data, Header& header) {
+    if (data.size() < sizeof(Header)) return false;
+    std::memcpy(&header, data.data(), sizeof(Header));
+    return header.magic_ == MAGIC && header.version_ == VERSION;
+}
+
+using Writer = engine::utils::ByteWriter;
+using Reader = engine::utils::ByteReader;
+
+/// @brief 快照中的旧实体 -> 当前注册表中的实体
+class EntityMap {
+    const entt::registry& registry_;
+    std::unordered_map<entt::entity, entt::entity> map_;
+
+public:
+    explicit EntityMap(const entt::registry& registry) : registry_(registry) {}
+
+    void reserve(std::size_t count) { map_.reserve(count); }
+    void add(entt::entity old_entity, entt::entity new_entity) { map_.emplace(old_entity, new_entity); }
+
+    /// @brief 战斗实体映射到新实体；关卡实体不参与快照，id 保持不变；其它（保存时已失效的）实体映射为 null
+    entt::entity operator()(entt::entity old_entity) const {
+        if (old_entity == entt::null) return entt::null;
+        if (auto it = map_.find(old_entity); it != map_.end()) return it->second;
+        if (registry_.valid(old_entity) && BattleSnapshot::isLevelEntity(registry_, old_entity)) return old_entity;
+        return entt::null;
+    }
+};
+
+// ----------------------------- 组件序列化器 -----------------------------
+
+/// @brief 每种需要保存数据的组件都要提供 save()/load()（空类型标签只保存实体，不需要序列化器）
+template<typename Type>
+struct Serializer;
+
+/// @brief 运行时挂到关卡实体上的组件（关卡实体本身不保存，但这些组件需要保存）
+template<typename Type>
+constexpr bool IS_LEVEL_ATTACHMENT = false;
+template<>
+constexpr bool IS_LEVEL_ATTACHMENT<game::component::PlaceOccupiedComponent> = true;
+
+void saveRect(Writer& writer, const engine::utils::Rect& rect) {
+    writer.put(rect.position);
+    writer.put(rect.size);
+}
+
+engine::utils::Rect loadRect(Reader& reader) {
+    auto position = reader.get<glm::vec2>();
+    auto size = reader.get<glm::vec2>();
+    return {position, size};
+}
+
+void saveSprite(Writer& writer, const engine::component::Sprite& sprite) {
+    writer.put(sprite.texture_id_);
+    writer.putString(sprite.texture_path_);
+    saveRect(writer, sprite.src_rect_);
+    writer.put(sprite.is_flipped_);
+}
+
+engine::component::Sprite loadSprite(Reader& reader) {
+    engine::component::Sprite sprite;
+    sprite.texture_id_ = reader.get<entt::id_type>();
+    sprite.texture_path_ = reader.getString();
+    sprite.src_rect_ = loadRect(reader);
+    sprite.is_flipped_ = reader.get<bool>();
+    return sprite;
+}
+
+void saveAnimation(Writer& writer, const engine::component::Animation& animation) {
+    writer.put(static_cast<std::uint32_t>(animation.frames_.size()));
+    for (const auto& frame : animation.frames_) {
+        saveRect(writer, frame.src_rect_);
+        writer.put(frame.duration_ms_);
+    }
+    writer.put(static_cast<std::uint32_t>(animation.events_.size()));
+    for (const auto& [frame_index, event_id] : animation.events_) {
+        writer.put(static_cast<std::int32_t>(frame_index));
+        writer.put(event_id);
+    }
+    writer.put(animation.loop_);
+}
+
+engine::component::Animation loadAnimation(Reader& reader) {
+    std::vector<engine::component::AnimationFrame> frames;
+    const auto frame_count = reader.getCount(sizeof(engine::utils::Rect) + sizeof(float));
+    frames.reserve(frame_count);
+    for (std::uint32_t i = 0; i < frame_count; ++i) {
+        auto src_rect = loadRect(reader);
+        frames.emplace_back(src_rect, reader.get<float>());
+    }
+    std::unordered_map<int, entt::id_type> events;
+    const auto event_count = reader.getCount(sizeof(std::int32_t) + sizeof(entt::id_type));
+    for (std::uint32_t i = 0; i < event_count; ++i) {
+        auto frame_index = reader.get<std::int32_t>();
+        events[frame_index] = reader.get<entt::id_type>();
+    }
+    const auto loop = reader.get<bool>();
+    return engine::component::Animation(std::move(frames), std::move(events), loop);
+}
+
+template<>
+struct Serializer<engine::component::NameComponent> {
+    static void save(Writer& writer, const engine::component::NameComponent& name) {
+        writer.put(name.name_id_);
+        writer.putString(name.name_);
+    }
+    static engine::component::NameComponent load(Reader& reader, const EntityMap&) {
+        auto name_id = reader.get<entt::id_type>();
+        return {name_id, reader.getString()};
+    }
+};
+
+template<>
+struct Serializer<engine::component::TransformComponent> {
+    static void save(Writer& writer, const engine::component::TransformComponent& transform) {
+        writer.put(transform.position_);
+        writer.put(transform.scale_);
+        writer.put(transform.rotation_);
+    }
+    static engine::component::TransformComponent load(Reader& reader, const EntityMap&) {
+        auto position = reader.get<glm::vec2>();
+        auto scale = reader.get<glm::vec2>();
+        return engine::component::TransformComponent(position, scale, reader.get<float>());
+    }
+};
+
+template<>
+struct Serializer<engine::component::SpriteComponent> {
+    static void save(Writer& writer, const engine::component::SpriteComponent& sprite) {
+        saveSprite(writer, sprite.sprite_);
+        writer.put(sprite.size_);
+        writer.put(sprite.offset_);
+        writer.put(sprite.is_visible_);
+    }
+    static engine::component::SpriteComponent load(Reader& reader, const EntityMap&) {
+        engine::component::SpriteComponent sprite(loadSprite(reader));
+        sprite.size_ = reader.get<glm::vec2>();     // 构造函数会在尺寸为0时改用源矩形尺寸，这里直接覆盖为保存的值
+        sprite.offset_ = reader.get<glm::vec2>();
+        sprite.is_visible_ = reader.get<bool>();
+        return sprite;
+    }
+};
+
+template<>
+struct Serializer<engine::component::RenderComponent> {
+    static void save(Writer& writer, const engine::component::RenderComponent& render) {
+        writer.put(static_cast<std::int32_t>(render.layer));
+        writer.put(render.depth);
+        writer.put(render.color_);
+    }
+    static engine::component::RenderComponent load(Reader& reader, const EntityMap&) {
+        auto layer = reader.get<std::int32_t>();
+        auto depth = reader.get<float>();
+        return engine::component::RenderComponent(layer, depth, reader.get<engine::utils::FColor>());
+    }
+};
+
+template<>
+struct Serializer<engine::component::AnimationComponent> {
+    static void save(Writer& writer, const engine::component::AnimationComponent& animation) {
+        writer.put(static_cast<std::uint32_t>(animation.animations_.size()));
+        for (const auto& [id, anim] : animation.animations_) {
+            writer.put(id);
+            saveAnimation(writer, anim);
+        }
+        writer.put(animation.current_animation_id_);
+        writer.put(static_cast<std::uint64_t>(animation.current_frame_index_));
+        writer.put(animation.current_time_ms_);
+        writer.put(animation.speed_);
+    }
+    static engine::component::AnimationComponent load(Reader& reader, const EntityMap&) {
+        std::unordered_map<entt::id_type, engine::component::Animation> animations;
+        const auto count = reader.getCount(sizeof(entt::id_type));
+        animations.reserve(count);
+        for (std::uint32_t i = 0; i < count; ++i) {
+            auto id = reader.get<entt::id_type>();
+            animations.emplace(id, loadAnimation(reader));
+        }
+        auto current_animation_id = reader.get<entt::id_type>();
+        auto current_frame_index = static_cast<std::size_t>(reader.get<std::uint64_t>());
+        auto current_time_ms = reader.get<float>();
+        return {std::move(animations), current_animation_id, current_frame_index, current_time_ms, reader.get<float>()};
+    }
+};
+
+template<>
+struct Serializer<engine::component::AudioComponent> {
+    static void save(Writer& writer, const engine::component::AudioComponent& audio) {
+        writer.put(static_cast<std::uint32_t>(audio.sounds_.size()));
+        for (const auto& [key, sound_id] : audio.sounds_) {
+            writer.put(key);
+            writer.put(sound_id);
+        }
+    }
+    static engine::component::AudioComponent load(Reader& reader, const EntityMap&) {
+        engine::component::AudioComponent audio;
+        const auto count = reader.getCount(2 * sizeof(entt::id_type));
+        audio.sounds_.reserve(count);
+        for (std::uint32_t i = 0; i < count; ++i) {
+            auto key = reader.get<entt::id_type>();
+            audio.sounds_[key] = reader.get<entt::id_type>();
+        }
+        return audio;
+    }
+};
+
+template<>
+struct Serializer<engine::component::VelocityComponent> {
+    static void save(Writer& writer, const engine::component::VelocityComponent& velocity) {
+        writer.put(velocity.velocity_);
+    }
+    static engine::component::VelocityComponent load(Reader& reader, const EntityMap&) {
+        return {reader.get<glm::vec2>()};
+    }
+};
+
+template<>
+struct Serializer<game::component::BlockedByComponent> {
+    static void save(Writer& writer, const game::component::BlockedByComponent& blocked_by) {
+        writer.putEntity(blocked_by.entity_);
+    }
+    static game::component::BlockedByComponent load(Reader& reader, const EntityMap& map) {
+        return {map(reader.getEntity())};
+    }
+};
+
+template<>
+struct Serializer<game::component::BlockerComponent> {
+    static void save(Writer& writer, const game::component::BlockerComponent& blocker) {
+        writer.put(static_cast<std::int32_t>(blocker.max_count_));
+        writer.put(static_cast<std::int32_t>(blocker.current_count_));
+    }
+    static game::component::BlockerComponent load(Reader& reader, const EntityMap&) {
+        auto max_count = reader.get<std::int32_t>();
+        return {max_count, reader.get<std::int32_t>()};
+    }
+};
+
+template<>
+struct Serializer<game::component::ClassNameComponent> {
+    static void save(Writer& writer, const game::component::ClassNameComponent& class_name) {
+        writer.put(class_name.class_id_);
+        writer.putString(class_name.class_name_);
+    }
+    static game::component::ClassNameComponent load(Reader& reader, const EntityMap&) {
+        auto class_id = reader.get<entt::id_type>();
+        return {class_id, reader.getString()};
+    }
+};
+
+template<>
+struct Serializer<game::component::CostRegenComponent> {
+    static void save(Writer& writer, const game::component::CostRegenComponent& cost_regen) {
+        writer.put(cost_regen.rate_);
+    }
+    static game::component::CostRegenComponent load(Reader& reader, const EntityMap&) {
+        return {reader.get<float>()};
+    }
+};
+
+template<>
+struct Serializer<game::component::EnemyComponent> {
+    static void save(Writer& writer, const game::component::EnemyComponent& enemy) {
+        writer.put(static_cast<std::int32_t>(enemy.target_waypoint_id_));
+        writer.put(enemy.speed_);
+    }
+    static game::component::EnemyComponent load(Reader& reader, const EntityMap&) {
+        auto target_waypoint_id = reader.get<std::int32_t>();
+        return {target_waypoint_id, reader.get<float>()};
+    }
+};
+
+template<>
+struct Serializer<game::component::PlaceOccupiedComponent> {
+    static void save(Writer& writer, const game::component::PlaceOccupiedComponent& place_occupied) {
+        writer.putEntity(place_occupied.entity_);
+    }
+    static game::component::PlaceOccupiedComponent load(Reader& reader, const EntityMap& map) {
+        return {map(reader.getEntity())};
+    }
+};
+
+template<>
+struct Serializer<game::component::PlayerComponent> {
+    static void save(Writer& writer, const game::component::PlayerComponent& player) {
+        writer.put(static_cast<std::int32_t>(player.cost_));
+    }
+    static game::component::PlayerComponent load(Reader& reader, const EntityMap&) {
+        return {reader.get<std::int32_t>()};
+    }
+};
+
+template<>
+struct Serializer<game::component::ProjectileComponent> {
+    static void save(Writer& writer, const game::component::ProjectileComponent& projectile) {
+        writer.putEntity(projectile.target_);
+        writer.put(projectile.damage_);
+        writer.put(projectile.start_position_);
+        writer.put(projectile.target_position_);
+        writer.put(projectile.previous_position_);
+        writer.put(projectile.arc_height_);
+        writer.put(projectile.total_flight_time_);
+        writer.put(projectile.current_flight_time_);
+    }
+    static game::component::ProjectileComponent load(Reader& reader, const EntityMap& map) {
+        game::component::ProjectileComponent projectile;
+        projectile.target_ = map(reader.getEntity());
+        projectile.damage_ = reader.get<float>();
+        projectile.start_position_ = reader.get<glm::vec2>();
+        projectile.target_position_ = reader.get<glm::vec2>();
+        projectile.previous_position_ = reader.get<glm::vec2>();
+        projectile.arc_height_ = reader.get<float>();
+        projectile.total_flight_time_ = reader.get<float>();
+        projectile.current_flight_time_ = reader.get<float>();
+        return projectile;
+    }
+};
+
+template<>
+struct Serializer<game::component::ProjectileIDComponent> {
+    static void save(Writer& writer, const game::component::ProjectileIDComponent& projectile_id) {
+        writer.put(projectile_id.id_);
+    }
+    static game::component::ProjectileIDComponent load(Reader& reader, const EntityMap&) {
+        return {reader.get<entt::id_type>()};
+    }
+};
+
+template<>
+struct Serializer<game::component::SkillComponent> {
+    static void save(Writer& writer, const game::component::SkillComponent& skill) {
+        writer.put(skill.skill_id_);
+        writer.putEntity(skill.display_entity_);
+        writer.putString(skill.name_);
+        writer.putString(skill.description_);
+        writer.put(skill.cooldown_);
+        writer.put(skill.duration_);
+        writer.put(skill.cooldown_timer_);
+        writer.put(skill.duration_timer_);
+    }
+    static game::component::SkillComponent load(Reader& reader, const EntityMap& map) {
+        game::component::SkillComponent skill;
+        skill.skill_id_ = reader.get<entt::id_type>();
+        skill.display_entity_ = map(reader.getEntity());
+        skill.name_ = reader.getString();
+        skill.description_ = reader.getString();
+        skill.cooldown_ = reader.get<float>();
+        skill.duration_ = reader.get<float>();
+        skill.cooldown_timer_ = reader.get<float>();
+        skill.duration_timer_ = reader.get<float>();
+        return skill;
+    }
+};
+
+template<>
+struct Serializer<game::component::StatsComponent> {
+    static void save(Writer& writer, const game::component::StatsComponent& stats) {
+        writer.put(stats.hp_);
+        writer.put(stats.max_hp_);
+        writer.put(stats.atk_);
+        writer.put(stats.def_);
+        writer.put(stats.range_);
+        writer.put(stats.atk_interval_);
+        writer.put(stats.atk_timer_);
+        writer.put(static_cast<std::int32_t>(stats.level_));
+        writer.put(static_cast<std::int32_t>(stats.rarity_));
+    }
+    static game::component::StatsComponent load(Reader& reader, const EntityMap&) {
+        game::component::StatsComponent stats;
+        stats.hp_ = reader.get<float>();
+        stats.max_hp_ = reader.get<float>();
+        stats.atk_ = reader.get<float>();
+        stats.def_ = reader.get<float>();
+        stats.range_ = reader.get<float>();
+        stats.atk_interval_ = reader.get<float>();
+        stats.atk_timer_ = reader.get<float>();
+        stats.level_ = reader.get<std::int32_t>();
+        stats.rarity_ = reader.get<std::int32_t>();
+        return stats;
+    }
+};
+
+template<>
+struct Serializer<game::component::TargetComponent> {
+    static void save(Writer& writer, const game::component::TargetComponent& target) {
+        writer.putEntity(target.entity_);
+    }
+    static game::component::TargetComponent load(Reader& reader, const EntityMap& map) {
+        return {map(reader.getEntity())};
+    }
+};
+
+template<>
+struct Serializer<game::component::UnitPrepComponent> {
+    static void save(Writer& writer, const game::component::UnitPrepComponent& unit_prep) {
+        writer.put(unit_prep.name_id_);
+        writer.put(static_cast<std::int32_t>(unit_prep.type_));
+        writer.put(unit_prep.range_);
+        writer.put(static_cast<std::int32_t>(unit_prep.cost_));
+    }
+    static game::component::UnitPrepComponent load(Reader& reader, const EntityMap&) {
+        game::component::UnitPrepComponent unit_prep;
+        unit_prep.name_id_ = reader.get<entt::id_type>();
+        unit_prep.type_ = static_cast<game::defs::PlayerType>(reader.get<std::int32_t>());
+        unit_prep.range_ = reader.get<float>();
+        unit_prep.cost_ = reader.get<std::int32_t>();
+        return unit_prep;
+    }
+};
+
+// ----------------------------- 组件存储 -----------------------------
+
+/// @brief 快照保存的组件类型（每种一段：类型哈希、数量、逐个实体的数据）
+template<typename... Component>
+struct ComponentList {
+    /// @brief 战斗实体上的组件是否都在列表中（VisibleTag 每帧重新计算，不需要保存）
+    static bool covers(const entt::registry& registry) {
+        static constexpr std::array<entt::id_type, sizeof...(Component) + 2> IDS{
+            entt::type_hash<entt::entity>::value(), entt::type_hash<engine::defs::VisibleTag>::value(),
+            entt::type_hash<Component>::value()...
+        };
+        for (auto [id, storage] : registry.storage()) {
+            if (std::find(IDS.begin(), IDS.end(), id) != IDS.end()) continue;
+            const bool on_battle_entity = std::any_of(storage.begin(), storage.end(), [&registry](auto entity) {
+                return !BattleSnapshot::isLevelEntity(registry, entity);
+            });
+            if (on_battle_entity) {
+                spdlog::warn("战斗快照不支持保存组件存储 '{}'", storage.type().name());
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static void save(Writer& writer, const entt::registry& registry) {
+        (saveStorage<Component>(writer, registry), ...);
+    }
+
+    static bool load(Reader& reader, entt::registry& registry, const EntityMap& map) {
+        return (loadStorage<Component>(reader, registry, map) && ...);
+    }
+
+    template<typename Type>
+    static void saveStorage(Writer& writer, const entt::registry& registry) {
+        writer.put(entt::type_hash<Type>::value());
+        const auto count_offset = writer.reserve();
+        std::uint32_t count = 0;
+        const auto* storage = registry.storage<Type>();
+        if (!storage) return;
+        if constexpr (entt::component_traits<Type>::page_size == 0u) {     // 空类型（标签）只保存实体
+            for (auto [entity] : storage->each()) {
+                if (BattleSnapshot::isLevelEntity(registry, entity)) continue;
+                writer.putEntity(entity);
+                ++count;
+            }
+        } else {
+            for (auto [entity, value] : storage->each()) {
+                if (!IS_LEVEL_ATTACHMENT<Type> && BattleSnapshot::isLevelEntity(registry, entity)) continue;
+                writer.putEntity(entity);
+                Serializer<Type>::save(writer, value);
+                ++count;
+            }
+        }
+        writer.patch(count_offset, count);
+    }
+
+    template<typename Type>
+    static bool loadStorage(Reader& reader, entt::registry& registry, const EntityMap& map) {
+        if (reader.get<entt::id_type>() != entt::type_hash<Type>::value()) {
+            spdlog::error("战斗快照的组件段与当前版本不一致: {}", entt::type_id<Type>().name());
+            return false;
+        }
+        const auto count = reader.getCount(sizeof(entt::id_type));
+        auto& storage = registry.storage<Type>();
+        storage.reserve(storage.size() + count);
+        for (std::uint32_t i = 0; i < count; ++i) {
+            const auto entity = map(reader.getEntity());
+            if constexpr (entt::component_traits<Type>::page_size == 0u) {
+                if (!reader.ok()) break;
+                if (entity != entt::null && !storage.contains(entity)) storage.emplace(entity);
+            } else {
+                auto value = Serializer<Type>::load(reader, map);
+                if (!reader.ok()) break;
+                if (entity != entt::null && !storage.contains(entity)) storage.emplace(entity, std::move(value));
+            }
+        }
+        return reader.ok();
+    }
+};
+
+using BattleComponents = ComponentList<
+    engine::component::NameComponent,
+    engine::component::TransformComponent,
+    engine::component::SpriteComponent,
+    engine::component::RenderComponent,
+    engine::component::AnimationComponent,
+    engine::component::AudioComponent,
+    engine::component::VelocityComponent,
+    engine::defs::FollowCursorTag,
+    game::component::BlockedByComponent,
+    game::component::BlockerComponent,
+    game::component::ClassNameComponent,
+    game::component::CostRegenComponent,
+    game::component::EnemyComponent,
+    game::component::PlaceOccupiedComponent,
+    game::component::PlayerComponent,
+    game::component::ProjectileComponent,
+    game::component::ProjectileIDComponent,
+    game::component::SkillComponent,
+    game::component::StatsComponent,
+    game::component::TargetComponent,
+    game::component::UnitPrepComponent,
+    game::defs::DeadTag,
+    game::defs::FaceLeftTag,
+    game::defs::MeleeUnitTag,
+    game::defs::RangedUnitTag,
+    game::defs::HealerTag,
+    game::defs::AttackReadyTag,
+    game::defs::InjuredTag,
+    game::defs::ActionLockTag,
+    game::defs::OneShotRemoveTag,
+    game::defs::HasHealthBarTag,
+    game::defs::ShowRangeTag,
+    game::defs::SkillReadyTag,
+    game::defs::SkillActiveTag,
+    game::defs::PassiveSkillTag
+>;
+
+// ----------------------------- 场景状态 -----------------------------
+
+void saveState(Writer& writer, const BattleState& state) {
+    const auto& stats = state.game_stats_;
+    writer.put(stats.cost_);
+    writer.put(stats.cost_gen_per_second_);
+    writer.put(static_cast<std::int32_t>(stats.home_hp_));
+    writer.put(static_cast<std::int32_t>(stats.enemy_count_));
+    writer.put(static_cast<std::int32_t>(stats.enemy_arrived_count_));
+    writer.put(static_cast<std::int32_t>(stats.enemy_killed_count_));
+
+    writer.put(state.waves_.next_wave_count_down_);
+    auto waves = state.waves_.waves_;   // std::queue 不能遍历，复制一份依次弹出
+    writer.put(static_cast<std::uint32_t>(waves.size()));
+    for (; !waves.empty(); waves.pop()) {
+        const auto& wave = waves.front();
+        writer.put(wave.next_wave_interval_);
+        writer.put(wave.spawn_interval_);
+        writer.put(static_cast<std::uint32_t>(wave.enemy_types_.size()));
+        for (const auto& [class_id, count] : wave.enemy_types_) {
+            writer.put(class_id);
+            writer.put(static_cast<std::int32_t>(count));
+        }
+    }
+
+    writer.put(state.spawn_timer_);
+    writer.put(state.spawn_interval_);
+    writer.put(static_cast<std::uint32_t>(state.spawn_queue_.size()));
+    for (const auto class_id : state.spawn_queue_) {
+        writer.put(class_id);
+    }
+
+    writer.put(state.is_level_clear_);
+    writer.put(state.level_clear_timer_);
+
+    writer.put(static_cast<std::uint32_t>(state.portraits_.size()));
+    for (const auto name_id : state.portraits_) {
+        writer.put(name_id);
+    }
+
+    writer.put(state.random_state_);
+}
+
+bool loadState(Reader& reader, BattleState& state) {
+    auto& stats = state.game_stats_;
+    stats.cost_ = reader.get<float>();
+    stats.cost_gen_per_second_ = reader.get<float>();
+    stats.home_hp_ = reader.get<std::int32_t>();
+    stats.enemy_count_ = reader.get<std::int32_t>();
+    stats.enemy_arrived_count_ = reader.get<std::int32_t>();
+    stats.enemy_killed_count_ = reader.get<std::int32_t>();
+
+    state.waves_ = {};
+    state.waves_.next_wave_count_down_ = reader.get<float>();
+    const auto wave_count = reader.getCount(2 * sizeof(float) + sizeof(std::uint32_t));
+    for (std::uint32_t i = 0; i < wave_count; ++i) {
+        Wave wave;
+        wave.next_wave_interval_ = reader.get<float>();
+        wave.spawn_interval_ = reader.get<float>();
+        const auto type_count = reader.getCount(sizeof(entt::id_type) + sizeof(std::int32_t));
+        wave.enemy_types_.reserve(type_count);
+        for (std::uint32_t j = 0; j < type_count; ++j) {
+            auto class_id = reader.get<entt::id_type>();
+            wave.enemy_types_.emplace_back(class_id, reader.get<std::int32_t>());
+        }
+        state.waves_.waves_.push(std::move(wave));
+    }
+
+    state.spawn_timer_ = reader.get<float>();
+    state.spawn_interval_ = reader.get<float>();
+    state.spawn_queue_.clear();
+    const auto queue_count = reader.getCount(sizeof(entt::id_type));
+    for (std::uint32_t i = 0; i < queue_count; ++i) {
+        state.spawn_queue_.push_back(reader.get<entt::id_type>());
+    }
+
+    state.is_level_clear_ = reader.get<bool>();
+    state.level_clear_timer_ = reader.get<float>();
+
+    state.portraits_.clear();
+    const auto portrait_count = reader.getCount(sizeof(entt::id_type));
+    state.portraits_.reserve(portrait_count);
+    for (std::uint32_t i = 0; i < portrait_count; ++i) {
+        state.portraits_.push_back(reader.get<entt::id_type>());
+    }
+
+    state.random_state_ = reader.get<engine::utils::Random::State>();
+    return reader.ok();
+}
+
+} // namespace
+
+bool BattleSnapshot::isLevelEntity(const entt::registry& registry, entt::entity entity) {
+    return registry.any_of<engine::defs::StaticTag, engine::component::TileLayerComponent>(entity);
+}
+
+bool BattleSnapshot::capture(const entt::registry& registry, const BattleState& state, std::string& out) {
+    if (!BattleComponents::covers(registry)) {
+        return false;
+    }
+    out.clear();
+    out.resize(sizeof(Header));
+    Writer writer(out);
+
+    // 1. 场景状态
+    saveState(writer, state);
+
+    // 2. 战斗实体（旧 id，恢复时据此建立映射）
+    const auto count_offset = writer.reserve();
+    std::uint32_t entity_count = 0;
+    if (const auto* entities = registry.storage<entt::entity>(); entities) {
+        for (auto [entity] : entities->each()) {
+            if (isLevelEntity(registry, entity)) continue;
+            writer.putEntity(entity);
+            ++entity_count;
+        }
+    }
+    writer.patch(count_offset, entity_count);
+
+    // 3. 各组件存储
+    BattleComponents::save(writer, registry);
+
+    Header header;
+    header.kind_ = Kind::FULL;
+    header.size_ = out.size() - sizeof(Header);
+    header.hash_ = fnv1a(std::string_view(out).substr(sizeof(Header)));
+    std::memcpy(out.data(), &header, sizeof(Header));
+    spdlog::debug("战斗快照已保存：{} 个实体，{} 字节", entity_count, out.size());
+    return true;
+}
+
+bool BattleSnapshot::restore(std::string_view data, entt::registry& registry, BattleState& state) {
+    Header header;
+    if (!readHeader(data, header) || header.kind_ != Kind::FULL) {
+        spdlog::error("战斗快照格式或版本不正确");
+        return false;
+    }
+    const auto payload = data.substr(sizeof(Header));
+    if (payload.size() != header.size_ || fnv1a(payload) != header.hash_) {
+        spdlog::error("战斗快照数据已损坏");
+        return false;
+    }
+    Reader reader(payload);
+
+    // 1. 场景状态
+    if (!loadState(reader, state)) {
+        spdlog::error("读取战斗快照的场景状态失败");
+        return false;
+    }
+
+    // 2. 创建实体：尽量沿用旧 id（id 空闲时），否则由 EntityMap 映射到新实体
+    EntityMap map(registry);
+    const auto entity_count = reader.getCount(sizeof(entt::id_type));
+    map.reserve(entity_count);
+    for (std::uint32_t i = 0; i < entity_count; ++i) {
+        const auto old_entity = reader.getEntity();
+        map.add(old_entity, registry.create(old_entity));
+    }
+
+    // 3. 各组件存储（组件中的实体引用按映射修正）
+    if (!reader.ok() || !BattleComponents::load(reader, registry, map)) {
+        spdlog::error("读取战斗快照的组件数据失败");
+        return false;
+    }
+    spdlog::debug("战斗快照已恢复：{} 个实体", entity_count);
+    return true;
+}
+
+std::string BattleSnapshot::encodeDelta(std::string_view base, std::string_view snapshot) {
+    // 目标快照与基准快照（长度不足时视为补零）逐字节异或，相同的字节为0
+    const auto diff = [&](std::size_t i) -> char {
+        return i < base.size() ? static_cast<char>(snapshot[i] ^ base[i]) : snapshot[i];
+    };
+
+    std::string out(sizeof(Header), '\0');
+    Writer writer(out);
+    // 游程编码：重复 [相同字节数][不同字节数][不同字节的异或值...]
+    const auto size = snapshot.size();
+    std::size_t i = 0;
+    while (i < size) {
+        const auto zero_start = i;
+        while (i < size && diff(i) == 0) ++i;
+        const auto literal_start = i;
+        auto literal_end = i;
+        for (auto j = i; j < size && j - literal_end < MIN_ZERO_RUN; ++j) {
+            if (diff(j) != 0) literal_end = j + 1;
+        }
+        writer.put(static_cast<std::uint32_t>(literal_start - zero_start));
+        writer.put(static_cast<std::uint32_t>(literal_end - literal_start));
+        for (auto k = literal_start; k < literal_end; ++k) {
+            writer.put(diff(k));
+        }
+        i = literal_end;
+    }
+
+    Header header;
+    header.kind_ = Kind::DELTA;
+    header.size_ = size;
+    header.base_hash_ = fnv1a(base);
+    header.hash_ = fnv1a(snapshot);
+    std::memcpy(out.data(), &header, sizeof(Header));
+    return out;
+}
+
+bool BattleSnapshot::decodeDelta(std::string_view base, std::string_view delta, std::string& snapshot) {
+    Header header;
+    if (!readHeader(delta, header) || header.kind_ != Kind::DELTA) {
+        spdlog::error("增量快照格式或版本不正确");
+        return false;
+    }
+    if (fnv1a(base) != header.base_hash_) {
+        spdlog::error("增量快照与基准快照不匹配");
+        return false;
+    }
+
+    const auto size = static_cast<std::size_t>(header.size_);
+    std::string out(size, '\0');
+    std::memcpy(out.data(), base.data(), std::min(size, base.size()));
+    Reader reader(delta.substr(sizeof(Header)));
+    std::size_t position = 0;
+    while (reader.remaining() > 0) {
+        position += reader.get<std::uint32_t>();
+        const auto literal_size = reader.get<std::uint32_t>();
+        if (!reader.ok() || position > size || literal_size > size - position || literal_size > reader.remaining()) {
+            spdlog::error("增量快照数据已损坏");
+            return false;
+        }
+        for (std::uint32_t k = 0; k < literal_size; ++k) {
+            out[position++] ^= reader.get<char>();
+        }
+    }
+    if (fnv1a(out) != header.hash_) {
+        spdlog::error("增量快照还原结果校验失败");
+        return false;
+    }
+    snapshot = std::move(out);
+    return true;
+}
+
+} // namespace game::data
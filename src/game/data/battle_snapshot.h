@@ -0,0 +1,84 @@
+#pragma once
+#include "game/data/game_stats.h"
+#include "game/data/level_data.h"
+#include "engine/utils/random.h"
+#include <deque>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <entt/entity/fwd.hpp>
+
+namespace game::data {
+
+/**
+ * @brief 战斗状态中不在注册表组件里的部分（由 GameScene 从各系统收集，恢复时再写回）
+ */
+struct BattleState {
+    GameStats game_stats_;                      ///< @brief 关卡内统计数据
+    Waves waves_;                               ///< @brief 剩余波次
+    float spawn_timer_{0.0f};                   ///< @brief EnemySpawner 波次内生成计时器
+    float spawn_interval_{0.0f};                ///< @brief EnemySpawner 波次内生成间隔
+    std::deque<entt::id_type> spawn_queue_;     ///< @brief EnemySpawner 当前波次剩余的敌人
+    bool is_level_clear_{false};                ///< @brief GameRuleSystem 是否已通关
+    float level_clear_timer_{0.0f};             ///< @brief GameRuleSystem 通关计时器
+    std::vector<entt::id_type> portraits_;      ///< @brief 尚未出击的角色肖像（名称ID）
+    engine::utils::Random::State random_state_{};   ///< @brief 场景随机数流的状态（恢复后随机结果与保存时一致）
+};
+
+/**
+ * @brief 战斗快照：GameScene 注册表中战斗实体及 BattleState 的二进制副本，用于检查点与瞬间重试。
+ *
+ * - 只保存“战斗实体”（没有 StaticTag 和 TileLayerComponent 的实体），关卡实体在场景中保持不变；
+ *   运行时挂到关卡实体上的组件（PlaceOccupiedComponent）也一并保存；
+ * - 每种组件由 battle_snapshot.cpp 中的序列化器逐字段写入，读取时按旧实体 -> 新实体的映射修正组件中的实体引用；
+ * - 文件头包含魔数、版本、类型（完整/增量）和内容哈希，版本或组件列表变化后旧快照会被拒绝；
+ * - 增量快照：与基准快照逐字节异或后做游程编码，连续的检查点之间大部分字节相同，体积远小于完整快照。
+ *
+ * 未使用 entt::snapshot_loader：它要求组件可默认构造，而 TransformComponent 等组件没有默认构造函数。
+ */
+class BattleSnapshot final {
+public:
+    BattleSnapshot() = delete;
+
+    /**
+     * @brief 保存完整快照
+     * @param registry 场景注册表
+     * @param state 场景状态
+     * @param out 输出：快照数据
+     * @return 是否成功（战斗实体上有未支持的组件时返回 false）
+     */
+    static bool capture(const entt::registry& registry, const BattleState& state, std::string& out);
+
+    /**
+     * @brief 从完整快照恢复
+     * @param data 快照数据
+     * @param registry 场景注册表（调用前需已销毁所有战斗实体并移除关卡实体上的 PlaceOccupiedComponent）
+     * @param state 输出：场景状态
+     * @return 是否成功（数据无效时注册表可能已部分恢复，调用者应重新开始关卡）
+     */
+    static bool restore(std::string_view data, entt::registry& registry, BattleState& state);
+
+    /**
+     * @brief 判断实体是否属于关卡（快照不保存、恢复时保留的实体）
+     */
+    static bool isLevelEntity(const entt::registry& registry, entt::entity entity);
+
+    /**
+     * @brief 生成增量快照
+     * @param base 基准快照（完整快照）
+     * @param snapshot 目标快照（完整快照）
+     * @return 增量数据，配合同一基准由 decodeDelta() 还原出目标快照
+     */
+    static std::string encodeDelta(std::string_view base, std::string_view snapshot);
+
+    /**
+     * @brief 还原增量快照
+     * @param base 基准快照（必须与生成增量时的基准一致）
+     * @param delta 增量数据
+     * @param snapshot 输出：完整快照
+     * @return 是否成功
+     */
+    static bool decodeDelta(std::string_view base, std::string_view delta, std::string& snapshot);
+};
+
+} // namespace game::data
@@ -0,0 +1,163 @@
+#include "level_template.h"
+#include "engine/loader/tile_chunk_map.h"
+#include "engine/component/name_component.h"
+#include "engine/component/transform_component.h"
+#include "engine/component/parallax_component.h"
+#include "engine/component/sprite_component.h"
+#include "engine/component/render_component.h"
+#include "engine/component/tilelayer_component.h"
+#include "engine/component/animation_component.h"
+#include "engine/defs/tags.h"
+#include "game/defs/tags.h"
+#include <algorithm>
+#include <array>
+#include <spdlog/spdlog.h>
+
+namespace game::data {
+
+namespace {
+
+/// @brief 关卡载入器（BasicEntityBuilder / EntityBuilderMW）可能生成的组件类型
+template<typename... Component>
+struct ComponentList {
+    /// @brief 注册表中的组件是否都在列表中
+    static bool covers(const entt::registry& registry) {
+        static constexpr std::array<entt::id_type, sizeof...(Component) + 1> IDS{
+            entt::type_hash<entt::entity>::value(), entt::type_hash<Component>::value()...
+        };
+        for (auto [id, storage] : registry.storage()) {
+            if (storage.empty() || std::find(IDS.begin(), IDS.end(), id) != IDS.end()) continue;
+            spdlog::warn("关卡模板不支持复制组件存储 '{}'", storage.type().name());
+            return false;
+        }
+        return true;
+    }
+
+    /// @brief 复制所有实体（保持实体 id）及列表中的组件
+    static void copy(const entt::registry& from, entt::registry& to) {
+        if (const auto* entities = from.storage<entt::entity>(); entities) {
+            for (auto [entity] : entities->each()) {
+                [[maybe_unused]] const auto created = to.create(entity);
+            }
+        }
+        (copyStorage<Component>(from, to), ...);
+    }
+
+    /// @brief 只复制指定实体（保持实体 id）及其拥有的列表中的组件
+    static void copyEntities(const entt::registry& from, entt::registry& to, std::span<const entt::entity> entities) {
+        for (auto entity : entities) {
+            if (!from.valid(entity)) continue;
+            [[maybe_unused]] const auto created = to.create(entity);
+            (copyComponent<Component>(from, to, entity), ...);
+        }
+    }
+
+    template<typename Type>
+    static void copyComponent(const entt::registry& from, entt::registry& to, entt::entity entity) {
+        const auto* source = from.storage<Type>();
+        if (!source || !source->contains(entity)) return;
+        if constexpr (entt::component_traits<Type>::page_size == 0u) {
+            to.storage<Type>().emplace(entity);
+        } else {
+            to.storage<Type>().emplace(entity, source->get(entity));
+        }
+    }
+
+    template<typename Type>
+    static void copyStorage(const entt::registry& from, entt::registry& to) {
+        const auto* source = from.storage<Type>();
+        if (!source || source->empty()) return;
+        auto& target = to.storage<Type>();
+        target.reserve(target.size() + source->size());
+        if constexpr (entt::component_traits<Type>::page_size == 0u) {     // 空类型（标签）不保存实例
+            for (auto [entity] : source->each()) {
+                target.emplace(entity);
+            }
+        } else {
+            for (auto [entity, value] : source->each()) {
+                target.emplace(entity, value);
+            }
+        }
+    }
+};
+
+using LevelComponents = ComponentList<
+    engine::component::NameComponent,
+    engine::component::TransformComponent,
+    engine::component::ParallaxComponent,
+    engine::component::SpriteComponent,
+    engine::component::RenderComponent,
+    engine::component::TileLayerComponent,
+    engine::component::AnimationComponent,
+    engine::defs::StaticTag,
+    game::defs::MeleePlaceTag,
+    game::defs::RangedPlaceTag
+>;
+
+} // namespace
+
+LevelTemplate::LevelTemplate() = default;
+LevelTemplate::~LevelTemplate() = default;
+
+bool LevelTemplate::isSupported(const entt::registry& registry) {
+    return LevelComponents::covers(registry);
+}
+
+std::shared_ptr<const LevelTemplate> LevelTemplate::capture(std::string_view map_path,
+                                                            const entt::registry& registry,
+                                                            const std::unordered_map<int, game::data::WaypointNode>& waypoint_nodes,
+                                                            const std::vector<int>& start_points,
+                                                            const engine::loader::TileChunkMap* chunk_map) {
+    if (!LevelComponents::covers(registry)) {
+        return nullptr;
+    }
+    auto level_template = std::make_shared<LevelTemplate>();
+    level_template->map_path_ = map_path;
+    LevelComponents::copy(registry, level_template->registry_);
+    level_template->waypoint_nodes_ = waypoint_nodes;
+    level_template->start_points_ = start_points;
+    if (chunk_map) {
+        level_template->chunk_map_ = std::make_unique<engine::loader::TileChunkMap>(*chunk_map);
+    }
+    spdlog::info("已生成关卡模板 '{}'：{} 个实体", map_path, registry.storage<entt::entity>()->free_list());
+    return level_template;
+}
+
+std::shared_ptr<const LevelTemplate> LevelTemplate::capture(std::string_view map_path,
+                                                            const entt::registry& registry,
+                                                            std::span<const entt::entity> level_entities,
+                                                            const std::unordered_map<int, game::data::WaypointNode>& waypoint_nodes,
+                                                            const std::vector<int>& start_points,
+                                                            const engine::loader::TileChunkMap* chunk_map) {
+    auto level_template = std::make_shared<LevelTemplate>();
+    level_template->map_path_ = map_path;
+    LevelComponents::copyEntities(registry, level_template->registry_, level_entities);
+    // 关卡中的动画已经播放了一段时间，恢复到刚载入时的第一帧
+    for (auto [entity, animation, sprite] : level_template->registry_.view<engine::component::AnimationComponent,
+                                                                             engine::component::SpriteComponent>().each()) {
+        animation.current_frame_index_ = 0;
+        animation.current_time_ms_ = 0.0f;
+        if (auto it = animation.animations_.find(animation.current_animation_id_);
+            it != animation.animations_.end() && !it->second.frames_.empty()) {
+            sprite.sprite_.src_rect_ = it->second.frames_.front().src_rect_;
+        }
+    }
+    level_template->waypoint_nodes_ = waypoint_nodes;
+    level_template->start_points_ = start_points;
+    if (chunk_map) {
+        level_template->chunk_map_ = std::make_unique<engine::loader::TileChunkMap>(*chunk_map);
+    }
+    spdlog::info("已生成关卡模板 '{}'：{} 个关卡实体", map_path, level_entities.size());
+    return level_template;
+}
+
+std::unique_ptr<engine::loader::TileChunkMap> LevelTemplate::instantiate(entt::registry& registry,
+                                                                         std::unordered_map<int, game::data::WaypointNode>& waypoint_nodes,
+                                                                         std::vector<int>& start_points) const {
+    LevelComponents::copy(registry_, registry);
+    waypoint_nodes = waypoint_nodes_;
+    start_points = start_points_;
+    return chunk_map_ ? std::make_unique<engine::loader::TileChunkMap>(*chunk_map_) : nullptr;
+}
+
+} // namespace game::data
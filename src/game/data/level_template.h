@@ -0,0 +1,95 @@
+#pragma once
+#include "game/data/waypoint_node.h"
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <entt/entity/registry.hpp>
+
+namespace engine::loader {
+    class TileChunkMap;
+}
+
+namespace game::data {
+
+/**
+ * @brief 关卡模板：关卡载入完成（loadLevel 之后、创建系统和生成单位之前）时注册表、路径节点和起点的副本。
+ *
+ * 重新开始关卡时，新场景直接把模板中的各组件存储整体复制到自己的注册表，
+ * 不再读取、解析地图文件和重新生成瓦片实体。实体 id 保持不变，因此组件中保存的实体引用（如 TileLayerComponent）依然有效。
+ *
+ * 只复制 level_template.cpp 中列出的组件类型；注册表中出现未列出的组件时 capture() 返回 nullptr，调用者应回退为重新载入。
+ * GameScene 载入时只记录关卡实体（isSupported() 检查通过时），第一次重新开始时才用 capture(level_entities) 从进行中的关卡生成模板，
+ * 从未重新开始的对局不需要付出复制注册表的代价。
+ */
+class LevelTemplate final {
+private:
+    std::string map_path_;                                          ///< @brief 地图路径（用于确认模板与关卡一致）
+    entt::registry registry_;                                       ///< @brief 载入完成时的实体与组件
+    std::unordered_map<int, game::data::WaypointNode> waypoint_nodes_;  ///< @brief 路径节点
+    std::vector<int> start_points_;                                 ///< @brief 起点ID列表
+    std::unique_ptr<engine::loader::TileChunkMap> chunk_map_;       ///< @brief 分块瓦片地图（没有触发分块加载则为空）
+
+public:
+    LevelTemplate();
+    ~LevelTemplate();
+
+    LevelTemplate(const LevelTemplate&) = delete;
+    LevelTemplate& operator=(const LevelTemplate&) = delete;
+    LevelTemplate(LevelTemplate&&) = delete;
+    LevelTemplate& operator=(LevelTemplate&&) = delete;
+
+    /**
+     * @brief 注册表中的组件是否都能由模板复制（只检查，不复制；在关卡刚载入完成时调用）
+     */
+    static bool isSupported(const entt::registry& registry);
+
+    /**
+     * @brief 从刚载入完成的关卡生成模板
+     * @param map_path 地图路径
+     * @param registry 场景注册表（只包含关卡载入器生成的实体）
+     * @param waypoint_nodes 路径节点
+     * @param start_points 起点ID列表
+     * @param chunk_map 分块瓦片地图（可为空），模板会保存一份副本
+     * @return 模板，注册表中有模板不支持复制的组件时返回 nullptr
+     */
+    static std::shared_ptr<const LevelTemplate> capture(std::string_view map_path,
+                                                        const entt::registry& registry,
+                                                        const std::unordered_map<int, game::data::WaypointNode>& waypoint_nodes,
+                                                        const std::vector<int>& start_points,
+                                                        const engine::loader::TileChunkMap* chunk_map);
+
+    /**
+     * @brief 从进行中的关卡延迟生成模板：只复制载入完成时记录的关卡实体（忽略运行时挂上的其它组件），动画恢复到第一帧
+     * @param map_path 地图路径
+     * @param registry 场景注册表（可以包含战斗实体、流式加载的瓦片实体）
+     * @param level_entities 载入完成时注册表中的实体（调用者需确认当时 isSupported() 为 true）
+     * @param waypoint_nodes 路径节点
+     * @param start_points 起点ID列表
+     * @param chunk_map 分块瓦片地图（可为空，载入后只读），模板会保存一份副本
+     * @return 模板
+     */
+    static std::shared_ptr<const LevelTemplate> capture(std::string_view map_path,
+                                                        const entt::registry& registry,
+                                                        std::span<const entt::entity> level_entities,
+                                                        const std::unordered_map<int, game::data::WaypointNode>& waypoint_nodes,
+                                                        const std::vector<int>& start_points,
+                                                        const engine::loader::TileChunkMap* chunk_map);
+
+    /**
+     * @brief 用模板生成关卡
+     * @param registry 目标注册表（必须为空，实体 id 与模板一致）
+     * @param waypoint_nodes 输出：路径节点
+     * @param start_points 输出：起点ID列表
+     * @return 分块瓦片地图的副本（模板中没有则为 nullptr）
+     */
+    std::unique_ptr<engine::loader::TileChunkMap> instantiate(entt::registry& registry,
+                                                              std::unordered_map<int, game::data::WaypointNode>& waypoint_nodes,
+                                                              std::vector<int>& start_points) const;
+
+    const std::string& getMapPath() const { return map_path_; }
+};
+
+} // namespace game::data
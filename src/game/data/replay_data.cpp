@@ -0,0 +1,156 @@
+#include "replay_data.h"
+#include "engine/utils/byte_stream.h"
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <spdlog/spdlog.h>
+#include <glm/vec2.hpp>
+
+namespace game::data {
+
+namespace {
+
+constexpr std::uint32_t MAGIC{0x50524D4D};      ///< @brief "MMRP"
+constexpr std::uint32_t VERSION{1};             ///< @brief 修改录像格式时递增
+
+// 帧标志位
+constexpr std::uint8_t FLAG_PAUSED{1 << 0};         ///< @brief 本帧暂停
+constexpr std::uint8_t FLAG_MOUSE_MOVED{1 << 1};    ///< @brief 鼠标位置与上一帧不同（其后写入新的鼠标位置）
+
+// 动作标志位
+constexpr std::uint8_t ACTION_ACTIVE{1 << 0};
+constexpr std::uint8_t ACTION_REPEAT{1 << 1};
+
+constexpr std::size_t MIN_FRAME_SIZE{sizeof(float) + sizeof(std::uint8_t) + 2 * sizeof(std::uint16_t)};
+constexpr std::size_t ACTION_SIZE{sizeof(entt::id_type) + sizeof(std::uint8_t)};
+constexpr std::size_t COMMAND_SIZE{sizeof(std::uint8_t) + 2 * sizeof(entt::id_type) + sizeof(std::int32_t)};
+
+} // namespace
+
+std::string ReplayData::serialize() const {
+    std::string out;
+    out.reserve(64 + session_data_.size() + frames_.size() * MIN_FRAME_SIZE);
+    engine::utils::ByteWriter writer(out);
+    writer.put(MAGIC);
+    writer.put(VERSION);
+    writer.put(seed_);
+    writer.putString(session_data_);
+    writer.put(static_cast<std::uint32_t>(frames_.size()));
+
+    glm::vec2 mouse_position{};
+    glm::vec2 logical_mouse_position{};
+    for (const auto& frame : frames_) {
+        const auto& input = frame.input_;
+        const bool mouse_moved = input.mouse_position_ != mouse_position || input.logical_mouse_position_ != logical_mouse_position;
+        std::uint8_t flags = 0;
+        if (frame.is_paused_) flags |= FLAG_PAUSED;
+        if (mouse_moved) flags |= FLAG_MOUSE_MOVED;
+
+        writer.put(frame.delta_time_);
+        writer.put(flags);
+        if (mouse_moved) {
+            mouse_position = input.mouse_position_;
+            logical_mouse_position = input.logical_mouse_position_;
+            writer.put(mouse_position);
+            writer.put(logical_mouse_position);
+        }
+        writer.put(static_cast<std::uint16_t>(input.actions_.size()));
+        for (const auto& action : input.actions_) {
+            std::uint8_t action_flags = 0;
+            if (action.is_input_active_) action_flags |= ACTION_ACTIVE;
+            if (action.is_repeat_event_) action_flags |= ACTION_REPEAT;
+            writer.put(action.action_name_id_);
+            writer.put(action_flags);
+        }
+        writer.put(static_cast<std::uint16_t>(frame.commands_.size()));
+        for (const auto& command : frame.commands_) {
+            writer.put(static_cast<std::uint8_t>(command.type_));
+            writer.put(command.name_id_);
+            writer.put(command.class_id_);
+            writer.put(command.cost_);
+        }
+    }
+    return out;
+}
+
+bool ReplayData::deserialize(std::string_view data) {
+    engine::utils::ByteReader reader(data);
+    if (reader.get<std::uint32_t>() != MAGIC) {
+        spdlog::error("录像数据无效：魔数不匹配");
+        return false;
+    }
+    if (const auto version = reader.get<std::uint32_t>(); version != VERSION) {
+        spdlog::error("录像版本不匹配：{}（需要 {}）", version, VERSION);
+        return false;
+    }
+    seed_ = reader.get<std::uint64_t>();
+    session_data_ = reader.getString();
+
+    frames_.clear();
+    const auto frame_count = reader.getCount(MIN_FRAME_SIZE);
+    frames_.reserve(frame_count);
+    glm::vec2 mouse_position{};
+    glm::vec2 logical_mouse_position{};
+    for (std::uint32_t i = 0; i < frame_count && reader.ok(); ++i) {
+        auto& frame = frames_.emplace_back();
+        frame.delta_time_ = reader.get<float>();
+        const auto flags = reader.get<std::uint8_t>();
+        frame.is_paused_ = (flags & FLAG_PAUSED) != 0;
+        if (flags & FLAG_MOUSE_MOVED) {
+            mouse_position = reader.get<glm::vec2>();
+            logical_mouse_position = reader.get<glm::vec2>();
+        }
+        frame.input_.mouse_position_ = mouse_position;
+        frame.input_.logical_mouse_position_ = logical_mouse_position;
+
+        const auto action_count = reader.get<std::uint16_t>();
+        if (static_cast<std::size_t>(action_count) * ACTION_SIZE > reader.remaining()) { frames_.pop_back(); break; }
+        frame.input_.actions_.reserve(action_count);
+        for (std::uint16_t j = 0; j < action_count; ++j) {
+            auto action_name_id = reader.get<entt::id_type>();
+            const auto action_flags = reader.get<std::uint8_t>();
+            frame.input_.actions_.push_back({action_name_id, (action_flags & ACTION_ACTIVE) != 0, (action_flags & ACTION_REPEAT) != 0});
+        }
+
+        const auto command_count = reader.get<std::uint16_t>();
+        if (static_cast<std::size_t>(command_count) * COMMAND_SIZE > reader.remaining()) { frames_.pop_back(); break; }
+        frame.commands_.reserve(command_count);
+        for (std::uint16_t j = 0; j < command_count; ++j) {
+            ReplayCommand command;
+            command.type_ = static_cast<ReplayCommand::Type>(reader.get<std::uint8_t>());
+            command.name_id_ = reader.get<entt::id_type>();
+            command.class_id_ = reader.get<entt::id_type>();
+            command.cost_ = reader.get<std::int32_t>();
+            if (command.type_ > ReplayCommand::Type::REWIND_CHECKPOINT) {
+                spdlog::error("录像数据无效：第 {} 帧包含未知指令 {}", i, static_cast<int>(command.type_));
+                frames_.clear();
+                return false;
+            }
+            frame.commands_.push_back(command);
+        }
+    }
+    if (!reader.ok() || frames_.size() != frame_count || reader.remaining() != 0) {
+        spdlog::error("录像数据无效：数据不完整");
+        frames_.clear();
+        return false;
+    }
+    return true;
+}
+
+bool ReplayData::loadFromFile(std::string_view path) {
+    std::filesystem::path file_path = path;
+    std::ifstream file(file_path, std::ios::binary);
+    if (!file.is_open()) {
+        spdlog::error("无法打开录像文件: {}", path);
+        return false;
+    }
+    std::string data{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    if (!deserialize(data)) {
+        spdlog::error("读取录像文件失败: {}", path);
+        return false;
+    }
+    spdlog::info("已读取录像文件: {}（{} 帧）", path, frames_.size());
+    return true;
+}
+
+} // namespace game::data
@@ -0,0 +1,60 @@
+#pragma once
+#include "engine/input/input_frame.h"
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <entt/entity/entity.hpp>
+
+namespace game::data {
+
+/**
+ * @brief 录像中的场景指令：来自UI（肖像按钮、调试面板）的事件，回放时直接重新发送
+ *
+ * 单位用名称ID而不是实体记录——区块流式加载在后台线程完成，瓦片实体与战斗实体的创建顺序每次运行可能不同，
+ * 实体ID因此不能跨运行使用；而每个角色的名称ID在一局中是唯一的。
+ */
+struct ReplayCommand {
+    enum class Type : std::uint8_t {
+        PREP_UNIT,          ///< @brief PrepUnitEvent（name_id_、class_id_、cost_）
+        UPGRADE_UNIT,       ///< @brief UpgradeUnitEvent（name_id_、cost_）
+        RETREAT,            ///< @brief RetreatEvent（name_id_、cost_）
+        SKILL_ACTIVE,       ///< @brief SkillActiveEvent（name_id_）
+        SAVE_CHECKPOINT,    ///< @brief SaveCheckpointEvent
+        LOAD_CHECKPOINT,    ///< @brief LoadCheckpointEvent
+        REWIND_CHECKPOINT,  ///< @brief RewindCheckpointEvent
+    };
+
+    Type type_{Type::PREP_UNIT};
+    entt::id_type name_id_{entt::null};     ///< @brief 单位名称ID
+    entt::id_type class_id_{entt::null};    ///< @brief 职业ID
+    std::int32_t cost_{0};                  ///< @brief 费用
+};
+
+/**
+ * @brief 录像中的一帧：场景收到的帧时间、暂停状态、输入和UI指令
+ */
+struct ReplayFrame {
+    float delta_time_{0.0f};                        ///< @brief 本帧的帧时间（已包含时间缩放）
+    bool is_paused_{false};                         ///< @brief 本帧是否暂停
+    engine::input::InputFrame input_;               ///< @brief 本帧的输入
+    std::vector<ReplayCommand> commands_;           ///< @brief 本帧发送的UI指令
+};
+
+/**
+ * @brief 一局游戏的录像：随机数种子 + 开局时的会话数据 + 逐帧的输入与指令
+ *
+ * 游戏逻辑只依赖这些数据（随机数全部来自场景的随机数流），因此同一版本的程序回放结果与录制时一致。
+ * 二进制格式：文件头（魔数、版本）+ 种子 + 会话数据json + 帧列表；鼠标位置只在变化时写入。
+ */
+struct ReplayData {
+    std::uint64_t seed_{0};                 ///< @brief 场景随机数流的种子
+    std::string session_data_;              ///< @brief 开局时的会话数据（SessionData::serialize() 的结果）
+    std::vector<ReplayFrame> frames_;       ///< @brief 逐帧数据
+
+    [[nodiscard]] std::string serialize() const;        ///< @brief 序列化为二进制数据
+    bool deserialize(std::string_view data);            ///< @brief 从二进制数据读取（格式或版本不符时返回 false）
+    bool loadFromFile(std::string_view path);           ///< @brief 从文件读取
+};
+
+} // namespace game::data
@@ -1,6 +1,8 @@
 #include "session_data.h"
+#include "engine/core/async_file_writer.h"
 #include <fstream>
 #include <filesystem>
+#include <iterator>
 #include <spdlog/spdlog.h>
 #include <nlohmann/json.hpp>
 #include <entt/core/hashed_string.hpp>
@@ -13,19 +15,22 @@ bool SessionData::loadDefaultData(std::string_view path) {
         spdlog::error("Session data 文件未找到: {}", path);
         return false;
     }
-    clear();
     std::filesystem::path file_path = path;
     std::ifstream file(file_path);
     if (!file.is_open()) {
         spdlog::error("无法打开Session data文件: {}", path);
         return false;
     }
-
-    nlohmann::json json;
-    file >> json;
+    std::string text{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
     file.close();
 
+    return deserialize(text);
+}
+
+bool SessionData::deserialize(std::string_view text) {
+    clear();
     try {
+        auto json = nlohmann::json::parse(text);
         // 关卡基本信息：当前关卡、积分、是否通关
         level_number_ = json["level"].get<int>();
         point_ = json["point"].get<int>();
@@ -52,39 +57,30 @@ bool SessionData::loadFromFile(std::string_view path) {
     return loadDefaultData(path);
 }
 
-bool SessionData::saveToFile(std::string_view path) {
-    std::filesystem::path file_path = path;
-    // 如果父目录不存在，则自动创建
-    if (!file_path.parent_path().empty() && !std::filesystem::exists(file_path.parent_path())) {
-        try {
-            std::filesystem::create_directories(file_path.parent_path());
-        } catch (const std::exception& e) {
-            spdlog::error("无法创建目录 {}: {}", file_path.parent_path().string(), e.what());
-            return false;
-        }
-    }
-    std::ofstream file(file_path);
-    if (!file.is_open()) {
-        spdlog::error("无法打开存档文件: {}", path);
+bool SessionData::saveToFile(std::string_view path) const {
+    if (!engine::core::AsyncFileWriter::writeAtomic(std::string(path), serialize())) {
+        spdlog::error("无法保存存档文件: {}", path);
         return false;
     }
+    spdlog::info("存档文件已保存: {}", path);
+    return true;
+}
 
+std::string SessionData::serialize() const {
     nlohmann::json json;
     // 关卡基本信息：当前关卡、积分、是否通关
     json["level"] = level_number_;
     json["point"] = point_;
     json["level_clear"] = level_clear_;
     // 角色数据：角色名id、职业id、角色名、职业、等级、稀有度
+    json["unit"] = nlohmann::json::object();
     for (const auto& [id, data] : unit_map_) {
-        std::string name = data.name_;
-        json["unit"][name]["class"] = data.class_;
-        json["unit"][name]["level"] = data.level_;
-        json["unit"][name]["rarity"] = data.rarity_;
+        auto& unit = json["unit"][data.name_];
+        unit["class"] = data.class_;
+        unit["level"] = data.level_;
+        unit["rarity"] = data.rarity_;
     }
-    file << json.dump(4);
-    file.close();
-    spdlog::info("存档文件已保存: {}", path);
-    return true;
+    return json.dump();     // 不缩进，输出紧凑文本（读档时依然按json解析）
 }
 
 void SessionData::mapUnitDataList() {
@@ -44,7 +44,9 @@ public:
 
     bool loadDefaultData(std::string_view path = "assets/data/default_session_data.json");  ///< @brief 加载默认数据
     bool loadFromFile(std::string_view path);                                               ///< @brief 加载文件数据(读档)
-    bool saveToFile(std::string_view path);                                                 ///< @brief 保存文件数据(存档)
+    bool saveToFile(std::string_view path) const;                                           ///< @brief 保存文件数据(同步原子写入存档)
+    [[nodiscard]] std::string serialize() const;                                            ///< @brief 序列化为紧凑的json文本（交给后台写入存档）
+    bool deserialize(std::string_view text);                                                ///< @brief 从json文本读取（serialize()的逆操作，用于录像回放）
 
     void mapUnitDataList();     ///< @brief 将unit_map_中的数据映射到unit_data_list_中
 
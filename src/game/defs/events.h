@@ -99,6 +99,9 @@ struct RetreatEvent {
 struct RestartEvent {};
 struct BackToTitleEvent {};
 struct SaveEvent {};
+struct SaveCheckpointEvent {};      ///< @brief 保存检查点（战斗快照）
+struct LoadCheckpointEvent {};      ///< @brief 读取最近的检查点
+struct RewindCheckpointEvent {};    ///< @brief 丢弃最近的检查点，读取上一个检查点
 struct LevelClearEvent {};          ///< @brief 关卡通关事件(立刻切换场景)
 struct LevelClearDelayedEvent {     ///< @brief 关卡通关事件(延迟切换场景)
     float delay_time_{3.0f};
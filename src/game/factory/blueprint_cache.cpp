@@ -0,0 +1,627 @@
+#include "blueprint_cache.h"
+#include "blueprint_manager.h"
+#include "engine/resource/resource_manager.h"
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <type_traits>
+#include <vector>
+#include <spdlog/spdlog.h>
+
+namespace game::factory {
+
+namespace {
+
+constexpr std::uint32_t MAGIC{0x5042574D};      ///< @brief "MWBP"
+constexpr std::uint32_t VERSION{1};             ///< @brief 修改缓存格式或字段含义时递增（大小与字段偏移的变化由 layoutSignature() 自动检测）
+constexpr std::uint64_t SECTION_ALIGNMENT{8};
+
+// --- 缓存中的扁平记录（平凡可复制，字符串与子数组都以偏移引用） ---
+
+/// @brief 字符串池中的字符串（池中每个字符串后都有 '\0'，size_ 不含结尾）
+struct StrRef {
+    std::uint32_t offset_{0};
+    std::uint32_t size_{0};
+};
+
+/// @brief 某个数组段中的连续区间
+struct Range {
+    std::uint32_t first_{0};
+    std::uint32_t count_{0};
+};
+
+struct CookedSprite {
+    entt::id_type id_{0};
+    StrRef path_{};
+    float src_rect_[4]{};       ///< @brief x, y, w, h
+    float size_[2]{};
+    float offset_[2]{};
+    std::uint32_t face_right_{1};
+};
+
+struct CookedAnimation {
+    entt::id_type name_id_{0};
+    float ms_per_frame_{0.0f};
+    std::int32_t row_{0};
+    Range frames_{};            ///< @brief FRAMES 段
+    Range events_{};            ///< @brief EVENTS 段
+};
+
+struct CookedEvent {
+    std::int32_t frame_{0};
+    entt::id_type event_id_{0};
+};
+
+struct CookedSound {
+    entt::id_type key_id_{0};
+    entt::id_type sound_id_{0};
+    StrRef path_{};
+};
+
+struct CookedPlayerClass {
+    entt::id_type class_id_{0};
+    entt::id_type projectile_id_{0};
+    StrRef class_name_{};
+    data::StatsBlueprint stats_{};
+    data::PlayerBlueprint player_{};
+    CookedSprite sprite_{};
+    Range sounds_{};            ///< @brief SOUNDS 段
+    Range animations_{};        ///< @brief ANIMATIONS 段
+    StrRef name_{};
+    StrRef description_{};
+};
+
+struct CookedEnemyClass {
+    entt::id_type class_id_{0};
+    entt::id_type projectile_id_{0};
+    StrRef class_name_{};
+    data::StatsBlueprint stats_{};
+    data::EnemyBlueprint enemy_{};
+    CookedSprite sprite_{};
+    Range sounds_{};
+    Range animations_{};
+    StrRef name_{};
+    StrRef description_{};
+};
+
+struct CookedProjectile {
+    entt::id_type id_{0};
+    StrRef name_{};
+    float arc_height_{0.0f};
+    float total_flight_time_{0.0f};
+    CookedSprite sprite_{};
+    Range sounds_{};
+};
+
+struct CookedEffect {
+    entt::id_type id_{0};
+    StrRef name_{};
+    CookedSprite sprite_{};
+    Range animation_{};         ///< @brief ANIMATIONS 段（恰好一个）
+};
+
+struct CookedSkill {
+    entt::id_type id_{0};
+    StrRef name_{};
+    StrRef description_{};
+    std::uint32_t passive_{0};
+    float cooldown_{0.0f};
+    float duration_{0.0f};
+    data::BuffBlueprint buff_{};
+};
+
+enum Section : size_t {
+    PLAYERS, ENEMIES, PROJECTILES, EFFECTS, SKILLS,
+    ANIMATIONS, FRAMES, EVENTS, SOUNDS, STRINGS,
+    SECTION_COUNT
+};
+
+struct SectionInfo {
+    std::uint64_t offset_{0};
+    std::uint64_t count_{0};
+};
+
+struct Header {
+    std::uint32_t magic_{MAGIC};
+    std::uint32_t version_{VERSION};
+    std::uint32_t layout_{0};
+    std::uint32_t reserved_{0};
+    std::uint64_t source_hash_{0};
+    std::array<SectionInfo, SECTION_COUNT> sections_{};
+};
+
+static_assert(std::is_standard_layout_v<CookedPlayerClass> && std::is_standard_layout_v<CookedEnemyClass> &&
+              std::is_standard_layout_v<CookedProjectile> && std::is_standard_layout_v<CookedEffect> &&
+              std::is_standard_layout_v<CookedSkill> && std::is_standard_layout_v<Header>,
+              "layoutSignature() 使用 offsetof，记录必须是标准布局");
+static_assert(std::is_trivially_copyable_v<CookedPlayerClass> && std::is_trivially_copyable_v<CookedEnemyClass> &&
+              std::is_trivially_copyable_v<CookedProjectile> && std::is_trivially_copyable_v<CookedEffect> &&
+              std::is_trivially_copyable_v<CookedSkill> && std::is_trivially_copyable_v<Header>,
+              "蓝图缓存中的记录必须是平凡可复制的");
+
+// --- FNV-1a 64 ---
+constexpr std::uint64_t FNV_OFFSET{14695981039346656037ull};
+constexpr std::uint64_t FNV_PRIME{1099511628211ull};
+
+constexpr std::uint64_t fnv1a(std::uint64_t hash, const void* data, size_t size) {
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * FNV_PRIME;
+    }
+    return hash;
+}
+
+/**
+ * @brief 结构布局签名：任意记录的大小或字段偏移变化（包括调整字段顺序、不同平台的填充）都会使缓存失效
+ * @note 字段的类型变化但大小与偏移不变时（如 float 改为 int）签名无法察觉，此时需要递增 VERSION
+ */
+std::uint32_t layoutSignature() {
+#define BLUEPRINT_CACHE_FIELD(type, field) static_cast<std::uint64_t>(offsetof(type, field))
+    const std::uint64_t layout[] = {
+        sizeof(CookedPlayerClass), sizeof(CookedEnemyClass), sizeof(CookedProjectile), sizeof(CookedEffect),
+        sizeof(CookedSkill), sizeof(CookedAnimation), sizeof(CookedEvent), sizeof(CookedSound),
+        sizeof(CookedSprite), sizeof(StrRef), sizeof(Range), sizeof(entt::id_type), sizeof(Header),
+        sizeof(data::StatsBlueprint), sizeof(data::PlayerBlueprint), sizeof(data::EnemyBlueprint), sizeof(data::BuffBlueprint),
+
+        BLUEPRINT_CACHE_FIELD(StrRef, offset_), BLUEPRINT_CACHE_FIELD(StrRef, size_),
+        BLUEPRINT_CACHE_FIELD(Range, first_), BLUEPRINT_CACHE_FIELD(Range, count_),
+
+        BLUEPRINT_CACHE_FIELD(CookedSprite, id_), BLUEPRINT_CACHE_FIELD(CookedSprite, path_),
+        BLUEPRINT_CACHE_FIELD(CookedSprite, src_rect_), BLUEPRINT_CACHE_FIELD(CookedSprite, size_),
+        BLUEPRINT_CACHE_FIELD(CookedSprite, offset_), BLUEPRINT_CACHE_FIELD(CookedSprite, face_right_),
+
+        BLUEPRINT_CACHE_FIELD(CookedAnimation, name_id_), BLUEPRINT_CACHE_FIELD(CookedAnimation, ms_per_frame_),
+        BLUEPRINT_CACHE_FIELD(CookedAnimation, row_), BLUEPRINT_CACHE_FIELD(CookedAnimation, frames_),
+        BLUEPRINT_CACHE_FIELD(CookedAnimation, events_),
+
+        BLUEPRINT_CACHE_FIELD(CookedEvent, frame_), BLUEPRINT_CACHE_FIELD(CookedEvent, event_id_),
+
+        BLUEPRINT_CACHE_FIELD(CookedSound, key_id_), BLUEPRINT_CACHE_FIELD(CookedSound, sound_id_),
+        BLUEPRINT_CACHE_FIELD(CookedSound, path_),
+
+        BLUEPRINT_CACHE_FIELD(CookedPlayerClass, class_id_), BLUEPRINT_CACHE_FIELD(CookedPlayerClass, projectile_id_),
+        BLUEPRINT_CACHE_FIELD(CookedPlayerClass, class_name_), BLUEPRINT_CACHE_FIELD(CookedPlayerClass, stats_),
+        BLUEPRINT_CACHE_FIELD(CookedPlayerClass, player_), BLUEPRINT_CACHE_FIELD(CookedPlayerClass, sprite_),
+        BLUEPRINT_CACHE_FIELD(CookedPlayerClass, sounds_), BLUEPRINT_CACHE_FIELD(CookedPlayerClass, animations_),
+        BLUEPRINT_CACHE_FIELD(CookedPlayerClass, name_), BLUEPRINT_CACHE_FIELD(CookedPlayerClass, description_),
+
+        BLUEPRINT_CACHE_FIELD(CookedEnemyClass, class_id_), BLUEPRINT_CACHE_FIELD(CookedEnemyClass, projectile_id_),
+        BLUEPRINT_CACHE_FIELD(CookedEnemyClass, class_name_), BLUEPRINT_CACHE_FIELD(CookedEnemyClass, stats_),
+        BLUEPRINT_CACHE_FIELD(CookedEnemyClass, enemy_), BLUEPRINT_CACHE_FIELD(CookedEnemyClass, sprite_),
+        BLUEPRINT_CACHE_FIELD(CookedEnemyClass, sounds_), BLUEPRINT_CACHE_FIELD(CookedEnemyClass, animations_),
+        BLUEPRINT_CACHE_FIELD(CookedEnemyClass, name_), BLUEPRINT_CACHE_FIELD(CookedEnemyClass, description_),
+
+        BLUEPRINT_CACHE_FIELD(CookedProjectile, id_), BLUEPRINT_CACHE_FIELD(CookedProjectile, name_),
+        BLUEPRINT_CACHE_FIELD(CookedProjectile, arc_height_), BLUEPRINT_CACHE_FIELD(CookedProjectile, total_flight_time_),
+        BLUEPRINT_CACHE_FIELD(CookedProjectile, sprite_), BLUEPRINT_CACHE_FIELD(CookedProjectile, sounds_),
+
+        BLUEPRINT_CACHE_FIELD(CookedEffect, id_), BLUEPRINT_CACHE_FIELD(CookedEffect, name_),
+        BLUEPRINT_CACHE_FIELD(CookedEffect, sprite_), BLUEPRINT_CACHE_FIELD(CookedEffect, animation_),
+
+        BLUEPRINT_CACHE_FIELD(CookedSkill, id_), BLUEPRINT_CACHE_FIELD(CookedSkill, name_),
+        BLUEPRINT_CACHE_FIELD(CookedSkill, description_), BLUEPRINT_CACHE_FIELD(CookedSkill, passive_),
+        BLUEPRINT_CACHE_FIELD(CookedSkill, cooldown_), BLUEPRINT_CACHE_FIELD(CookedSkill, duration_),
+        BLUEPRINT_CACHE_FIELD(CookedSkill, buff_),
+
+        BLUEPRINT_CACHE_FIELD(Header, magic_), BLUEPRINT_CACHE_FIELD(Header, version_),
+        BLUEPRINT_CACHE_FIELD(Header, layout_), BLUEPRINT_CACHE_FIELD(Header, source_hash_),
+        BLUEPRINT_CACHE_FIELD(Header, sections_),
+
+        // 直接嵌入记录的蓝图结构
+        BLUEPRINT_CACHE_FIELD(data::StatsBlueprint, hp_), BLUEPRINT_CACHE_FIELD(data::StatsBlueprint, atk_),
+        BLUEPRINT_CACHE_FIELD(data::StatsBlueprint, def_), BLUEPRINT_CACHE_FIELD(data::StatsBlueprint, range_),
+        BLUEPRINT_CACHE_FIELD(data::StatsBlueprint, atk_interval_),
+
+        BLUEPRINT_CACHE_FIELD(data::PlayerBlueprint, type_), BLUEPRINT_CACHE_FIELD(data::PlayerBlueprint, skill_id_),
+        BLUEPRINT_CACHE_FIELD(data::PlayerBlueprint, healer_), BLUEPRINT_CACHE_FIELD(data::PlayerBlueprint, block_),
+        BLUEPRINT_CACHE_FIELD(data::PlayerBlueprint, cost_),
+
+        BLUEPRINT_CACHE_FIELD(data::EnemyBlueprint, ranged_), BLUEPRINT_CACHE_FIELD(data::EnemyBlueprint, speed_),
+
+        BLUEPRINT_CACHE_FIELD(data::BuffBlueprint, hp_multiplier_), BLUEPRINT_CACHE_FIELD(data::BuffBlueprint, atk_multiplier_),
+        BLUEPRINT_CACHE_FIELD(data::BuffBlueprint, def_multiplier_), BLUEPRINT_CACHE_FIELD(data::BuffBlueprint, range_multiplier_),
+        BLUEPRINT_CACHE_FIELD(data::BuffBlueprint, atk_interval_multiplier_), BLUEPRINT_CACHE_FIELD(data::BuffBlueprint, cost_regen_),
+    };
+#undef BLUEPRINT_CACHE_FIELD
+    return static_cast<std::uint32_t>(fnv1a(FNV_OFFSET, layout, sizeof(layout)));
+}
+
+/// @brief 一次性读入整个文件
+bool readWholeFile(const std::filesystem::path& path, std::vector<char>& bytes) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) return false;
+    bytes.resize(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    return static_cast<bool>(file.read(bytes.data(), static_cast<std::streamsize>(bytes.size())));
+}
+
+// ----------------------------- 写入 -----------------------------
+
+class Writer {
+public:
+    std::vector<CookedPlayerClass> players_;
+    std::vector<CookedEnemyClass> enemies_;
+    std::vector<CookedProjectile> projectiles_;
+    std::vector<CookedEffect> effects_;
+    std::vector<CookedSkill> skills_;
+    std::vector<CookedAnimation> animations_;
+    std::vector<std::int32_t> frames_;
+    std::vector<CookedEvent> events_;
+    std::vector<CookedSound> sounds_;
+    std::vector<char> strings_;
+
+private:
+    const std::unordered_map<entt::id_type, std::string>& sound_paths_;
+
+public:
+    explicit Writer(const std::unordered_map<entt::id_type, std::string>& sound_paths) : sound_paths_(sound_paths) {}
+
+    StrRef addString(std::string_view str) {
+        StrRef ref{static_cast<std::uint32_t>(strings_.size()), static_cast<std::uint32_t>(str.size())};
+        strings_.insert(strings_.end(), str.begin(), str.end());
+        strings_.push_back('\0');
+        return ref;
+    }
+
+    CookedSprite cookSprite(const data::SpriteBlueprint& sprite) {
+        CookedSprite cooked;
+        cooked.id_ = sprite.id_;
+        cooked.path_ = addString(sprite.path_);
+        cooked.src_rect_[0] = sprite.src_rect_.position.x;
+        cooked.src_rect_[1] = sprite.src_rect_.position.y;
+        cooked.src_rect_[2] = sprite.src_rect_.size.x;
+        cooked.src_rect_[3] = sprite.src_rect_.size.y;
+        cooked.size_[0] = sprite.size_.x;
+        cooked.size_[1] = sprite.size_.y;
+        cooked.offset_[0] = sprite.offset_.x;
+        cooked.offset_[1] = sprite.offset_.y;
+        cooked.face_right_ = sprite.face_right_ ? 1 : 0;
+        return cooked;
+    }
+
+    Range addSounds(const data::SoundBlueprint& sounds) {
+        Range range{static_cast<std::uint32_t>(sounds_.size()), 0};
+        for (const auto& [key_id, sound_id] : sounds.sounds_) {
+            auto it = sound_paths_.find(sound_id);
+            sounds_.push_back(CookedSound{key_id, sound_id, addString(it != sound_paths_.end() ? it->second : std::string{})});
+            ++range.count_;
+        }
+        return range;
+    }
+
+    Range addAnimation(entt::id_type name_id, const data::AnimationBlueprint& animation) {
+        CookedAnimation cooked{name_id, animation.ms_per_frame_, animation.row_, {}, {}};
+        cooked.frames_ = Range{static_cast<std::uint32_t>(frames_.size()), static_cast<std::uint32_t>(animation.frames_.size())};
+        frames_.insert(frames_.end(), animation.frames_.begin(), animation.frames_.end());
+        cooked.events_ = Range{static_cast<std::uint32_t>(events_.size()), static_cast<std::uint32_t>(animation.events_.size())};
+        for (const auto& [frame, event_id] : animation.events_) {
+            events_.push_back(CookedEvent{frame, event_id});
+        }
+        animations_.push_back(cooked);
+        return Range{static_cast<std::uint32_t>(animations_.size() - 1), 1};
+    }
+
+    Range addAnimations(const std::unordered_map<entt::id_type, data::AnimationBlueprint>& animations) {
+        Range range{static_cast<std::uint32_t>(animations_.size()), static_cast<std::uint32_t>(animations.size())};
+        for (const auto& [name_id, animation] : animations) {
+            addAnimation(name_id, animation);
+        }
+        return range;
+    }
+
+    template<typename Cooked, typename Blueprint, typename Extra>
+    Cooked cookClass(const Blueprint& blueprint, const Extra& extra) {
+        return Cooked{blueprint.class_id_,
+            blueprint.projectile_id_,
+            addString(blueprint.class_name_),
+            blueprint.stats_,
+            extra,
+            cookSprite(blueprint.sprite_),
+            addSounds(blueprint.sounds_),
+            addAnimations(blueprint.animations_),
+            addString(blueprint.display_info_.name_),
+            addString(blueprint.display_info_.description_)};
+    }
+};
+
+// ----------------------------- 读取 -----------------------------
+
+class Reader {
+    const std::vector<char>& bytes_;
+    Header header_{};
+
+public:
+    explicit Reader(const std::vector<char>& bytes) : bytes_(bytes) {}
+
+    /// @brief 校验头部与各段的范围
+    bool validate(std::uint64_t source_hash) {
+        if (bytes_.size() < sizeof(Header)) return false;
+        std::memcpy(&header_, bytes_.data(), sizeof(Header));
+        if (header_.magic_ != MAGIC || header_.version_ != VERSION || header_.layout_ != layoutSignature()) return false;
+        if (header_.source_hash_ != source_hash) return false;
+        const std::array<size_t, SECTION_COUNT> element_sizes{
+            sizeof(CookedPlayerClass), sizeof(CookedEnemyClass), sizeof(CookedProjectile), sizeof(CookedEffect),
+            sizeof(CookedSkill), sizeof(CookedAnimation), sizeof(std::int32_t), sizeof(CookedEvent),
+            sizeof(CookedSound), sizeof(char)
+        };
+        for (size_t i = 0; i < SECTION_COUNT; ++i) {
+            const auto& section = header_.sections_[i];
+            if (section.offset_ % SECTION_ALIGNMENT != 0 || section.offset_ > bytes_.size()) return false;
+            if (section.count_ > (bytes_.size() - section.offset_) / element_sizes[i]) return false;
+        }
+        return true;
+    }
+
+    /// @brief 段数组（vector 的缓冲区满足最大基本对齐，段偏移按8字节对齐）
+    template<typename T>
+    std::span<const T> section(Section index) const {
+        const auto& info = header_.sections_[index];
+        return {reinterpret_cast<const T*>(bytes_.data() + info.offset_), static_cast<size_t>(info.count_)};
+    }
+
+    bool contains(Range range, Section index) const {
+        return static_cast<std::uint64_t>(range.first_) + range.count_ <= header_.sections_[index].count_;
+    }
+
+    bool string(StrRef ref, std::string& out) const {
+        if (static_cast<std::uint64_t>(ref.offset_) + ref.size_ >= header_.sections_[STRINGS].count_) return false;     // 结尾的 '\0' 也必须在池内
+        out.assign(section<char>(STRINGS).data() + ref.offset_, ref.size_);
+        return true;
+    }
+};
+
+/// @brief 把缓存中的记录还原为蓝图（任何越界都视为缓存损坏）
+class Loader {
+    const Reader& reader_;
+    std::span<const CookedAnimation> animations_;
+    std::span<const std::int32_t> frames_;
+    std::span<const CookedEvent> events_;
+    std::span<const CookedSound> sounds_;
+
+public:
+    explicit Loader(const Reader& reader)
+        : reader_(reader),
+          animations_(reader.section<CookedAnimation>(ANIMATIONS)),
+          frames_(reader.section<std::int32_t>(FRAMES)),
+          events_(reader.section<CookedEvent>(EVENTS)),
+          sounds_(reader.section<CookedSound>(SOUNDS)) {}
+
+    bool sprite(const CookedSprite& cooked, data::SpriteBlueprint& sprite) const {
+        sprite.id_ = cooked.id_;
+        sprite.src_rect_ = engine::utils::Rect{glm::vec2(cooked.src_rect_[0], cooked.src_rect_[1]), glm::vec2(cooked.src_rect_[2], cooked.src_rect_[3])};
+        sprite.size_ = glm::vec2(cooked.size_[0], cooked.size_[1]);
+        sprite.offset_ = glm::vec2(cooked.offset_[0], cooked.offset_[1]);
+        sprite.face_right_ = cooked.face_right_ != 0;
+        return reader_.string(cooked.path_, sprite.path_);
+    }
+
+    bool sounds(Range range, data::SoundBlueprint& sounds) const {
+        if (!reader_.contains(range, SOUNDS)) return false;
+        for (const auto& sound : sounds_.subspan(range.first_, range.count_)) {
+            sounds.sounds_.emplace(sound.key_id_, sound.sound_id_);
+        }
+        return true;
+    }
+
+    bool animation(const CookedAnimation& cooked, data::AnimationBlueprint& animation) const {
+        if (!reader_.contains(cooked.frames_, FRAMES) || !reader_.contains(cooked.events_, EVENTS)) return false;
+        animation.ms_per_frame_ = cooked.ms_per_frame_;
+        animation.row_ = cooked.row_;
+        const auto frames = frames_.subspan(cooked.frames_.first_, cooked.frames_.count_);
+        animation.frames_.assign(frames.begin(), frames.end());
+        for (const auto& event : events_.subspan(cooked.events_.first_, cooked.events_.count_)) {
+            animation.events_.emplace(event.frame_, event.event_id_);
+        }
+        return true;
+    }
+
+    bool animations(Range range, std::unordered_map<entt::id_type, data::AnimationBlueprint>& animations) const {
+        if (!reader_.contains(range, ANIMATIONS)) return false;
+        for (const auto& cooked : animations_.subspan(range.first_, range.count_)) {
+            if (!animation(cooked, animations[cooked.name_id_])) return false;
+        }
+        return true;
+    }
+
+    template<typename Cooked, typename Blueprint>
+    bool unitClass(const Cooked& cooked, Blueprint& blueprint) const {
+        blueprint.class_id_ = cooked.class_id_;
+        blueprint.projectile_id_ = cooked.projectile_id_;
+        blueprint.stats_ = cooked.stats_;
+        return reader_.string(cooked.class_name_, blueprint.class_name_) &&
+               reader_.string(cooked.name_, blueprint.display_info_.name_) &&
+               reader_.string(cooked.description_, blueprint.display_info_.description_) &&
+               sprite(cooked.sprite_, blueprint.sprite_) &&
+               sounds(cooked.sounds_, blueprint.sounds_) &&
+               animations(cooked.animations_, blueprint.animations_);
+    }
+};
+
+} // namespace
+
+bool BlueprintCache::hashSources(const BlueprintSources& sources, std::uint64_t& hash) {
+    hash = fnv1a(FNV_OFFSET, &VERSION, sizeof(VERSION));
+    std::vector<char> bytes;
+    for (auto path : {sources.player_, sources.enemy_, sources.projectile_, sources.effect_, sources.skill_}) {
+        if (!readWholeFile(std::filesystem::path(path), bytes)) {
+            spdlog::error("无法读取蓝图数据文件: {}", path);
+            return false;
+        }
+        const std::uint64_t size = bytes.size();
+        hash = fnv1a(hash, &size, sizeof(size));       // 文件长度作为分隔，避免内容在文件间平移时哈希相同
+        hash = fnv1a(hash, bytes.data(), bytes.size());
+    }
+    return true;
+}
+
+bool BlueprintCache::read(std::string_view cache_path, std::uint64_t source_hash, BlueprintManager& manager) {
+    std::vector<char> bytes;
+    if (!readWholeFile(std::filesystem::path(cache_path), bytes)) {
+        spdlog::debug("蓝图缓存 '{}' 不存在", cache_path);
+        return false;
+    }
+    Reader reader(bytes);
+    if (!reader.validate(source_hash)) {
+        spdlog::info("蓝图缓存 '{}' 已过期，重新生成", cache_path);
+        return false;
+    }
+    Loader loader(reader);
+
+    // 先还原到临时容器，全部成功后再交给管理器
+    decltype(manager.player_class_blueprints_) players;
+    decltype(manager.enemy_class_blueprints_) enemies;
+    decltype(manager.projectile_blueprints_) projectiles;
+    decltype(manager.effect_blueprints_) effects;
+    decltype(manager.skill_blueprints_) skills;
+    decltype(manager.sound_paths_) sound_paths;
+
+    bool ok = true;
+    for (const auto& cooked : reader.section<CookedPlayerClass>(PLAYERS)) {
+        auto& blueprint = players[cooked.class_id_];
+        blueprint.player_ = cooked.player_;
+        ok = ok && loader.unitClass(cooked, blueprint);
+    }
+    for (const auto& cooked : reader.section<CookedEnemyClass>(ENEMIES)) {
+        auto& blueprint = enemies[cooked.class_id_];
+        blueprint.enemy_ = cooked.enemy_;
+        ok = ok && loader.unitClass(cooked, blueprint);
+    }
+    for (const auto& cooked : reader.section<CookedProjectile>(PROJECTILES)) {
+        auto& blueprint = projectiles[cooked.id_];
+        blueprint.id_ = cooked.id_;
+        blueprint.arc_height_ = cooked.arc_height_;
+        blueprint.total_flight_time_ = cooked.total_flight_time_;
+        ok = ok && reader.string(cooked.name_, blueprint.name_) &&
+             loader.sprite(cooked.sprite_, blueprint.sprite_) &&
+             loader.sounds(cooked.sounds_, blueprint.sounds_);
+    }
+    const auto animations = reader.section<CookedAnimation>(ANIMATIONS);
+    for (const auto& cooked : reader.section<CookedEffect>(EFFECTS)) {
+        auto& blueprint = effects[cooked.id_];
+        blueprint.id_ = cooked.id_;
+        ok = ok && cooked.animation_.count_ == 1 && reader.contains(cooked.animation_, ANIMATIONS) &&
+             reader.string(cooked.name_, blueprint.name_) &&
+             loader.sprite(cooked.sprite_, blueprint.sprite_) &&
+             loader.animation(animations[cooked.animation_.first_], blueprint.animation_);
+    }
+    for (const auto& cooked : reader.section<CookedSkill>(SKILLS)) {
+        auto& blueprint = skills[cooked.id_];
+        blueprint.id_ = cooked.id_;
+        blueprint.passive_ = cooked.passive_ != 0;
+        blueprint.cooldown_ = cooked.cooldown_;
+        blueprint.duration_ = cooked.duration_;
+        blueprint.buff_ = cooked.buff_;
+        ok = ok && reader.string(cooked.name_, blueprint.name_) &&
+             reader.string(cooked.description_, blueprint.description_);
+    }
+    for (const auto& sound : reader.section<CookedSound>(SOUNDS)) {
+        std::string path;
+        ok = ok && reader.string(sound.path_, path);
+        sound_paths.emplace(sound.sound_id_, std::move(path));
+    }
+    if (!ok) {
+        spdlog::warn("蓝图缓存 '{}' 已损坏，重新生成", cache_path);
+        return false;
+    }
+
+    // 与解析 json 时一样，预先载入蓝图引用的音效
+    for (const auto& [sound_id, path] : sound_paths) {
+        manager.resource_manager_.loadSound(sound_id, path);
+    }
+    manager.player_class_blueprints_ = std::move(players);
+    manager.enemy_class_blueprints_ = std::move(enemies);
+    manager.projectile_blueprints_ = std::move(projectiles);
+    manager.effect_blueprints_ = std::move(effects);
+    manager.skill_blueprints_ = std::move(skills);
+    manager.sound_paths_ = std::move(sound_paths);
+    return true;
+}
+
+bool BlueprintCache::write(std::string_view cache_path, std::uint64_t source_hash, const BlueprintManager& manager) {
+    Writer writer(manager.sound_paths_);
+    for (const auto& [id, blueprint] : manager.player_class_blueprints_) {
+        writer.players_.push_back(writer.cookClass<CookedPlayerClass>(blueprint, blueprint.player_));
+    }
+    for (const auto& [id, blueprint] : manager.enemy_class_blueprints_) {
+        writer.enemies_.push_back(writer.cookClass<CookedEnemyClass>(blueprint, blueprint.enemy_));
+    }
+    for (const auto& [id, blueprint] : manager.projectile_blueprints_) {
+        writer.projectiles_.push_back(CookedProjectile{blueprint.id_,
+            writer.addString(blueprint.name_),
+            blueprint.arc_height_,
+            blueprint.total_flight_time_,
+            writer.cookSprite(blueprint.sprite_),
+            writer.addSounds(blueprint.sounds_)});
+    }
+    for (const auto& [id, blueprint] : manager.effect_blueprints_) {
+        writer.effects_.push_back(CookedEffect{blueprint.id_,
+            writer.addString(blueprint.name_),
+            writer.cookSprite(blueprint.sprite_),
+            writer.addAnimation(0, blueprint.animation_)});
+    }
+    for (const auto& [id, blueprint] : manager.skill_blueprints_) {
+        writer.skills_.push_back(CookedSkill{blueprint.id_,
+            writer.addString(blueprint.name_),
+            writer.addString(blueprint.description_),
+            blueprint.passive_ ? 1u : 0u,
+            blueprint.cooldown_,
+            blueprint.duration_,
+            blueprint.buff_});
+    }
+
+    // --- 计算各段偏移 ---
+    Header header;
+    header.layout_ = layoutSignature();
+    header.source_hash_ = source_hash;
+    const std::array<std::pair<const void*, std::uint64_t>, SECTION_COUNT> sections{{
+        {writer.players_.data(), writer.players_.size() * sizeof(CookedPlayerClass)},
+        {writer.enemies_.data(), writer.enemies_.size() * sizeof(CookedEnemyClass)},
+        {writer.projectiles_.data(), writer.projectiles_.size() * sizeof(CookedProjectile)},
+        {writer.effects_.data(), writer.effects_.size() * sizeof(CookedEffect)},
+        {writer.skills_.data(), writer.skills_.size() * sizeof(CookedSkill)},
+        {writer.animations_.data(), writer.animations_.size() * sizeof(CookedAnimation)},
+        {writer.frames_.data(), writer.frames_.size() * sizeof(std::int32_t)},
+        {writer.events_.data(), writer.events_.size() * sizeof(CookedEvent)},
+        {writer.sounds_.data(), writer.sounds_.size() * sizeof(CookedSound)},
+        {writer.strings_.data(), writer.strings_.size()},
+    }};
+    const std::array<std::uint64_t, SECTION_COUNT> counts{
+        writer.players_.size(), writer.enemies_.size(), writer.projectiles_.size(), writer.effects_.size(),
+        writer.skills_.size(), writer.animations_.size(), writer.frames_.size(), writer.events_.size(),
+        writer.sounds_.size(), writer.strings_.size()
+    };
+    std::uint64_t offset = sizeof(Header);
+    for (size_t i = 0; i < SECTION_COUNT; ++i) {
+        offset = (offset + SECTION_ALIGNMENT - 1) / SECTION_ALIGNMENT * SECTION_ALIGNMENT;
+        header.sections_[i] = SectionInfo{offset, counts[i]};
+        offset += sections[i].second;
+    }
+
+    // --- 写入文件 ---
+    const std::filesystem::path path(cache_path);
+    std::error_code ec;
+    if (path.has_parent_path()) std::filesystem::create_directories(path.parent_path(), ec);
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        spdlog::warn("无法写入蓝图缓存: {}", cache_path);
+        return false;
+    }
+    file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+    for (size_t i = 0; i < SECTION_COUNT; ++i) {
+        static constexpr char ZEROS[SECTION_ALIGNMENT]{};
+        const auto padding = header.sections_[i].offset_ - static_cast<std::uint64_t>(file.tellp());
+        file.write(ZEROS, static_cast<std::streamsize>(padding));
+        file.write(static_cast<const char*>(sections[i].first), static_cast<std::streamsize>(sections[i].second));
+    }
+    if (!file) {
+        spdlog::warn("写入蓝图缓存失败: {}", cache_path);
+        return false;
+    }
+    spdlog::info("蓝图缓存已写入 '{}' ({} 字节)", cache_path, offset);
+    return true;
+}
+
+} // namespace game::factory
@@ -0,0 +1,51 @@
+#pragma once
+#include <cstdint>
+#include <string_view>
+
+namespace game::factory {
+
+class BlueprintManager;
+struct BlueprintSources;
+
+/**
+ * @brief 蓝图的二进制缓存
+ *
+ * 缓存文件由头部（魔数、版本、结构布局签名、源文件内容哈希、各段的偏移与数量）和若干段扁平数组组成：
+ * 职业/敌人/投射物/特效/技能记录，以及它们引用的动画、动画帧、动画事件、音效和字符串池。
+ * 记录都是平凡可复制的结构体，字符串以 (偏移, 长度) 引用字符串池，所有 id 都已在生成时哈希好。
+ * 读取时一次性读入整个文件，校验后直接还原为 BlueprintManager 中的蓝图，无需解析 json 和计算哈希。
+ *
+ * 缓存与平台相关（字节序、结构体布局），布局签名不一致时视为过期并重新生成。
+ */
+class BlueprintCache final {
+public:
+    BlueprintCache() = delete;
+
+    /**
+     * @brief 计算所有源文件内容的哈希值
+     * @param sources 源数据文件
+     * @param hash 输出：哈希值
+     * @return 是否成功（有文件无法读取时返回 false）
+     */
+    static bool hashSources(const BlueprintSources& sources, std::uint64_t& hash);
+
+    /**
+     * @brief 从缓存读取蓝图
+     * @param cache_path 缓存文件路径
+     * @param source_hash 当前源文件的哈希值
+     * @param manager 输出：蓝图管理器（同时会载入蓝图引用的音效）
+     * @return 缓存存在、未过期且读取成功时返回 true
+     */
+    static bool read(std::string_view cache_path, std::uint64_t source_hash, BlueprintManager& manager);
+
+    /**
+     * @brief 把蓝图管理器中的所有蓝图写入缓存
+     * @param cache_path 缓存文件路径（目录不存在时会创建）
+     * @param source_hash 源文件的哈希值
+     * @param manager 蓝图管理器
+     * @return 是否成功
+     */
+    static bool write(std::string_view cache_path, std::uint64_t source_hash, const BlueprintManager& manager);
+};
+
+} // namespace game::factory
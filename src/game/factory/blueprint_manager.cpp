@@ -1,7 +1,9 @@
 #include "blueprint_manager.h"
+#include "blueprint_cache.h"
 #include "engine/resource/resource_manager.h"
 #include <filesystem>
 #include <fstream>
+#include <chrono>
 #include <nlohmann/json.hpp>
 #include <spdlog/spdlog.h>
 #include <entt/core/hashed_string.hpp>
@@ -194,6 +196,33 @@ bool BlueprintManager::loadSkillBlueprints(std::string_view skill_json_path) {
     return true;
 }
 
+bool BlueprintManager::loadAllBlueprints(const BlueprintSources& sources, std::string_view cache_path) {
+    const auto start = std::chrono::steady_clock::now();
+    std::uint64_t source_hash = 0;
+    const bool hashed = BlueprintCache::hashSources(sources, source_hash);
+
+    if (hashed && BlueprintCache::read(cache_path, source_hash, *this)) {
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        spdlog::info("从缓存 '{}' 载入蓝图，耗时 {:.2f} ms", cache_path, elapsed.count());
+        return true;
+    }
+
+    // 缓存不存在或已过期：解析 json 并重新生成缓存
+    if (!loadEnemyClassBlueprints(sources.enemy_) ||
+        !loadPlayerClassBlueprints(sources.player_) ||
+        !loadProjectileBlueprints(sources.projectile_) ||
+        !loadEffectBlueprints(sources.effect_) ||
+        !loadSkillBlueprints(sources.skill_)) {
+        return false;
+    }
+    if (hashed) {
+        BlueprintCache::write(cache_path, source_hash, *this);
+    }
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    spdlog::info("从 json 载入蓝图，耗时 {:.2f} ms", elapsed.count());
+    return true;
+}
+
 const data::PlayerClassBlueprint& BlueprintManager::getPlayerClassBlueprint(entt::id_type id) const {
     if (auto it = player_class_blueprints_.find(id); it != player_class_blueprints_.end()) {
         return it->second;
@@ -315,6 +344,7 @@ data::SoundBlueprint BlueprintManager::parseSound(const nlohmann::json& json) {
             std::string sound_path = sound_value.get<std::string>();
             entt::id_type sound_id = entt::hashed_string(sound_path.c_str());
             resource_manager_.loadSound(sound_id, sound_path);
+            sound_paths_.emplace(sound_id, std::move(sound_path));
             // 将音效键值对转换为音效ID并插入到声音蓝图中
             sounds.sounds_.emplace(entt::hashed_string(sound_key.c_str()), sound_id);
         }
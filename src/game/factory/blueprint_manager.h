@@ -1,5 +1,6 @@
 #pragma once
 #include "game/data/entity_blueprint.h"
+#include <string>
 #include <string_view>
 #include <unordered_map>
 #include <entt/entity/fwd.hpp>
@@ -11,6 +12,17 @@ namespace engine::resource {
 
 namespace game::factory {
 
+/**
+ * @brief 所有蓝图的源数据文件
+ */
+struct BlueprintSources {
+    std::string_view player_{"assets/data/player_data.json"};
+    std::string_view enemy_{"assets/data/enemy_data.json"};
+    std::string_view projectile_{"assets/data/projectile_data.json"};
+    std::string_view effect_{"assets/data/effect_data.json"};
+    std::string_view skill_{"assets/data/skill_data.json"};
+};
+
 /**
  * @brief 蓝图管理器，用于存储、管理所有蓝图
  * 
@@ -18,6 +30,7 @@ namespace game::factory {
  */
 class BlueprintManager {
     friend class EntityFactory;
+    friend class BlueprintCache;
 
 private:
     engine::resource::ResourceManager& resource_manager_;
@@ -27,6 +40,7 @@ private:
     std::unordered_map<entt::id_type, data::ProjectileBlueprint> projectile_blueprints_;    ///< @brief 投射物蓝图
     std::unordered_map<entt::id_type, data::EffectBlueprint> effect_blueprints_;            ///< @brief 特效蓝图
     std::unordered_map<entt::id_type, data::SkillBlueprint> skill_blueprints_;              ///< @brief 技能蓝图
+    std::unordered_map<entt::id_type, std::string> sound_paths_;                            ///< @brief 音效ID -> 音效路径（写入蓝图缓存时使用）
     // TODO: 未来添加其他蓝图容器
 
 public:
@@ -37,6 +51,16 @@ public:
     [[nodiscard]] bool loadProjectileBlueprints(std::string_view projectile_json_path); ///< @brief 加载投射物蓝图, 返回是否成功
     [[nodiscard]] bool loadEffectBlueprints(std::string_view effect_json_path);         ///< @brief 加载特效蓝图, 返回是否成功
     [[nodiscard]] bool loadSkillBlueprints(std::string_view skill_json_path);           ///< @brief 加载技能蓝图, 返回是否成功
+
+    /**
+     * @brief 加载所有蓝图，优先使用二进制缓存
+     * @param sources 源数据文件
+     * @param cache_path 缓存文件路径
+     * @return 是否成功
+     * @note 缓存中记录了源文件内容的哈希值，一致时一次读取整个缓存文件即可还原所有蓝图；
+     *       否则解析源 json 并重新生成缓存。
+     */
+    [[nodiscard]] bool loadAllBlueprints(const BlueprintSources& sources = {}, std::string_view cache_path = "assets/cache/blueprints.bin");
     // TODO: 未来添加其他蓝图加载函数
 
     const data::PlayerClassBlueprint& getPlayerClassBlueprint(entt::id_type id) const;  ///< @brief 获取指定ID的玩家职业蓝图
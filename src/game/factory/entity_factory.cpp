@@ -8,6 +8,7 @@
 #include "engine/component/velocity_component.h"
 #include "engine/component/render_component.h"
 #include "game/defs/tags.h"
+#include "engine/defs/tags.h"
 #include "engine/component/audio_component.h"
 #include "game/component/stats_component.h"
 #include "game/component/enemy_component.h"
@@ -144,6 +145,7 @@ entt::entity EntityFactory::createUnitPrep(entt::id_type name_id, entt::id_type
 
     // 补充渲染组件与显示攻击范围标志
     registry_.emplace<engine::component::RenderComponent>(entity, 100);     // 显示优先度很高
+    registry_.emplace<engine::defs::FollowCursorTag>(entity);              // 绘制时使用渲染前重新采样的鼠标位置
     if (blueprint.player_.type_ == game::defs::PlayerType::RANGED) {
         registry_.emplace<game::defs::ShowRangeTag>(entity);
     }
@@ -0,0 +1,153 @@
+#include "replay_player.h"
+#include "game/defs/events.h"
+#include "game/component/player_component.h"
+#include "engine/component/name_component.h"
+#include "engine/core/context.h"
+#include "engine/core/game_state.h"
+#include "engine/input/input_manager.h"
+#include "engine/utils/events.h"
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <entt/entity/registry.hpp>
+#include <entt/signal/dispatcher.hpp>
+#include <spdlog/spdlog.h>
+
+namespace game::replay {
+
+ReplayPlayer::ReplayPlayer(entt::registry& registry, engine::core::Context& context, std::shared_ptr<const game::data::ReplayData> replay)
+    : registry_(registry), context_(context), replay_(std::move(replay)) {
+    if (!replay_) {
+        throw std::runtime_error("录像回放器: 录像数据为空");
+    }
+    frame_times_.reserve(replay_->frames_.size());
+    frame_game_times_.reserve(replay_->frames_.size());
+    // 第一帧的输入要在下一次 InputManager::update() 时应用
+    auto& input_manager = context_.getInputManager();
+    input_manager.setPlayback(true);
+    if (!replay_->frames_.empty()) {
+        input_manager.setPlaybackFrame(replay_->frames_.front().input_);
+    }
+    spdlog::info("开始回放录像：{} 帧，种子 {}", replay_->frames_.size(), replay_->seed_);
+}
+
+ReplayPlayer::~ReplayPlayer() {
+    context_.getInputManager().setPlayback(false);
+}
+
+bool ReplayPlayer::beginFrame(float& delta_time) {
+    if (is_finished_) return false;
+    const auto now = std::chrono::steady_clock::now();
+    if (frame_index_ == 0) {
+        start_time_ = now;
+    } else {
+        frame_times_.push_back(std::chrono::duration<float, std::milli>(now - frame_start_).count());
+    }
+    frame_start_ = now;
+
+    if (frame_index_ >= replay_->frames_.size()) {
+        finish();
+        return false;
+    }
+
+    const auto& frame = replay_->frames_[frame_index_];
+    // 恢复暂停状态（录制时由调试面板切换）
+    auto& game_state = context_.getGameState();
+    if (frame.is_paused_ != game_state.isPaused()) {
+        game_state.setState(frame.is_paused_ ? engine::core::State::Paused : engine::core::State::Playing);
+    }
+    for (const auto& command : frame.commands_) {
+        dispatchCommand(command);
+    }
+    // 下一帧的输入在下一次 InputManager::update() 时应用
+    if (++frame_index_ < replay_->frames_.size()) {
+        context_.getInputManager().setPlaybackFrame(replay_->frames_[frame_index_].input_);
+    }
+
+    frame_game_times_.push_back(game_time_);
+    game_time_ += frame.delta_time_;
+    delta_time = frame.delta_time_;
+    return true;
+}
+
+void ReplayPlayer::dispatchCommand(const game::data::ReplayCommand& command) {
+    using Type = game::data::ReplayCommand::Type;
+    auto& dispatcher = context_.getDispatcher();
+    switch (command.type_) {
+        case Type::PREP_UNIT:
+            dispatcher.enqueue(game::defs::PrepUnitEvent{command.name_id_, command.class_id_, command.cost_});
+            return;
+        case Type::SAVE_CHECKPOINT:
+            dispatcher.enqueue(game::defs::SaveCheckpointEvent{});
+            return;
+        case Type::LOAD_CHECKPOINT:
+            dispatcher.enqueue(game::defs::LoadCheckpointEvent{});
+            return;
+        case Type::REWIND_CHECKPOINT:
+            dispatcher.enqueue(game::defs::RewindCheckpointEvent{});
+            return;
+        default:
+            break;
+    }
+
+    // 其余指令作用于场上的单位
+    const auto entity = findUnit(command.name_id_);
+    if (entity == entt::null) {
+        spdlog::warn("回放第 {} 帧：找不到单位 {}，跳过指令 {}（录像与当前版本的游戏逻辑可能不一致）",
+                     frame_index_, command.name_id_, static_cast<int>(command.type_));
+        return;
+    }
+    switch (command.type_) {
+        case Type::UPGRADE_UNIT:
+            dispatcher.enqueue(game::defs::UpgradeUnitEvent{entity, command.cost_});
+            break;
+        case Type::RETREAT:
+            dispatcher.enqueue(game::defs::RetreatEvent{entity, command.cost_});
+            break;
+        case Type::SKILL_ACTIVE:
+            dispatcher.enqueue(game::defs::SkillActiveEvent{entity});
+            break;
+        default:
+            break;
+    }
+}
+
+entt::entity ReplayPlayer::findUnit(entt::id_type name_id) const {
+    auto view = registry_.view<engine::component::NameComponent, game::component::PlayerComponent>();
+    for (auto entity : view) {
+        if (view.get<engine::component::NameComponent>(entity).name_id_ == name_id) {
+            return entity;
+        }
+    }
+    return entt::null;
+}
+
+void ReplayPlayer::finish() {
+    if (is_finished_) return;
+    is_finished_ = true;
+    const auto now = std::chrono::steady_clock::now();
+    // 提前结束（关卡结束）时，补上当前帧的耗时
+    if (frame_index_ > 0 && frame_times_.size() < frame_game_times_.size()) {
+        frame_times_.push_back(std::chrono::duration<float, std::milli>(now - frame_start_).count());
+    }
+    const std::chrono::duration<double, std::milli> total = now - start_time_;
+    const auto frame_count = frame_times_.size();
+    spdlog::info("录像回放完成：{} 帧，游戏时间 {:.2f} s，实际耗时 {:.2f} ms（平均每帧 {:.3f} ms）",
+                 frame_count, game_time_, total.count(), frame_count > 0 ? total.count() / frame_count : 0.0);
+
+    // 列出最慢的帧（帧序号与游戏时间可用于在录像中定位性能尖峰）
+    std::vector<std::size_t> order(frame_count);
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    const auto slowest = std::min(REPORT_SLOWEST_FRAMES, frame_count);
+    std::partial_sort(order.begin(), order.begin() + slowest, order.end(), [this](std::size_t a, std::size_t b) {
+        return frame_times_[a] > frame_times_[b];
+    });
+    for (std::size_t i = 0; i < slowest; ++i) {
+        const auto index = order[i];
+        spdlog::info("  最慢帧 #{}: 第 {} 帧（游戏时间 {:.2f} s），耗时 {:.3f} ms",
+                     i + 1, index, frame_game_times_[index], frame_times_[index]);
+    }
+    context_.getDispatcher().enqueue(engine::utils::QuitEvent{});
+}
+
+} // namespace game::replay
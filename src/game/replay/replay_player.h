@@ -0,0 +1,63 @@
+#pragma once
+#include "game/data/replay_data.h"
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include <entt/entity/fwd.hpp>
+
+namespace engine::core {
+    class Context;
+}
+
+namespace game::replay {
+
+/**
+ * @brief 录像回放器
+ *
+ * 由 GameScene 持有。开启 InputManager 的回放模式，每帧开始时用录像中的帧时间代替真实帧时间、
+ * 恢复暂停状态、重新发送录像中的UI指令，并把下一帧的输入交给 InputManager。
+ * 同时统计每帧实际耗时，回放结束后输出最慢的若干帧（用于复现性能尖峰），然后退出游戏。
+ */
+class ReplayPlayer {
+    static constexpr std::size_t REPORT_SLOWEST_FRAMES{10};    ///< @brief 回放结束时列出的最慢帧数量
+
+    entt::registry& registry_;
+    engine::core::Context& context_;
+    std::shared_ptr<const game::data::ReplayData> replay_;
+
+    std::size_t frame_index_{0};                            ///< @brief 下一帧的序号
+    float game_time_{0.0f};                                 ///< @brief 已回放的游戏时间（秒）
+    bool is_finished_{false};
+    std::chrono::steady_clock::time_point start_time_;      ///< @brief 开始回放的时间
+    std::chrono::steady_clock::time_point frame_start_;     ///< @brief 上一帧开始的时间
+    std::vector<float> frame_times_;                        ///< @brief 每帧实际耗时（毫秒）
+    std::vector<float> frame_game_times_;                   ///< @brief 每帧开始时的游戏时间（秒），用于定位
+
+public:
+    /**
+     * @brief 构造函数（开启 InputManager 的回放模式）
+     * @param registry 场景注册表
+     * @param context 引擎上下文
+     * @param replay 录像数据
+     */
+    ReplayPlayer(entt::registry& registry, engine::core::Context& context, std::shared_ptr<const game::data::ReplayData> replay);
+    ~ReplayPlayer();
+
+    /**
+     * @brief 开始回放新的一帧（在场景更新开始时调用）
+     * @param delta_time 输出：录像中这一帧的帧时间
+     * @return 是否还有可回放的帧；全部回放完毕时输出统计并请求退出，返回 false
+     */
+    bool beginFrame(float& delta_time);
+
+    /// @brief 结束回放：输出统计并请求退出（录像播完时自动调用；关卡提前结束时由场景调用）
+    void finish();
+    bool isFinished() const { return is_finished_; }
+
+private:
+    void dispatchCommand(const game::data::ReplayCommand& command);     ///< @brief 重新发送录像中的指令
+    entt::entity findUnit(entt::id_type name_id) const;                ///< @brief 按名称ID查找场上的玩家单位
+};
+
+} // namespace game::replay
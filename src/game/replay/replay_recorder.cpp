@@ -0,0 +1,81 @@
+#include "replay_recorder.h"
+#include "game/defs/tags.h"
+#include "engine/component/name_component.h"
+#include "engine/core/context.h"
+#include "engine/core/game_state.h"
+#include "engine/input/input_manager.h"
+#include <entt/entity/registry.hpp>
+#include <entt/signal/dispatcher.hpp>
+#include <spdlog/spdlog.h>
+
+namespace game::replay {
+
+ReplayRecorder::ReplayRecorder(entt::registry& registry, engine::core::Context& context, std::uint64_t seed, std::string session_data)
+    : registry_(registry), context_(context) {
+    replay_.seed_ = seed;
+    replay_.session_data_ = std::move(session_data);
+    auto& dispatcher = context_.getDispatcher();
+    dispatcher.sink<game::defs::PrepUnitEvent>().connect<&ReplayRecorder::onPrepUnitEvent>(this);
+    dispatcher.sink<game::defs::UpgradeUnitEvent>().connect<&ReplayRecorder::onUpgradeUnitEvent>(this);
+    dispatcher.sink<game::defs::RetreatEvent>().connect<&ReplayRecorder::onRetreatEvent>(this);
+    dispatcher.sink<game::defs::SkillActiveEvent>().connect<&ReplayRecorder::onSkillActiveEvent>(this);
+    dispatcher.sink<game::defs::SaveCheckpointEvent>().connect<&ReplayRecorder::onSaveCheckpointEvent>(this);
+    dispatcher.sink<game::defs::LoadCheckpointEvent>().connect<&ReplayRecorder::onLoadCheckpointEvent>(this);
+    dispatcher.sink<game::defs::RewindCheckpointEvent>().connect<&ReplayRecorder::onRewindCheckpointEvent>(this);
+}
+
+ReplayRecorder::~ReplayRecorder() {
+    context_.getDispatcher().disconnect(this);
+}
+
+void ReplayRecorder::beginFrame(float delta_time) {
+    auto& frame = replay_.frames_.emplace_back();
+    frame.delta_time_ = delta_time;
+    frame.is_paused_ = context_.getGameState().isPaused();
+    frame.input_ = context_.getInputManager().getFrameInput();
+}
+
+void ReplayRecorder::addCommand(game::data::ReplayCommand command) {
+    // 事件在帧末统一分发，此时当前帧已经记录
+    if (replay_.frames_.empty()) return;
+    replay_.frames_.back().commands_.push_back(command);
+}
+
+entt::id_type ReplayRecorder::getNameId(entt::entity entity) const {
+    if (entity == entt::null || !registry_.valid(entity)) return entt::null;
+    const auto* name = registry_.try_get<engine::component::NameComponent>(entity);
+    return name ? name->name_id_ : entt::id_type{entt::null};
+}
+
+void ReplayRecorder::onPrepUnitEvent(const game::defs::PrepUnitEvent& event) {
+    addCommand({game::data::ReplayCommand::Type::PREP_UNIT, event.name_id_, event.class_id_, event.cost_});
+}
+
+void ReplayRecorder::onUpgradeUnitEvent(const game::defs::UpgradeUnitEvent& event) {
+    addCommand({game::data::ReplayCommand::Type::UPGRADE_UNIT, getNameId(event.entity_), entt::null, event.cost_});
+}
+
+void ReplayRecorder::onRetreatEvent(const game::defs::RetreatEvent& event) {
+    addCommand({game::data::ReplayCommand::Type::RETREAT, getNameId(event.entity_), entt::null, event.cost_});
+}
+
+void ReplayRecorder::onSkillActiveEvent(const game::defs::SkillActiveEvent& event) {
+    // 被动技能由 PlaceUnitSystem 在放置单位时自动释放，回放时会自然重现，不需要记录
+    if (event.entity_ == entt::null || !registry_.valid(event.entity_) ||
+        registry_.all_of<game::defs::PassiveSkillTag>(event.entity_)) return;
+    addCommand({game::data::ReplayCommand::Type::SKILL_ACTIVE, getNameId(event.entity_)});
+}
+
+void ReplayRecorder::onSaveCheckpointEvent() {
+    addCommand({game::data::ReplayCommand::Type::SAVE_CHECKPOINT});
+}
+
+void ReplayRecorder::onLoadCheckpointEvent() {
+    addCommand({game::data::ReplayCommand::Type::LOAD_CHECKPOINT});
+}
+
+void ReplayRecorder::onRewindCheckpointEvent() {
+    addCommand({game::data::ReplayCommand::Type::REWIND_CHECKPOINT});
+}
+
+} // namespace game::replay
@@ -0,0 +1,56 @@
+#pragma once
+#include "game/data/replay_data.h"
+#include "game/defs/events.h"
+#include <cstdint>
+#include <string>
+#include <entt/entity/fwd.hpp>
+
+namespace engine::core {
+    class Context;
+}
+
+namespace game::replay {
+
+/**
+ * @brief 录像录制器
+ *
+ * 由 GameScene 持有。每帧开始时记录场景收到的帧时间、暂停状态和 InputManager 本帧的输入，
+ * 并监听来自UI的事件（PrepUnitEvent、UpgradeUnitEvent 等），记录为当前帧的指令。
+ * 场景结束时由 GameScene 取出录像并写入文件，之后可用 --replay 参数无界面回放。
+ */
+class ReplayRecorder {
+    entt::registry& registry_;
+    engine::core::Context& context_;
+
+    game::data::ReplayData replay_;     ///< @brief 录制中的录像
+
+public:
+    /**
+     * @brief 构造函数
+     * @param registry 场景注册表
+     * @param context 引擎上下文
+     * @param seed 场景随机数流的种子
+     * @param session_data 开局时的会话数据（SessionData::serialize() 的结果）
+     */
+    ReplayRecorder(entt::registry& registry, engine::core::Context& context, std::uint64_t seed, std::string session_data);
+    ~ReplayRecorder();
+
+    void beginFrame(float delta_time);      ///< @brief 记录新的一帧（在场景更新开始时调用）
+
+    const game::data::ReplayData& getReplay() const { return replay_; }
+
+private:
+    void addCommand(game::data::ReplayCommand command);     ///< @brief 把指令加入当前帧
+    entt::id_type getNameId(entt::entity entity) const;     ///< @brief 获取玩家单位的名称ID（无效实体返回 entt::null）
+
+    // 事件回调函数
+    void onPrepUnitEvent(const game::defs::PrepUnitEvent& event);
+    void onUpgradeUnitEvent(const game::defs::UpgradeUnitEvent& event);
+    void onRetreatEvent(const game::defs::RetreatEvent& event);
+    void onSkillActiveEvent(const game::defs::SkillActiveEvent& event);
+    void onSaveCheckpointEvent();
+    void onLoadCheckpointEvent();
+    void onRewindCheckpointEvent();
+};
+
+} // namespace game::replay
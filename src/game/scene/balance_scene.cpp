@@ -0,0 +1,123 @@
+#include "balance_scene.h"
+#include "game/data/level_config.h"
+#include "game/data/level_template.h"
+#include "game/data/session_data.h"
+#include "game/factory/blueprint_manager.h"
+#include "game/loader/entity_builder_mw.h"
+#include "engine/core/context.h"
+#include "engine/loader/tile_chunk_map.h"
+#include "engine/loader/level_loader.h"
+#include "engine/utils/math.h"
+#include <algorithm>
+#include <cmath>
+#include <spdlog/spdlog.h>
+
+namespace game::scene {
+
+BalanceScene::BalanceScene(engine::core::Context& context,
+                           game::simulation::BalanceConfig config,
+                           int level_number,
+                           std::string output_prefix)
+    : engine::scene::Scene("BalanceScene", context),
+      config_(std::move(config)),
+      level_number_(level_number),
+      output_prefix_(std::move(output_prefix)) {
+}
+
+BalanceScene::~BalanceScene() = default;
+
+bool BalanceScene::init() {
+    auto level_config = std::make_shared<game::data::LevelConfig>();
+    if (!level_config->loadFromFile("assets/data/level_config.json")) {
+        spdlog::error("加载关卡配置失败");
+        return false;
+    }
+    auto blueprint_manager = std::make_shared<game::factory::BlueprintManager>(context_.getResourceManager());
+    if (!blueprint_manager->loadAllBlueprints()) {
+        spdlog::error("加载蓝图失败");
+        return false;
+    }
+    game::data::SessionData session_data;
+    if (!session_data.loadDefaultData()) {
+        spdlog::error("加载默认会话数据失败");
+        return false;
+    }
+
+    // 可供放置的单位：默认会话数据中的角色，费用与单位肖像UI的算法一致（按名称ID排序，保证结果可复现）
+    std::vector<game::simulation::SimulationUnit> roster;
+    for (const auto& [name_id, unit_data] : session_data.getUnitMap()) {
+        const auto& player = blueprint_manager->getPlayerClassBlueprint(unit_data.class_id_).player_;
+        const auto cost = static_cast<int>(std::round(engine::utils::statModify(player.cost_, 1, unit_data.rarity_)));
+        roster.push_back({unit_data, player.type_, cost});
+    }
+    std::sort(roster.begin(), roster.end(), [](const auto& a, const auto& b) { return a.data_.name_id_ < b.data_.name_id_; });
+
+    std::vector<game::simulation::SimulationLevel> levels;
+    if (!buildLevels(*level_config, levels)) {
+        return false;
+    }
+    balance_runner_ = std::make_unique<game::simulation::BalanceRunner>(std::move(blueprint_manager),
+                                                                        std::move(level_config),
+                                                                        std::move(roster),
+                                                                        std::move(levels));
+    return Scene::init();
+}
+
+bool BalanceScene::buildLevels(game::data::LevelConfig& level_config, std::vector<game::simulation::SimulationLevel>& levels) {
+    const int level_count = level_config.getLevelCount();
+    if (level_number_ < 0 || level_number_ > level_count) {
+        spdlog::error("关卡 {} 不存在（共 {} 关）", level_number_, level_count);
+        return false;
+    }
+    const int first = level_number_ == 0 ? 1 : level_number_;
+    const int last = level_number_ == 0 ? level_count : level_number_;
+    for (int number = first; number <= last; ++number) {
+        // 载入地图（瓦片层按区块保存，不生成实体），生成关卡模板后清空注册表，继续载入下一关
+        const auto map_path = level_config.getMapPath(number);
+        std::unordered_map<int, game::data::WaypointNode> waypoint_nodes;
+        std::vector<int> start_points;
+        engine::loader::LevelLoader level_loader;
+        level_loader.setEntityBuilder(std::make_unique<game::loader::EntityBuilderMW>(level_loader,
+            context_,
+            registry_,
+            waypoint_nodes,
+            start_points)
+        );
+        level_loader.setChunkStreaming(true);
+        if (!level_loader.loadLevel(map_path, this)) {
+            spdlog::error("加载关卡 {} 失败", number);
+            return false;
+        }
+        auto level_template = game::data::LevelTemplate::capture(map_path, registry_, waypoint_nodes, start_points, nullptr);
+        registry_.clear();
+        if (!level_template) {
+            spdlog::error("关卡 {} 无法生成关卡模板", number);
+            return false;
+        }
+        levels.push_back({number, std::move(level_template), level_config.getWavesData(number), level_config.getTotalEnemyCount(number)});
+    }
+    return true;
+}
+
+void BalanceScene::update(float) {
+    if (is_finished_) return;
+    is_finished_ = true;
+
+    spdlog::info("开始平衡性模拟：每个关卡、每种策略 {} 次", config_.runs_);
+    // 模拟中各系统的日志量很大，运行期间只保留错误日志
+    const auto log_level = spdlog::get_level();
+    spdlog::set_level(spdlog::level::err);
+    const auto& results = balance_runner_->run(config_);
+    spdlog::set_level(log_level);
+
+    const auto elapsed_ms = balance_runner_->getElapsedMs();
+    spdlog::info("平衡性模拟完成：{} 次，{} 个线程，耗时 {:.1f} ms（每秒 {:.1f} 次）",
+                 results.size(), balance_runner_->getThreadCount(), elapsed_ms,
+                 elapsed_ms > 0.0 ? results.size() * 1000.0 / elapsed_ms : 0.0);
+    if (!balance_runner_->writeReport(output_prefix_)) {
+        spdlog::error("写出平衡性报告失败");
+    }
+    quit();
+}
+
+}   // namespace game::scene
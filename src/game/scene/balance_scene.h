@@ -0,0 +1,45 @@
+#pragma once
+#include "engine/scene/scene.h"
+#include "game/simulation/balance_runner.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace game::scene {
+
+/**
+ * @brief 平衡性测试场景（命令行参数 --balance，无界面运行）
+ *
+ * 初始化时读取关卡配置、蓝图和默认会话数据，并在主线程中为每个要模拟的关卡载入地图、生成关卡模板；
+ * 第一次更新时用 BalanceRunner 并行运行所有模拟，写出报告后退出游戏。
+ */
+class BalanceScene final: public engine::scene::Scene {
+    game::simulation::BalanceConfig config_;                        ///< @brief 模拟参数
+    int level_number_{0};                                           ///< @brief 要模拟的关卡（0 = 所有关卡）
+    std::string output_prefix_;                                     ///< @brief 报告路径前缀
+    std::unique_ptr<game::simulation::BalanceRunner> balance_runner_;
+    bool is_finished_{false};
+
+public:
+    /**
+     * @brief 构造函数
+     * @param context 上下文
+     * @param config 模拟参数
+     * @param level_number 要模拟的关卡（0 = 所有关卡）
+     * @param output_prefix 报告路径前缀（输出 <prefix>.csv 与 <prefix>.json）
+     */
+    BalanceScene(engine::core::Context& context,
+                 game::simulation::BalanceConfig config,
+                 int level_number,
+                 std::string output_prefix);
+    ~BalanceScene();
+
+    bool init() override;
+    void update(float delta_time) override;
+
+private:
+    /// @brief 在主线程中载入关卡地图并生成模拟用的关卡输入
+    bool buildLevels(game::data::LevelConfig& level_config, std::vector<game::simulation::SimulationLevel>& levels);
+};
+
+}   // namespace game::scene
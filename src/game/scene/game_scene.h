@@ -8,7 +8,10 @@
 #include "game/system/fwd.h"
 #include "engine/scene/scene.h"
 #include "engine/system/fwd.h"
+#include "engine/utils/random.h"
+#include <future>
 #include <memory>
+#include <string>
 #include <unordered_map>
 #include <vector>
 #include <entt/entity/entity.hpp>
@@ -17,10 +20,24 @@ namespace engine::ui {
     class UIElement;
 }
 
+namespace engine::loader {
+    struct PreloadedLevel;
+}
+
 namespace game::ui {
     class UnitsPortraitUI;
 }
 
+namespace game::data {
+    class LevelTemplate;
+    struct ReplayData;
+}
+
+namespace game::replay {
+    class ReplayRecorder;
+    class ReplayPlayer;
+}
+
 namespace game::factory {
     class EntityFactory;
     class BlueprintManager;
@@ -39,6 +56,8 @@ private:
     std::unique_ptr<engine::system::AnimationSystem> animation_system_;
     std::unique_ptr<engine::system::YSortSystem> ysort_system_;
     std::unique_ptr<engine::system::AudioSystem> audio_system_;
+    std::unique_ptr<engine::system::VisibilitySystem> visibility_system_;
+    std::unique_ptr<engine::system::ChunkStreamSystem> chunk_stream_system_;    // 仅在关卡触发分块加载时创建
 
     std::unique_ptr<game::system::FollowPathSystem> follow_path_system_;
     std::unique_ptr<game::system::RemoveDeadSystem> remove_dead_system_;
@@ -75,12 +94,27 @@ private:
     std::shared_ptr<game::data::SessionData> session_data_;             // 会话数据，关卡切换时需要传递的数据
     std::shared_ptr<game::data::UIConfig> ui_config_;                   // UI配置，负责管理UI数据
     std::shared_ptr<game::data::LevelConfig> level_config_;             // 关卡配置，负责管理关卡数据
+    std::shared_future<std::shared_ptr<engine::loader::PreloadedLevel>> preloaded_level_;  // 上一个场景在后台预加载的关卡数据（可能为空）
+    std::shared_ptr<const game::data::LevelTemplate> level_template_;   // 关卡模板，重新开始时直接复制，无需重新载入
+    std::vector<entt::entity> level_entities_;                          // 从地图文件载入完成时的关卡实体（第一次重新开始时据此生成关卡模板）
+    std::shared_ptr<const game::data::ReplayData> replay_;              // 要回放的录像（为空则正常游戏并录制）
+
+    // --- 随机数与录像 ---
+    engine::utils::Random random_;                                      // 场景随机数流，游戏逻辑中的随机数都来自这里
+    std::unique_ptr<game::replay::ReplayRecorder> replay_recorder_;     // 录像录制器（正常游戏时）
+    std::unique_ptr<game::replay::ReplayPlayer> replay_player_;         // 录像回放器（回放录像时）
 
     // --- 其他场景数据 ---
     int level_number_{1};
     entt::entity selected_unit_{entt::null};        // 游戏中鼠标选中的单位
     entt::entity hovered_unit_{entt::null};         // 游戏中鼠标悬浮的单位
     bool show_save_panel_{false};                   // 是否显示保存面板
+
+    // --- 检查点（战斗快照，见 BattleSnapshot） ---
+    static constexpr size_t MAX_CHECKPOINT_HISTORY{16};   // 最多保留的历史检查点数量
+    std::string checkpoint_;                        // 最近的检查点（完整快照）
+    std::vector<std::string> checkpoint_history_;   // 更早的检查点，每一个都是相对于其后一个检查点的增量快照
+    bool pending_checkpoint_load_{false};           // 下一帧开始时读取 checkpoint_（不能在事件分发过程中销毁实体）
     
 public:
     /**
@@ -90,12 +124,18 @@ public:
      * @param session_data 场景间传递的关卡数据
      * @param ui_config UI配置
      * @param level_config 关卡配置
+     * @param preloaded_level 后台预加载的关卡数据（见 LevelPreloader），预加载完成前场景不会被切换进来
+     * @param level_template 关卡模板（重新开始关卡时传入），有模板时不再载入地图文件
+     * @param replay 要回放的录像（会话数据需由调用者按录像创建并传入），为空则正常游戏并录制录像
      */
     GameScene(engine::core::Context& context,
         std::shared_ptr<game::factory::BlueprintManager> blueprint_manager = nullptr,
         std::shared_ptr<game::data::SessionData> session_data = nullptr,
         std::shared_ptr<game::data::UIConfig> ui_config = nullptr,
-        std::shared_ptr<game::data::LevelConfig> level_config = nullptr
+        std::shared_ptr<game::data::LevelConfig> level_config = nullptr,
+        std::shared_future<std::shared_ptr<engine::loader::PreloadedLevel>> preloaded_level = {},
+        std::shared_ptr<const game::data::LevelTemplate> level_template = nullptr,
+        std::shared_ptr<const game::data::ReplayData> replay = nullptr
         );
 
     ~GameScene();
@@ -104,6 +144,7 @@ public:
     void update(float delta_time) override;
     void render() override;
     void clean() override;
+    bool isReady() const override;
 
 private:
     [[nodiscard]] bool initSessionData();
@@ -117,13 +158,19 @@ private:
     [[nodiscard]] bool initSystems();
     [[nodiscard]] bool initEnemySpawner();
     [[nodiscard]] bool initUnitsPortraitUI();
+    [[nodiscard]] bool initReplay();
 
     // 场景相关函数
     void onRestart();
+    void captureLevelTemplate();        ///< @brief 还没有当前关卡的模板时，用载入时记录的关卡实体生成模板
     void onBackToTitle();
     void onSave();
     void onLevelClear();
     void onGameEndEvent(const game::defs::GameEndEvent& event);
+    void onSaveCheckpoint();
+    void onLoadCheckpoint();
+    void onRewindCheckpoint();
+    void restoreCheckpoint();       ///< @brief 用 checkpoint_ 恢复战斗实体和场景状态
 
 };
 
@@ -10,6 +10,8 @@
 #include "engine/utils/events.h"
 #include "engine/loader/level_loader.h"
 #include "engine/loader/basic_entity_builder.h"
+#include "engine/loader/level_preloader.h"
+#include "engine/resource/resource_manager.h"
 #include "game/system/debug_ui_system.h"
 #include <spdlog/spdlog.h>
 #include <entt/entity/registry.hpp>
@@ -32,6 +34,7 @@ LevelClearScene::LevelClearScene(engine::core::Context& context,
     game_stats_(game_stats) {
         // 直接在构造函数中初始化DebugUI系统
         debug_ui_system_ = std::make_unique<game::system::DebugUISystem>(registry_, context);
+        level_preloader_ = std::make_unique<engine::loader::LevelPreloader>();
     }
 
 LevelClearScene::~LevelClearScene() = default;
@@ -47,6 +50,11 @@ bool LevelClearScene::init() {
     registry_.ctx().emplace<std::shared_ptr<game::factory::BlueprintManager>>(blueprint_manager_);
     registry_.ctx().emplace<std::shared_ptr<game::data::UIConfig>>(ui_config_);
     context_.getAudioPlayer().playMusic("win"_hs, 0);
+
+    // 玩家查看结算界面的同时，在后台预加载下一关
+    if (const int next_level = session_data_->getLevelNumber() + 1; next_level <= level_config_->getLevelCount()) {
+        level_preloader_->preload(level_config_->getMapPath(next_level), context_.getResourceManager().getArchive());
+    }
     return engine::scene::Scene::init();
 }
 
@@ -63,7 +71,8 @@ void LevelClearScene::onNextLevelClick() {
         blueprint_manager_,
         session_data_,
         ui_config_, 
-        level_config_)
+        level_config_,
+        level_preloader_->getFuture())
     );
 }
 
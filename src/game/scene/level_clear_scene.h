@@ -7,6 +7,10 @@
 #include "game/factory/blueprint_manager.h"
 #include "game/system/fwd.h"
 
+namespace engine::loader {
+    class LevelPreloader;
+}
+
 namespace game::scene {
 
 class LevelClearScene : public engine::scene::Scene {
@@ -22,6 +26,7 @@ class LevelClearScene : public engine::scene::Scene {
 
     // 目前只需要DebugUI系统
     std::unique_ptr<game::system::DebugUISystem> debug_ui_system_;
+    std::unique_ptr<engine::loader::LevelPreloader> level_preloader_;   ///< @brief 在结算界面停留期间后台预加载下一关
 
     bool show_save_panel_{false};       ///< @brief 是否显示保存面板
 
@@ -0,0 +1,185 @@
+#include "stream_bench_scene.h"
+#include "engine/core/context.h"
+#include "engine/core/frame_arena.h"
+#include "engine/debug/process_memory.h"
+#include "engine/loader/tile_chunk_map.h"
+#include "engine/render/camera.h"
+#include "engine/system/chunk_stream_system.h"
+#include "engine/system/visibility_system.h"
+#include "engine/utils/math.h"
+#include <glm/common.hpp>
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+
+namespace game::scene {
+
+namespace {
+
+constexpr std::uint32_t GROUND_GID_COUNT{4};        ///< @brief 地面层使用的瓦片种类数
+constexpr std::uint32_t DECORATION_GID{GROUND_GID_COUNT + 1};
+
+/// @brief 生成合成地图：一层铺满的地面和一层稀疏的装饰（瓦片种类按坐标变化，避免所有瓦片完全相同）
+std::unique_ptr<engine::loader::TileChunkMap> buildSyntheticMap(int map_size, int tile_size) {
+    auto chunk_map = std::make_unique<engine::loader::TileChunkMap>(glm::ivec2(map_size), glm::ivec2(tile_size));
+    const auto tile_count = static_cast<size_t>(map_size) * static_cast<size_t>(map_size);
+    std::vector<std::uint32_t> ground(tile_count), decoration(tile_count, 0);
+    for (int y = 0; y < map_size; ++y) {
+        for (int x = 0; x < map_size; ++x) {
+            const auto index = static_cast<size_t>(y) * map_size + x;
+            ground[index] = 1 + static_cast<std::uint32_t>(x * 7 + y * 13) % GROUND_GID_COUNT;
+            if ((x * 31 + y * 17) % 11 == 0) decoration[index] = DECORATION_GID;
+        }
+    }
+    chunk_map->addLayer(engine::loader::TileChunkLayer{"ground", 0, std::move(ground)});
+    chunk_map->addLayer(engine::loader::TileChunkLayer{"decoration", 1, std::move(decoration)});
+
+    const glm::vec2 size(static_cast<float>(tile_size));
+    for (std::uint32_t gid = 1; gid <= DECORATION_GID; ++gid) {
+        const engine::utils::Rect source_rect{glm::vec2(static_cast<float>(gid - 1) * size.x, 0.0f), size};
+        chunk_map->addTileInfo(gid, engine::component::TileInfo(
+            engine::component::Sprite("assets/textures/Terrain/Tilemap.png", source_rect),
+            engine::component::TileType::NORMAL));
+    }
+    return chunk_map;
+}
+
+/// @brief 已排序数据的分位数
+float percentile(const std::vector<float>& sorted, double p) {
+    if (sorted.empty()) return 0.0f;
+    return sorted[static_cast<size_t>(p * (sorted.size() - 1))];
+}
+
+}   // namespace
+
+StreamBenchScene::StreamBenchScene(engine::core::Context& context, int map_size, std::string output_prefix)
+    : engine::scene::Scene("StreamBenchScene", context),
+      map_size_(map_size),
+      output_prefix_(std::move(output_prefix)) {
+}
+
+StreamBenchScene::~StreamBenchScene() = default;
+
+bool StreamBenchScene::init() {
+    if (map_size_ <= 0) {
+        spdlog::error("流式加载基准测试的地图尺寸无效: {}", map_size_);
+        return false;
+    }
+    const auto world_size = glm::vec2(static_cast<float>(map_size_ * TILE_SIZE));
+    const auto viewport_size = context_.getCamera().getViewportSize();
+    if (viewport_size.x > world_size.x || viewport_size.y > world_size.y) {
+        spdlog::error("地图 {0}x{0} 小于视口，无法平移相机", map_size_);
+        return false;
+    }
+
+    camera_ = std::make_unique<engine::render::Camera>(viewport_size);
+    chunk_stream_system_ = std::make_unique<engine::system::ChunkStreamSystem>(registry_,
+                                                                               buildSyntheticMap(map_size_, TILE_SIZE),
+                                                                               context_.getFrameArena());
+    visibility_system_ = std::make_unique<engine::system::VisibilitySystem>(registry_);
+    visibility_system_->setWorldBounds(engine::utils::Rect{glm::vec2(0.0f), world_size});
+
+    chunk_stream_system_->preload(*camera_);
+    visibility_system_->update(*camera_);
+    start_rss_bytes_ = peak_rss_bytes_ = engine::debug::getResidentMemoryBytes();
+    spdlog::info("开始流式加载基准测试：地图 {0}x{0} 瓦片，视口 {1}x{2}，每帧平移 {3} 像素",
+                 map_size_, viewport_size.x, viewport_size.y, PAN_SPEED);
+    return Scene::init();
+}
+
+void StreamBenchScene::update(float) {
+    if (is_finished_) return;
+    if (!advanceCamera()) {
+        is_finished_ = true;
+        finish();
+        quit();
+        return;
+    }
+
+    // 只计量流式加载与可见性计算（即相机移动带来的开销），与渲染无关
+    const auto start = std::chrono::steady_clock::now();
+    chunk_stream_system_->update(*camera_);
+    visibility_system_->update(*camera_);
+    const std::chrono::duration<float, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    frame_ms_.push_back(elapsed.count());
+
+    peak_resident_tiles_ = std::max(peak_resident_tiles_, chunk_stream_system_->getResidentTileCount());
+    peak_resident_chunks_ = std::max(peak_resident_chunks_, chunk_stream_system_->getResidentChunkCount());
+    peak_indexed_ = std::max(peak_indexed_, visibility_system_->getIndexedCount());
+    peak_rss_bytes_ = std::max(peak_rss_bytes_, engine::debug::getResidentMemoryBytes());
+}
+
+bool StreamBenchScene::advanceCamera() {
+    // 蛇形路线：水平扫过一行，到达边缘后向下移动一个视口高度，再反向扫过下一行
+    const auto max_position = glm::vec2(static_cast<float>(map_size_ * TILE_SIZE)) - camera_->getViewportSize();
+    auto position = camera_->getPosition();
+    if (direction_.y == 0.0f) {
+        const bool at_edge = direction_.x > 0.0f ? position.x >= max_position.x : position.x <= 0.0f;
+        if (at_edge) {
+            if (position.y >= max_position.y) return false;     // 最后一行已扫描完
+            next_row_y_ = std::min(position.y + camera_->getViewportSize().y, max_position.y);
+            direction_ = glm::vec2(0.0f, 1.0f);
+        }
+    } else if (position.y >= next_row_y_) {
+        direction_ = glm::vec2(position.x <= 0.0f ? 1.0f : -1.0f, 0.0f);
+    }
+
+    position += direction_ * PAN_SPEED;
+    position = glm::clamp(position, glm::vec2(0.0f), max_position);
+    if (direction_.y != 0.0f) position.y = std::min(position.y, next_row_y_);
+    camera_->setPosition(position);
+    return true;
+}
+
+void StreamBenchScene::finish() {
+    auto sorted = frame_ms_;
+    std::sort(sorted.begin(), sorted.end());
+    double sum = 0.0;
+    for (auto ms : sorted) sum += ms;
+    const auto average = sorted.empty() ? 0.0 : sum / sorted.size();
+
+    spdlog::info("流式加载基准测试完成：{} 帧，更新耗时 平均 {:.3f} ms，中位数 {:.3f} ms，99% {:.3f} ms，最大 {:.3f} ms",
+                 sorted.size(), average, percentile(sorted, 0.50), percentile(sorted, 0.99), sorted.empty() ? 0.0f : sorted.back());
+    spdlog::info("最大常驻区块 {}，最大常驻瓦片 {}，最大索引实体 {}，常驻内存 {:.1f} MB -> 峰值 {:.1f} MB",
+                 peak_resident_chunks_, peak_resident_tiles_, peak_indexed_,
+                 start_rss_bytes_ / (1024.0 * 1024.0), peak_rss_bytes_ / (1024.0 * 1024.0));
+    if (!writeJson(output_prefix_ + ".json", sorted)) {
+        spdlog::error("写出流式加载基准测试报告失败");
+    }
+}
+
+bool StreamBenchScene::writeJson(const std::string& path, const std::vector<float>& sorted) const {
+    double sum = 0.0;
+    for (auto ms : sorted) sum += ms;
+
+    nlohmann::json json;
+    json["map_size"] = map_size_;
+    json["tile_size"] = TILE_SIZE;
+    json["pan_speed"] = PAN_SPEED;
+    json["frames"] = sorted.size();
+    json["frame_ms"] = {
+        {"average", sorted.empty() ? 0.0 : sum / sorted.size()},
+        {"p50", percentile(sorted, 0.50)},
+        {"p99", percentile(sorted, 0.99)},
+        {"max", sorted.empty() ? 0.0f : sorted.back()},
+    };
+    json["peak_resident_chunks"] = peak_resident_chunks_;
+    json["peak_resident_tiles"] = peak_resident_tiles_;
+    json["peak_indexed"] = peak_indexed_;
+    json["chunk_map_bytes"] = chunk_stream_system_->getChunkMap().getResidentBytes();
+    json["start_rss_bytes"] = start_rss_bytes_;
+    json["peak_rss_bytes"] = peak_rss_bytes_;
+
+    std::ofstream file{path};
+    if (!file.is_open()) {
+        spdlog::error("无法打开流式加载基准测试报告文件: {}", path);
+        return false;
+    }
+    file << json.dump(4);
+    spdlog::info("流式加载基准测试统计已导出到: {}", path);
+    return true;
+}
+
+}   // namespace game::scene
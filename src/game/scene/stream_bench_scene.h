@@ -0,0 +1,67 @@
+#pragma once
+#include "engine/scene/scene.h"
+#include <memory>
+#include <string>
+#include <vector>
+#include <glm/vec2.hpp>
+
+namespace engine::render {
+    class Camera;
+}
+
+namespace engine::system {
+    class ChunkStreamSystem;
+    class VisibilitySystem;
+}
+
+namespace game::scene {
+
+/**
+ * @brief 区块流式加载基准测试场景（命令行参数 --stream-bench，无界面运行）
+ *
+ * 生成一张 map_size x map_size 瓦片的合成地图，相机以蛇形路线平移扫过整张地图，
+ * 每帧记录区块流式加载与可见性计算的耗时、常驻瓦片数量以及进程常驻内存，
+ * 扫描结束后输出统计（平均、中位数、99%分位、最大值）并写出 <output_prefix>.json，然后退出游戏。
+ */
+class StreamBenchScene final: public engine::scene::Scene {
+    int map_size_{256};                                                     ///< @brief 地图边长（瓦片数量）
+    std::string output_prefix_;                                             ///< @brief 报告路径前缀
+    std::unique_ptr<engine::render::Camera> camera_;                        ///< @brief 基准测试使用的相机（不影响全局相机）
+    std::unique_ptr<engine::system::ChunkStreamSystem> chunk_stream_system_;
+    std::unique_ptr<engine::system::VisibilitySystem> visibility_system_;
+
+    glm::vec2 direction_{1.0f, 0.0f};                                       ///< @brief 当前平移方向
+    float next_row_y_{0.0f};                                                ///< @brief 向下移动时的目标行位置
+    bool is_finished_{false};
+
+    // --- 统计数据 ---
+    std::vector<float> frame_ms_;                                           ///< @brief 每帧的更新耗时（毫秒）
+    size_t peak_resident_tiles_{0};                                         ///< @brief 最大常驻瓦片实体数量
+    size_t peak_resident_chunks_{0};                                        ///< @brief 最大常驻区块数量
+    size_t peak_indexed_{0};                                                ///< @brief 空间索引中的最大实体数量
+    size_t start_rss_bytes_{0};                                             ///< @brief 开始扫描时的进程常驻内存
+    size_t peak_rss_bytes_{0};                                              ///< @brief 扫描过程中的最大进程常驻内存
+
+public:
+    static constexpr float PAN_SPEED{16.0f};                                ///< @brief 相机每帧平移的距离（像素）
+    static constexpr int TILE_SIZE{32};                                     ///< @brief 合成地图的瓦片尺寸（像素）
+
+    /**
+     * @brief 构造函数
+     * @param context 上下文
+     * @param map_size 地图边长（瓦片数量）
+     * @param output_prefix 报告路径前缀（输出 <prefix>.json）
+     */
+    StreamBenchScene(engine::core::Context& context, int map_size, std::string output_prefix);
+    ~StreamBenchScene();
+
+    bool init() override;
+    void update(float delta_time) override;
+
+private:
+    bool advanceCamera();                                                   ///< @brief 沿蛇形路线移动相机，扫描完整张地图后返回false
+    void finish();                                                          ///< @brief 输出统计并写出报告
+    bool writeJson(const std::string& path, const std::vector<float>& sorted) const;   ///< @brief 把统计写出为 JSON 文件（sorted 为排序后的帧耗时）
+};
+
+}   // namespace game::scene
@@ -12,8 +12,11 @@
 #include "engine/system/ysort_system.h"
 #include "engine/system/animation_system.h"
 #include "engine/system/movement_system.h"
+#include "engine/system/visibility_system.h"
 #include "engine/loader/level_loader.h"
 #include "engine/loader/basic_entity_builder.h"
+#include "engine/loader/level_preloader.h"
+#include "engine/resource/resource_manager.h"
 #include "game/system/debug_ui_system.h"
 #include <spdlog/spdlog.h>
 #include <entt/entity/registry.hpp>
@@ -45,6 +48,7 @@ bool TitleScene::init() {
     if (!initSystems())             { spdlog::error("初始化系统失败"); return false; }
     if (!initRegistryContext())     { spdlog::error("初始化注册表上下文失败"); return false; }
     if (!initUI())                  { spdlog::error("初始化UI失败"); return false; }
+    preloadLevel();
 
     context_.getGameState().setState(engine::core::State::Title);
     context_.getTime().setTimeScale(1.0f);      // 重置游戏速度
@@ -56,8 +60,8 @@ bool TitleScene::init() {
 
 void TitleScene::update(float delta_time) {
     engine::scene::Scene::update(delta_time);
-    animation_system_->update(delta_time);
     movement_system_->update(registry_, delta_time);
+    animation_system_->update(delta_time);
     ysort_system_->update(registry_);
 }
 
@@ -65,7 +69,8 @@ void TitleScene::render() {
     auto& renderer = context_.getRenderer();
     auto& camera = context_.getCamera();
 
-    render_system_->update(registry_, renderer, camera);
+    visibility_system_->update(camera);     // 可见性在所有逻辑更新之后计算
+    render_system_->update(registry_, renderer, camera, *visibility_system_);
 
     engine::scene::Scene::render();
     debug_ui_system_->updateTitle(*this);
@@ -96,11 +101,7 @@ bool TitleScene::initLevelConfig() {
 bool TitleScene::initBlueprintManager() {
     if (!blueprint_manager_) {
         blueprint_manager_ = std::make_shared<game::factory::BlueprintManager>(context_.getResourceManager());
-        if (!blueprint_manager_->loadEnemyClassBlueprints("assets/data/enemy_data.json") ||
-            !blueprint_manager_->loadPlayerClassBlueprints("assets/data/player_data.json") ||
-            !blueprint_manager_->loadProjectileBlueprints("assets/data/projectile_data.json") ||
-            !blueprint_manager_->loadEffectBlueprints("assets/data/effect_data.json") ||
-            !blueprint_manager_->loadSkillBlueprints("assets/data/skill_data.json")) {
+        if (!blueprint_manager_->loadAllBlueprints()) {
             spdlog::error("加载蓝图失败");
             return false;
         }
@@ -133,10 +134,13 @@ bool TitleScene::initSystems() {
     // 初始化系统
     auto& dispatcher = context_.getDispatcher();
     debug_ui_system_ = std::make_unique<game::system::DebugUISystem>(registry_, context_);
+    level_preloader_ = std::make_unique<engine::loader::LevelPreloader>();
     render_system_ = std::make_unique<engine::system::RenderSystem>();
     ysort_system_ = std::make_unique<engine::system::YSortSystem>();
     animation_system_ = std::make_unique<engine::system::AnimationSystem>(registry_, dispatcher);
     movement_system_ = std::make_unique<engine::system::MovementSystem>();
+    visibility_system_ = std::make_unique<engine::system::VisibilitySystem>(registry_);
+    visibility_system_->update(context_.getCamera());   // 先计算一次可见性，让首帧的动画系统也有可见集合可用
     return true;
 }
 
@@ -156,7 +160,16 @@ bool TitleScene::initUI() {
     return true;
 }
 
+void TitleScene::preloadLevel() {
+    // 如果数据是读档载入的，有可能已经通关，此时将进入下一关
+    const int level_number = session_data_->getLevelNumber() + (session_data_->isLevelClear() ? 1 : 0);
+    if (level_number < 1 || level_number > level_config_->getLevelCount()) return;
+    // 与正在预加载的地图相同时不会重复开始（在标题界面读档后关卡可能改变）
+    level_preloader_->preload(level_config_->getMapPath(level_number), context_.getResourceManager().getArchive());
+}
+
 void TitleScene::onStartGameClick() {
+    preloadLevel();
     // 如果数据是读档载入的，有可能已经通关，此时需要进入下一关
     if (session_data_->isLevelClear()) {
         session_data_->setLevelClear(false);
@@ -167,7 +180,8 @@ void TitleScene::onStartGameClick() {
         blueprint_manager_,
         session_data_,
         ui_config_, 
-        level_config_
+        level_config_,
+        level_preloader_->getFuture()
         )
     );
 }
@@ -7,6 +7,10 @@
 #include "game/factory/blueprint_manager.h"
 #include "game/system/fwd.h"
 
+namespace engine::loader {
+    class LevelPreloader;
+}
+
 namespace game::scene {
 
 class TitleScene final: public engine::scene::Scene {
@@ -23,7 +27,9 @@ class TitleScene final: public engine::scene::Scene {
     std::unique_ptr<engine::system::YSortSystem> ysort_system_;
     std::unique_ptr<engine::system::AnimationSystem> animation_system_;
     std::unique_ptr<engine::system::MovementSystem> movement_system_;
+    std::unique_ptr<engine::system::VisibilitySystem> visibility_system_;
     std::unique_ptr<game::system::DebugUISystem> debug_ui_system_;
+    std::unique_ptr<engine::loader::LevelPreloader> level_preloader_;   ///< @brief 在标题界面停留期间后台预加载将要进入的关卡
 
     bool show_unit_info_{false};        ///< @brief 是否显示角色列表UI
     bool show_load_panel_{false};       ///< @brief 是否显示加载面板UI
@@ -50,6 +56,7 @@ private:
     [[nodiscard]] bool initSystems();
     [[nodiscard]] bool initRegistryContext();
     [[nodiscard]] bool initUI();
+    void preloadLevel();    ///< @brief 后台预加载“开始游戏”将进入的关卡
 
     // 按钮回调函数 (未来通过游戏UI调用)
     void onStartGameClick();
@@ -0,0 +1,163 @@
+#include "balance_runner.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+
+namespace game::simulation {
+
+BalanceRunner::BalanceRunner(std::shared_ptr<game::factory::BlueprintManager> blueprint_manager,
+                             std::shared_ptr<game::data::LevelConfig> level_config,
+                             std::vector<SimulationUnit> roster,
+                             std::vector<SimulationLevel> levels)
+    : blueprint_manager_(std::move(blueprint_manager)),
+      level_config_(std::move(level_config)),
+      roster_(std::move(roster)),
+      levels_(std::move(levels)) {
+}
+
+const std::vector<SimulationResult>& BalanceRunner::run(const BalanceConfig& config) {
+    config_ = config;
+    const auto runs = static_cast<size_t>(std::max(config_.runs_, 0));
+    const auto policy_count = config_.policies_.size();
+    const auto task_count = levels_.size() * policy_count * runs;
+    results_.assign(task_count, SimulationResult{});
+
+    const auto hardware_threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    thread_count_ = config_.threads_ > 0 ? config_.threads_ : hardware_threads;
+    thread_count_ = static_cast<int>(std::min<size_t>(thread_count_, std::max<size_t>(task_count, 1)));
+
+    // 任务序号 = (关卡, 策略, 次数) 的展开；每个线程循环领取下一个任务，直到全部领完
+    std::atomic<size_t> next_task{0};
+    const auto worker = [&, runs, policy_count, task_count]() {
+        for (auto task = next_task.fetch_add(1, std::memory_order_relaxed); task < task_count;
+             task = next_task.fetch_add(1, std::memory_order_relaxed)) {
+            const auto& level = levels_[task / (policy_count * runs)];
+            const auto policy = config_.policies_[(task / runs) % policy_count];
+            const auto seed = config_.seed_ + task;
+            auto& result = results_[task];
+            try {
+                BattleSimulation simulation(level, blueprint_manager_, level_config_, roster_, policy, seed);
+                result = simulation.run(config_.max_game_time_);
+            } catch (const std::exception& e) {
+                spdlog::error("平衡性模拟失败（关卡 {}，策略 {}，种子 {}）: {}", level.level_number_, toString(policy), seed, e.what());
+                result.level_number_ = level.level_number_;
+                result.policy_ = policy;
+                result.seed_ = seed;
+                result.outcome_ = SimulationOutcome::ABORTED;
+            }
+        }
+    };
+
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    threads.reserve(thread_count_ - 1);
+    for (int i = 1; i < thread_count_; ++i) {
+        threads.emplace_back(worker);
+    }
+    worker();   // 当前线程也参与模拟
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    elapsed_ms_ = elapsed.count();
+    return results_;
+}
+
+bool BalanceRunner::writeReport(std::string_view prefix) const {
+    const std::string base{prefix};
+    const bool csv_ok = writeCsv(base + ".csv");
+    const bool json_ok = writeJson(base + ".json");
+    return csv_ok && json_ok;
+}
+
+bool BalanceRunner::writeCsv(std::string_view path) const {
+    std::ofstream file{std::string(path)};
+    if (!file.is_open()) {
+        spdlog::error("无法打开平衡性报告文件: {}", path);
+        return false;
+    }
+    file << "level,policy,seed,outcome,enemy_killed,enemy_arrived,home_hp,units_placed,end_time,peak_entities\n";
+    for (const auto& result : results_) {
+        file << result.level_number_ << ',' << toString(result.policy_) << ',' << result.seed_ << ','
+             << toString(result.outcome_) << ',' << result.enemy_killed_count_ << ',' << result.enemy_arrived_count_ << ','
+             << result.home_hp_ << ',' << result.units_placed_ << ',' << result.end_time_ << ','
+             << result.peak_entities_ << '\n';
+    }
+    spdlog::info("平衡性模拟结果已导出到: {}", path);
+    return true;
+}
+
+bool BalanceRunner::writeJson(std::string_view path) const {
+    nlohmann::json json;
+    json["runs"] = config_.runs_;
+    json["threads"] = thread_count_;
+    json["seed"] = config_.seed_;
+    json["max_game_time"] = config_.max_game_time_;
+    json["elapsed_ms"] = elapsed_ms_;
+    json["simulations_per_second"] = elapsed_ms_ > 0.0 ? results_.size() * 1000.0 / elapsed_ms_ : 0.0;
+
+    // 按关卡和策略汇总（结果按任务序号排列，同一关卡、同一策略的结果是连续的）
+    auto& summary = json["summary"] = nlohmann::json::array();
+    const auto runs = static_cast<size_t>(std::max(config_.runs_, 0));
+    for (size_t begin = 0; runs > 0 && begin < results_.size(); begin += runs) {
+        const auto end = std::min(begin + runs, results_.size());
+        int wins = 0, loses = 0, timeouts = 0, aborted = 0;
+        double killed = 0.0, arrived = 0.0, home_hp = 0.0, clear_time = 0.0, peak_entities = 0.0;
+        float min_clear_time = 0.0f, max_clear_time = 0.0f;
+        size_t max_peak_entities = 0;
+        for (auto i = begin; i < end; ++i) {
+            const auto& result = results_[i];
+            switch (result.outcome_) {
+                case SimulationOutcome::WIN:
+                    if (wins == 0 || result.end_time_ < min_clear_time) min_clear_time = result.end_time_;
+                    if (wins == 0 || result.end_time_ > max_clear_time) max_clear_time = result.end_time_;
+                    clear_time += result.end_time_;
+                    ++wins;
+                    break;
+                case SimulationOutcome::LOSE: ++loses; break;
+                case SimulationOutcome::TIMEOUT: ++timeouts; break;
+                case SimulationOutcome::ABORTED: ++aborted; continue;   // 出错的模拟不计入平均值
+            }
+            killed += result.enemy_killed_count_;
+            arrived += result.enemy_arrived_count_;
+            home_hp += result.home_hp_;
+            peak_entities += result.peak_entities_;
+            max_peak_entities = std::max(max_peak_entities, result.peak_entities_);
+        }
+        const auto count = static_cast<double>(end - begin);
+        const auto valid = std::max(1.0, count - aborted);
+        summary.push_back({
+            {"level", results_[begin].level_number_},
+            {"policy", toString(results_[begin].policy_)},
+            {"runs", end - begin},
+            {"win_rate", wins / count},
+            {"lose_rate", loses / count},
+            {"timeout_rate", timeouts / count},
+            {"aborted", aborted},
+            {"avg_enemy_killed", killed / valid},
+            {"avg_enemy_arrived", arrived / valid},
+            {"avg_home_hp", home_hp / valid},
+            {"avg_clear_time", wins > 0 ? clear_time / wins : 0.0},
+            {"min_clear_time", min_clear_time},
+            {"max_clear_time", max_clear_time},
+            {"avg_peak_entities", peak_entities / valid},
+            {"max_peak_entities", max_peak_entities},
+        });
+    }
+
+    std::ofstream file{std::string(path)};
+    if (!file.is_open()) {
+        spdlog::error("无法打开平衡性报告文件: {}", path);
+        return false;
+    }
+    file << json.dump(4);
+    spdlog::info("平衡性统计已导出到: {}", path);
+    return true;
+}
+
+} // namespace game::simulation
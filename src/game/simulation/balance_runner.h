@@ -0,0 +1,72 @@
+#pragma once
+#include "game/simulation/battle_simulation.h"
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace game::simulation {
+
+/**
+ * @brief 批量模拟的参数
+ */
+struct BalanceConfig {
+    int runs_{100};                     ///< @brief 每个关卡、每种放置策略的模拟次数
+    int threads_{0};                    ///< @brief 线程数（0 = 硬件线程数）
+    std::uint64_t seed_{1};             ///< @brief 基础种子，第 i 次模拟使用 seed_ + i
+    float max_game_time_{900.0f};       ///< @brief 每次模拟的最长游戏时间（秒）
+    std::vector<PlacementPolicy> policies_{PlacementPolicy::RANDOM,
+                                           PlacementPolicy::CHEAPEST_FIRST,
+                                           PlacementPolicy::EXPENSIVE_FIRST};   ///< @brief 参与模拟的放置策略
+};
+
+/**
+ * @brief 蒙特卡洛平衡性测试：在多个线程中并行运行大量 BattleSimulation，并输出统计报告
+ *
+ * 所有模拟任务（关卡 × 策略 × 次数）按序号编排，工作线程用一个原子计数器领取任务，
+ * 每个任务在自己的线程内创建、运行并销毁一个 BattleSimulation，结果写入预先分配好的数组中对应的位置，
+ * 线程之间除任务计数器外没有共享的可变状态。种子只由任务序号决定，因此结果与线程数无关。
+ */
+class BalanceRunner final {
+    std::shared_ptr<game::factory::BlueprintManager> blueprint_manager_;
+    std::shared_ptr<game::data::LevelConfig> level_config_;
+    std::vector<SimulationUnit> roster_;
+    std::vector<SimulationLevel> levels_;
+
+    BalanceConfig config_;                      ///< @brief 最近一次 run() 的参数
+    std::vector<SimulationResult> results_;     ///< @brief 最近一次 run() 的结果（按任务序号排列）
+    double elapsed_ms_{0.0};                    ///< @brief 最近一次 run() 的耗时
+    int thread_count_{0};                       ///< @brief 最近一次 run() 使用的线程数
+
+public:
+    /**
+     * @brief 构造函数（所有参数在模拟期间只读共享）
+     * @param blueprint_manager 蓝图管理器
+     * @param level_config 关卡配置
+     * @param roster 可供放置的单位
+     * @param levels 要模拟的关卡
+     */
+    BalanceRunner(std::shared_ptr<game::factory::BlueprintManager> blueprint_manager,
+                  std::shared_ptr<game::data::LevelConfig> level_config,
+                  std::vector<SimulationUnit> roster,
+                  std::vector<SimulationLevel> levels);
+
+    /// @brief 运行所有模拟（阻塞直到全部完成，当前线程也参与模拟）
+    const std::vector<SimulationResult>& run(const BalanceConfig& config);
+
+    /**
+     * @brief 写出报告：<prefix>.csv 为每次模拟的结果，<prefix>.json 为按关卡和策略汇总的统计
+     * @param prefix 输出路径前缀
+     * @return 是否成功
+     */
+    bool writeReport(std::string_view prefix) const;
+
+    double getElapsedMs() const { return elapsed_ms_; }
+    int getThreadCount() const { return thread_count_; }
+
+private:
+    bool writeCsv(std::string_view path) const;
+    bool writeJson(std::string_view path) const;
+};
+
+} // namespace game::simulation
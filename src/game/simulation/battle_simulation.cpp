@@ -0,0 +1,276 @@
+#include "battle_simulation.h"
+#include "game/data/level_template.h"
+#include "game/data/level_config.h"
+#include "game/defs/tags.h"
+#include "game/component/place_occupied_component.h"
+#include "game/factory/entity_factory.h"
+#include "game/factory/blueprint_manager.h"
+#include "game/spawner/enemy_spawner.h"
+#include "game/system/followpath_system.h"
+#include "game/system/remove_dead_system.h"
+#include "game/system/block_system.h"
+#include "game/system/set_target_system.h"
+#include "game/system/attack_starter_system.h"
+#include "game/system/timer_system.h"
+#include "game/system/orientation_system.h"
+#include "game/system/animation_state_system.h"
+#include "game/system/animation_event_system.h"
+#include "game/system/combat_resolve_system.h"
+#include "game/system/projectile_system.h"
+#include "game/system/effect_system.h"
+#include "game/system/game_rule_system.h"
+#include "game/system/skill_system.h"
+#include "engine/loader/tile_chunk_map.h"
+#include "engine/system/movement_system.h"
+#include "engine/system/animation_system.h"
+#include "engine/component/transform_component.h"
+#include "engine/component/sprite_component.h"
+#include "engine/component/name_component.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace game::simulation {
+
+namespace {
+
+/// @brief 收集带有指定标签的空闲放置地点
+template<typename PlaceTag>
+void appendFreePlaces(entt::registry& registry, std::vector<entt::entity>& places) {
+    auto view = registry.view<PlaceTag,
+        engine::component::TransformComponent,
+        engine::component::SpriteComponent>(entt::exclude<game::component::PlaceOccupiedComponent>);
+    for (auto entity : view) {
+        places.push_back(entity);
+    }
+}
+
+} // namespace
+
+std::string_view toString(PlacementPolicy policy) {
+    switch (policy) {
+        case PlacementPolicy::RANDOM: return "random";
+        case PlacementPolicy::CHEAPEST_FIRST: return "cheapest_first";
+        case PlacementPolicy::EXPENSIVE_FIRST: return "expensive_first";
+    }
+    return "unknown";
+}
+
+std::string_view toString(SimulationOutcome outcome) {
+    switch (outcome) {
+        case SimulationOutcome::WIN: return "win";
+        case SimulationOutcome::LOSE: return "lose";
+        case SimulationOutcome::TIMEOUT: return "timeout";
+        case SimulationOutcome::ABORTED: return "aborted";
+    }
+    return "unknown";
+}
+
+BattleSimulation::BattleSimulation(const SimulationLevel& level,
+                                   std::shared_ptr<game::factory::BlueprintManager> blueprint_manager,
+                                   std::shared_ptr<game::data::LevelConfig> level_config,
+                                   std::vector<SimulationUnit> roster,
+                                   PlacementPolicy policy,
+                                   std::uint64_t seed)
+    : random_(seed),
+      blueprint_manager_(std::move(blueprint_manager)),
+      level_config_(std::move(level_config)),
+      policy_(policy),
+      roster_(std::move(roster)),
+      waves_(level.waves_),
+      level_number_(level.level_number_) {
+    if (!level.level_template_ || !blueprint_manager_ || !level_config_) {
+        throw std::runtime_error("战斗模拟: 关卡模板、蓝图管理器或关卡配置为空");
+    }
+    result_.level_number_ = level_number_;
+    result_.policy_ = policy_;
+    result_.seed_ = seed;
+    game_stats_.enemy_count_ = level.enemy_count_;
+
+    // 1. 用关卡模板生成关卡（模板不含瓦片层，模拟不需要它们）
+    level.level_template_->instantiate(registry_, waypoint_nodes_, start_points_);
+
+    // 2. 按策略排列待放置的单位（同费用时保持原顺序，保证结果可复现）
+    if (policy_ == PlacementPolicy::CHEAPEST_FIRST) {
+        std::stable_sort(roster_.begin(), roster_.end(), [](const auto& a, const auto& b) { return a.cost_ < b.cost_; });
+    } else if (policy_ == PlacementPolicy::EXPENSIVE_FIRST) {
+        std::stable_sort(roster_.begin(), roster_.end(), [](const auto& a, const auto& b) { return a.cost_ > b.cost_; });
+    }
+
+    // 3. 注册表上下文（与 GameScene::initRegistryContext 中逻辑系统用到的部分一致）
+    registry_.ctx().emplace<std::shared_ptr<game::factory::BlueprintManager>>(blueprint_manager_);
+    registry_.ctx().emplace<std::shared_ptr<game::data::LevelConfig>>(level_config_);
+    registry_.ctx().emplace<std::unordered_map<int, game::data::WaypointNode>&>(waypoint_nodes_);
+    registry_.ctx().emplace<std::vector<int>&>(start_points_);
+    registry_.ctx().emplace<game::data::GameStats&>(game_stats_);
+    registry_.ctx().emplace<game::data::Waves&>(waves_);
+    registry_.ctx().emplace<int&>(level_number_);
+    registry_.ctx().emplace<engine::utils::Random&>(random_);
+
+    // 4. 逻辑系统（渲染、UI、音频和输入相关的系统不参与模拟）
+    entity_factory_ = std::make_unique<game::factory::EntityFactory>(registry_, *blueprint_manager_);
+    movement_system_ = std::make_unique<engine::system::MovementSystem>();
+    animation_system_ = std::make_unique<engine::system::AnimationSystem>(registry_, dispatcher_);
+    follow_path_system_ = std::make_unique<game::system::FollowPathSystem>();
+    remove_dead_system_ = std::make_unique<game::system::RemoveDeadSystem>();
+    block_system_ = std::make_unique<game::system::BlockSystem>();
+    set_target_system_ = std::make_unique<game::system::SetTargetSystem>();
+    attack_starter_system_ = std::make_unique<game::system::AttackStarterSystem>();
+    timer_system_ = std::make_unique<game::system::TimerSystem>(registry_, dispatcher_);
+    orientation_system_ = std::make_unique<game::system::OrientationSystem>();
+    animation_state_system_ = std::make_unique<game::system::AnimationStateSystem>(registry_, dispatcher_);
+    animation_event_system_ = std::make_unique<game::system::AnimationEventSystem>(registry_, dispatcher_);
+    combat_resolve_system_ = std::make_unique<game::system::CombatResolveSystem>(registry_, dispatcher_);
+    projectile_system_ = std::make_unique<game::system::ProjectileSystem>(registry_, dispatcher_, *entity_factory_);
+    effect_system_ = std::make_unique<game::system::EffectSystem>(registry_, dispatcher_, *entity_factory_);
+    game_rule_system_ = std::make_unique<game::system::GameRuleSystem>(registry_, dispatcher_);
+    skill_system_ = std::make_unique<game::system::SkillSystem>(registry_, dispatcher_, *entity_factory_);
+    enemy_spawner_ = std::make_unique<game::spawner::EnemySpawner>(registry_, *entity_factory_);
+
+    // 5. 代替 PlaceUnitSystem（移除单位）和场景（关卡结束）响应的事件
+    dispatcher_.sink<game::defs::RemovePlayerUnitEvent>().connect<&BattleSimulation::onRemovePlayerUnitEvent>(this);
+    dispatcher_.sink<game::defs::SkillReadyEvent>().connect<&BattleSimulation::onSkillReadyEvent>(this);
+    dispatcher_.sink<game::defs::LevelClearDelayedEvent>().connect<&BattleSimulation::onLevelClearDelayedEvent>(this);
+    dispatcher_.sink<game::defs::GameEndEvent>().connect<&BattleSimulation::onGameEndEvent>(this);
+}
+
+BattleSimulation::~BattleSimulation() = default;
+
+SimulationResult BattleSimulation::run(float max_game_time) {
+    while (!is_finished_) {
+        if (game_time_ >= max_game_time) {
+            finish(SimulationOutcome::TIMEOUT);
+            break;
+        }
+        step(TIME_STEP);
+    }
+    return result_;
+}
+
+void BattleSimulation::step(float delta_time) {
+    game_time_ += delta_time;
+
+    // 系统顺序与 GameScene::update 一致（去掉了渲染、UI和输入相关的系统）
+    remove_dead_system_->update(registry_);
+    timer_system_->update(delta_time);
+    game_rule_system_->update(delta_time);
+    block_system_->update(registry_, dispatcher_);
+    set_target_system_->update(registry_);
+    follow_path_system_->update(registry_, dispatcher_, waypoint_nodes_);
+    orientation_system_->update(registry_);
+    attack_starter_system_->update(registry_, dispatcher_);
+    projectile_system_->update(delta_time);
+    movement_system_->update(registry_, delta_time);
+    animation_system_->update(delta_time);     // 没有 VisibleTag，只推进动画计时并发送动画事件
+    enemy_spawner_->update(delta_time);
+
+    decision_timer_ -= delta_time;
+    if (decision_timer_ <= 0.0f) {
+        decision_timer_ += DECISION_INTERVAL;
+        applyPolicy();
+    }
+
+    // 相当于 GameApp 每帧末尾的事件分发
+    dispatcher_.update();
+    result_.peak_entities_ = std::max<std::size_t>(result_.peak_entities_, registry_.storage<entt::entity>().free_list());
+}
+
+void BattleSimulation::applyPolicy() {
+    // 每次决策最多放置一个单位
+    auto index = roster_.size();
+    if (policy_ == PlacementPolicy::RANDOM) {
+        // 在买得起且有空闲地点的单位中随机选择
+        int candidates = 0;
+        for (const auto& unit : roster_) {
+            if (unit.cost_ <= game_stats_.cost_ && collectFreePlaces(unit.type_)) ++candidates;
+        }
+        if (candidates == 0) return;
+        auto pick = random_.randomInt(0, candidates - 1);
+        for (size_t i = 0; i < roster_.size(); ++i) {
+            if (roster_[i].cost_ <= game_stats_.cost_ && collectFreePlaces(roster_[i].type_) && pick-- == 0) {
+                index = i;
+                break;
+            }
+        }
+    } else {
+        // 按顺序选择第一个有空闲地点的单位，买不起就等待（攒cost）
+        for (size_t i = 0; i < roster_.size(); ++i) {
+            if (!collectFreePlaces(roster_[i].type_)) continue;
+            if (roster_[i].cost_ > game_stats_.cost_) return;
+            index = i;
+            break;
+        }
+    }
+    if (index < roster_.size() && placeUnit(roster_[index])) {
+        roster_.erase(roster_.begin() + static_cast<std::ptrdiff_t>(index));
+        ++result_.units_placed_;
+    }
+}
+
+bool BattleSimulation::collectFreePlaces(game::defs::PlayerType type) {
+    free_places_.clear();
+    if (type == game::defs::PlayerType::MELEE) {
+        appendFreePlaces<game::defs::MeleePlaceTag>(registry_, free_places_);
+    } else if (type == game::defs::PlayerType::RANGED) {
+        appendFreePlaces<game::defs::RangedPlaceTag>(registry_, free_places_);
+    }
+    return !free_places_.empty();
+}
+
+bool BattleSimulation::placeUnit(const SimulationUnit& unit) {
+    if (!collectFreePlaces(unit.type_)) return false;
+    const auto place = free_places_[random_.randomInt(0, static_cast<int>(free_places_.size()) - 1)];
+
+    // 与 PlaceUnitSystem::onPlaceUnit 相同的放置流程（不含渲染图层修正、UI和音效）
+    const auto& transform = registry_.get<engine::component::TransformComponent>(place);
+    const auto& sprite = registry_.get<engine::component::SpriteComponent>(place);
+    const auto position = transform.position_ + sprite.size_ * transform.scale_ / 2.0f;
+    const auto& data = unit.data_;
+    auto unit_entity = entity_factory_->createPlayerUnit(data.class_id_, position, data.level_, data.rarity_);
+    registry_.emplace<engine::component::NameComponent>(unit_entity, data.name_id_, data.name_);
+    registry_.emplace<game::component::PlaceOccupiedComponent>(place, unit_entity);
+    game_stats_.cost_ -= unit.cost_;
+    if (registry_.all_of<game::defs::PassiveSkillTag>(unit_entity)) {
+        dispatcher_.enqueue(game::defs::SkillActiveEvent{unit_entity});
+    }
+    return true;
+}
+
+void BattleSimulation::finish(SimulationOutcome outcome) {
+    if (is_finished_) return;
+    is_finished_ = true;
+    result_.outcome_ = outcome;
+    result_.enemy_killed_count_ = game_stats_.enemy_killed_count_;
+    result_.enemy_arrived_count_ = game_stats_.enemy_arrived_count_;
+    result_.home_hp_ = game_stats_.home_hp_;
+    result_.end_time_ = game_time_;
+}
+
+void BattleSimulation::onRemovePlayerUnitEvent(const game::defs::RemovePlayerUnitEvent& event) {
+    // 与 PlaceUnitSystem::onRemoveUnitEvent 相同：标记死亡并释放所占地点
+    registry_.emplace_or_replace<game::defs::DeadTag>(event.entity_);
+    auto view = registry_.view<game::component::PlaceOccupiedComponent>();
+    for (auto entity : view) {
+        if (view.get<game::component::PlaceOccupiedComponent>(entity).entity_ == event.entity_) {
+            registry_.remove<game::component::PlaceOccupiedComponent>(entity);
+            break;
+        }
+    }
+}
+
+void BattleSimulation::onSkillReadyEvent(const game::defs::SkillReadyEvent& event) {
+    // 主动技能就绪后立即释放
+    if (event.entity_ == entt::null || !registry_.valid(event.entity_) ||
+        registry_.all_of<game::defs::PassiveSkillTag>(event.entity_)) return;
+    dispatcher_.enqueue(game::defs::SkillActiveEvent{event.entity_});
+}
+
+void BattleSimulation::onLevelClearDelayedEvent(const game::defs::LevelClearDelayedEvent&) {
+    // 通关时间取判定通关的时刻，不计场景切换前的延迟
+    finish(SimulationOutcome::WIN);
+}
+
+void BattleSimulation::onGameEndEvent(const game::defs::GameEndEvent& event) {
+    finish(event.is_win_ ? SimulationOutcome::WIN : SimulationOutcome::LOSE);
+}
+
+} // namespace game::simulation
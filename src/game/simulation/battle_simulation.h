@@ -0,0 +1,190 @@
+#pragma once
+#include "game/data/waypoint_node.h"
+#include "game/data/session_data.h"
+#include "game/data/game_stats.h"
+#include "game/data/level_data.h"
+#include "game/defs/constants.h"
+#include "game/defs/events.h"
+#include "game/system/fwd.h"
+#include "engine/system/fwd.h"
+#include "engine/utils/random.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <entt/entity/registry.hpp>
+#include <entt/signal/dispatcher.hpp>
+
+namespace game::data {
+    class LevelTemplate;
+    class LevelConfig;
+}
+
+namespace game::factory {
+    class EntityFactory;
+    class BlueprintManager;
+}
+
+namespace game::spawner {
+    class EnemySpawner;
+}
+
+namespace game::simulation {
+
+/// @brief 脚本化的单位放置策略
+enum class PlacementPolicy : std::uint8_t {
+    RANDOM,             ///< @brief 随机选择买得起的单位
+    CHEAPEST_FIRST,     ///< @brief 总是先放最便宜的单位
+    EXPENSIVE_FIRST,    ///< @brief 总是先放最贵的单位（攒够cost再放）
+};
+
+std::string_view toString(PlacementPolicy policy);
+
+/// @brief 一次模拟的结果
+enum class SimulationOutcome : std::uint8_t {
+    WIN,        ///< @brief 所有敌人被击杀或到达基地，且基地血量大于0
+    LOSE,       ///< @brief 基地被摧毁
+    TIMEOUT,    ///< @brief 超过最长游戏时间仍未结束
+    ABORTED,    ///< @brief 模拟出错而中止（见日志）
+};
+
+std::string_view toString(SimulationOutcome outcome);
+
+/**
+ * @brief 一关的模拟输入，由主线程准备，所有模拟线程只读共享
+ */
+struct SimulationLevel {
+    int level_number_{1};                                               ///< @brief 关卡号
+    std::shared_ptr<const game::data::LevelTemplate> level_template_;   ///< @brief 关卡模板（不含瓦片层）
+    game::data::Waves waves_;                                           ///< @brief 波次数据（每次模拟复制一份）
+    int enemy_count_{0};                                                ///< @brief 敌人总数
+};
+
+/**
+ * @brief 可供放置的单位（来自会话数据的角色列表）
+ */
+struct SimulationUnit {
+    game::data::UnitData data_;                                         ///< @brief 角色数据
+    game::defs::PlayerType type_{game::defs::PlayerType::UNKNOWN};      ///< @brief 近战/远程，决定可放置的地点
+    int cost_{0};                                                       ///< @brief 放置费用（与单位肖像UI的算法一致）
+};
+
+/**
+ * @brief 一次模拟的统计结果
+ */
+struct SimulationResult {
+    int level_number_{1};
+    PlacementPolicy policy_{PlacementPolicy::RANDOM};
+    std::uint64_t seed_{0};
+    SimulationOutcome outcome_{SimulationOutcome::ABORTED};
+    int enemy_killed_count_{0};         ///< @brief 击杀数
+    int enemy_arrived_count_{0};        ///< @brief 漏怪数（到达基地的敌人）
+    int home_hp_{0};                    ///< @brief 结束时的基地血量
+    int units_placed_{0};               ///< @brief 放置的单位数
+    float end_time_{0.0f};              ///< @brief 结束时的游戏时间（秒），通关时即通关用时
+    std::size_t peak_entities_{0};      ///< @brief 注册表中存活实体数的峰值
+};
+
+/**
+ * @brief 无渲染的战斗模拟
+ *
+ * 持有独立的注册表、事件分发器、随机数流和 GameScene 中的逻辑系统（不含渲染、UI、音频、输入相关系统），
+ * 以固定步长推进，按放置策略代替玩家放置单位、自动释放主动技能，直到通关、失败或超时。
+ * 不访问 Context 及任何可变全局状态，因此不同线程中的模拟可以并行运行；
+ * 蓝图管理器、关卡配置和关卡模板在模拟期间只读共享。
+ */
+class BattleSimulation final {
+public:
+    static constexpr float TIME_STEP{1.0f / 60.0f};     ///< @brief 固定步长（秒）
+    static constexpr float DECISION_INTERVAL{0.5f};     ///< @brief 放置策略的决策间隔（秒）
+
+private:
+    // 注册表和分发器声明在最前，保证系统先于它们析构（系统析构时会断开事件连接）
+    entt::registry registry_;
+    entt::dispatcher dispatcher_;
+    engine::utils::Random random_;
+
+    std::shared_ptr<game::factory::BlueprintManager> blueprint_manager_;
+    std::shared_ptr<game::data::LevelConfig> level_config_;
+    PlacementPolicy policy_;
+    std::vector<SimulationUnit> roster_;                                ///< @brief 尚未放置的单位
+
+    std::unordered_map<int, game::data::WaypointNode> waypoint_nodes_;
+    std::vector<int> start_points_;
+    game::data::GameStats game_stats_;
+    game::data::Waves waves_;
+    int level_number_{1};
+
+    std::unique_ptr<game::factory::EntityFactory> entity_factory_;
+    std::unique_ptr<engine::system::MovementSystem> movement_system_;
+    std::unique_ptr<engine::system::AnimationSystem> animation_system_;
+    std::unique_ptr<game::system::FollowPathSystem> follow_path_system_;
+    std::unique_ptr<game::system::RemoveDeadSystem> remove_dead_system_;
+    std::unique_ptr<game::system::BlockSystem> block_system_;
+    std::unique_ptr<game::system::SetTargetSystem> set_target_system_;
+    std::unique_ptr<game::system::AttackStarterSystem> attack_starter_system_;
+    std::unique_ptr<game::system::TimerSystem> timer_system_;
+    std::unique_ptr<game::system::OrientationSystem> orientation_system_;
+    std::unique_ptr<game::system::AnimationStateSystem> animation_state_system_;
+    std::unique_ptr<game::system::AnimationEventSystem> animation_event_system_;
+    std::unique_ptr<game::system::CombatResolveSystem> combat_resolve_system_;
+    std::unique_ptr<game::system::ProjectileSystem> projectile_system_;
+    std::unique_ptr<game::system::EffectSystem> effect_system_;
+    std::unique_ptr<game::system::GameRuleSystem> game_rule_system_;
+    std::unique_ptr<game::system::SkillSystem> skill_system_;
+    std::unique_ptr<game::spawner::EnemySpawner> enemy_spawner_;
+
+    SimulationResult result_;
+    float game_time_{0.0f};
+    float decision_timer_{0.0f};
+    bool is_finished_{false};
+    std::vector<entt::entity> free_places_;                             ///< @brief 放置时复用的空闲地点列表
+
+public:
+    /**
+     * @brief 构造函数（用关卡模板生成关卡并创建所有逻辑系统）
+     * @param level 关卡输入
+     * @param blueprint_manager 蓝图管理器（只读共享）
+     * @param level_config 关卡配置（只读共享）
+     * @param roster 可供放置的单位
+     * @param policy 放置策略
+     * @param seed 随机数种子
+     * @throw std::runtime_error 关卡模板为空时
+     */
+    BattleSimulation(const SimulationLevel& level,
+                     std::shared_ptr<game::factory::BlueprintManager> blueprint_manager,
+                     std::shared_ptr<game::data::LevelConfig> level_config,
+                     std::vector<SimulationUnit> roster,
+                     PlacementPolicy policy,
+                     std::uint64_t seed);
+    ~BattleSimulation();
+
+    BattleSimulation(const BattleSimulation&) = delete;
+    BattleSimulation& operator=(const BattleSimulation&) = delete;
+    BattleSimulation(BattleSimulation&&) = delete;
+    BattleSimulation& operator=(BattleSimulation&&) = delete;
+
+    /**
+     * @brief 运行到战斗结束
+     * @param max_game_time 最长游戏时间（秒），超过则记为超时
+     * @return 统计结果
+     */
+    SimulationResult run(float max_game_time);
+
+private:
+    void step(float delta_time);                        ///< @brief 推进一个固定步长（系统顺序与 GameScene::update 一致）
+    void applyPolicy();                                 ///< @brief 按放置策略放置单位
+    bool collectFreePlaces(game::defs::PlayerType type);///< @brief 把该类型单位可用的空闲地点收集到 free_places_，返回是否有空闲地点
+    bool placeUnit(const SimulationUnit& unit);         ///< @brief 把单位放到随机的空闲地点，没有空闲地点时返回 false
+    void finish(SimulationOutcome outcome);
+
+    // 事件回调函数
+    void onRemovePlayerUnitEvent(const game::defs::RemovePlayerUnitEvent& event);
+    void onSkillReadyEvent(const game::defs::SkillReadyEvent& event);
+    void onLevelClearDelayedEvent(const game::defs::LevelClearDelayedEvent& event);
+    void onGameEndEvent(const game::defs::GameEndEvent& event);
+};
+
+} // namespace game::simulation
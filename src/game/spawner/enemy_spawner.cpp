@@ -3,7 +3,7 @@
 #include "game/data/waypoint_node.h"
 #include "game/data/level_config.h"
 #include "game/factory/entity_factory.h"
-#include "engine/utils/math.h"
+#include "engine/utils/random.h"
 #include <entt/entity/registry.hpp>
 #include <entt/signal/dispatcher.hpp>
 #include <spdlog/spdlog.h>
@@ -35,8 +35,8 @@ void EnemySpawner::update(float delta_time) {
                     enemy_types_.push_back(class_id);
                 }
             }
-            // 打乱队列，确保敌人生成顺序随机
-            engine::utils::shuffle(enemy_types_.begin(), enemy_types_.end());
+            // 打乱队列，确保敌人生成顺序随机（使用场景的随机数流，保证录像回放时顺序一致）
+            registry_.ctx().get<engine::utils::Random&>().shuffle(enemy_types_.begin(), enemy_types_.end());
             
             // 本波次数据处理完毕，弹出关卡波次队列头
             waves.waves_.pop();
@@ -54,6 +54,12 @@ void EnemySpawner::update(float delta_time) {
     }
 }
 
+void EnemySpawner::restore(float spawn_timer, float spawn_interval, std::deque<entt::id_type> enemy_types) {
+    spawn_timer_ = spawn_timer;
+    spawn_interval_ = spawn_interval;
+    enemy_types_ = std::move(enemy_types);
+}
+
 void EnemySpawner::spawnEnemy() {
     // 获取上下文数据
     auto& start_points = registry_.ctx().get<std::vector<int>&>();
@@ -62,7 +68,8 @@ void EnemySpawner::spawnEnemy() {
     auto& level_number = registry_.ctx().get<int&>();
 
     // 随机选择起点
-    auto random_index = engine::utils::randomInt(0, start_points.size() - 1);
+    auto& random = registry_.ctx().get<engine::utils::Random&>();
+    auto random_index = random.randomInt(0, static_cast<int>(start_points.size()) - 1);
     auto start_index = start_points[random_index];
     auto position = waypoint_nodes[start_index].position_;
     auto level = level_config->getEnemyLevel(level_number);
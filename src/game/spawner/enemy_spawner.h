@@ -31,6 +31,13 @@ public:
 
     void update(float delta_time);
 
+    // --- 战斗快照 ---
+    float getSpawnTimer() const { return spawn_timer_; }
+    float getSpawnInterval() const { return spawn_interval_; }
+    const std::deque<entt::id_type>& getEnemyQueue() const { return enemy_types_; }
+    /// @brief 恢复波次内的生成进度（读取检查点时调用）
+    void restore(float spawn_timer, float spawn_interval, std::deque<entt::id_type> enemy_types);
+
 private:
     void spawnEnemy();
 };
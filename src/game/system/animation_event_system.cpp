@@ -7,6 +7,7 @@
 #include "game/component/projectile_component.h"
 #include "game/defs/tags.h"
 #include "game/defs/events.h"
+#include "engine/audio/voice_manager.h"
 #include "engine/component/transform_component.h"
 #include <entt/entity/registry.hpp>
 #include <entt/signal/dispatcher.hpp>
@@ -50,7 +51,7 @@ void AnimationEventSystem::handleHitEvent(const engine::utils::AnimationEvent& e
                 dispatcher_.enqueue(game::defs::AttackEvent{event.entity_, target_component->entity_, stats_component.atk_});
             }
             // 播放“hit”音效
-            dispatcher_.enqueue(engine::utils::PlaySoundEvent{event.entity_, "hit"_hs});
+            dispatcher_.enqueue(engine::utils::PlaySoundEvent{event.entity_, "hit"_hs, engine::audio::SOUND_PRIORITY_LOW});
         }
         return;
     }
@@ -89,7 +90,7 @@ void AnimationEventSystem::handleEmitEvent(const engine::utils::AnimationEvent&
         stats.atk_});
 
     // 播放“emit”音效
-    dispatcher_.enqueue(engine::utils::PlaySoundEvent{event.entity_, "emit"_hs});
+    dispatcher_.enqueue(engine::utils::PlaySoundEvent{event.entity_, "emit"_hs, engine::audio::SOUND_PRIORITY_LOW});
 }
 
 } // namespace game::system
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "attack_starter_system.h"
+#include "engine/debug/alloc_tracker.h"
 #include "game/component/enemy_component.h"
 #include "game/component/player_component.h"
 #include "game/component/blocked_by_component.h"
@@ -17,6 +18,7 @@ using namespace entt::literals;
 namespace game::system {
 
 void AttackStarterSystem::update(entt::registry& registry, entt::dispatcher& dispatcher) {
+    ENGINE_ALLOC_SCOPE("AttackStarterSystem");
     updateEnemyBlocked(registry, dispatcher);
     updateEnemyRanged(registry, dispatcher);
     updatePlayer(registry, dispatcher);
@@ -1,4 +1,5 @@
 #include "block_system.h"
+#include "engine/debug/alloc_tracker.h"
 #include "game/component/blocker_component.h"
 #include "game/component/enemy_component.h"
 #include "game/component/blocked_by_component.h"
@@ -16,6 +17,7 @@ using namespace entt::literals;
 namespace game::system {
 
 void BlockSystem::update(entt::registry& registry, entt::dispatcher& dispatcher) {
+    ENGINE_ALLOC_SCOPE("BlockSystem");
     spdlog::trace("BlockSystem::update");
     // --- 检查阻挡者是否依然有效 ---
     auto view_blocked_by = registry.view<game::component::BlockedByComponent>();   
@@ -4,6 +4,13 @@
 #include "game/component/blocker_component.h"
 #include "game/component/skill_component.h"
 #include "game/component/player_component.h"
+#include "game/component/enemy_component.h"
+#include "game/component/target_component.h"
+#include "game/component/blocked_by_component.h"
+#include "game/component/cost_regen_component.h"
+#include "game/component/place_occupied_component.h"
+#include "game/component/projectile_component.h"
+#include "game/component/unit_prep_component.h"
 #include "game/defs/tags.h"
 #include "game/defs/events.h"
 #include "game/data/game_stats.h"
@@ -18,9 +25,17 @@
 #include "engine/core/context.h"
 #include "engine/core/game_state.h"
 #include "engine/core/time.h"
+#include "engine/input/input_manager.h"
+#include "engine/core/frame_arena.h"
+#include "engine/core/async_file_writer.h"
+#include "engine/debug/memory_profiler.h"
+#include "engine/debug/alloc_tracker.h"
 #include "engine/render/renderer.h"
 #include "engine/resource/resource_manager.h"
 #include "engine/utils/math.h"
+#include "engine/utils/events.h"
+#include <cfloat>
+#include <cstdio>
 #include <imgui.h>
 #include <imgui_impl_sdl3.h>
 #include <imgui_impl_sdlrenderer3.h>
@@ -36,8 +51,28 @@ namespace game::system {
 
 DebugUISystem::DebugUISystem(entt::registry& registry, engine::core::Context& context)
     : registry_(registry), context_(context) {
+    // 登记游戏层的组件类型（引擎层的组件由MemoryProfiler自行登记）
+    memory_profiler_ = std::make_unique<engine::debug::MemoryProfiler>();
+    memory_profiler_->track<game::component::StatsComponent>();
+    memory_profiler_->track<game::component::BlockerComponent>();
+    memory_profiler_->track<game::component::BlockedByComponent>();
+    memory_profiler_->track<game::component::PlayerComponent>();
+    memory_profiler_->track<game::component::EnemyComponent>();
+    memory_profiler_->track<game::component::TargetComponent>();
+    memory_profiler_->track<game::component::CostRegenComponent>();
+    memory_profiler_->track<game::component::PlaceOccupiedComponent>();
+    memory_profiler_->track<game::component::ProjectileComponent>();
+    memory_profiler_->track<game::component::ProjectileIDComponent>();
+    memory_profiler_->track<game::component::UnitPrepComponent>();
+    memory_profiler_->track<game::component::ClassNameComponent>([](const game::component::ClassNameComponent& class_name) {
+        return engine::debug::heapBytes(class_name.class_name_);
+    });
+    memory_profiler_->track<game::component::SkillComponent>([](const game::component::SkillComponent& skill) {
+        return engine::debug::heapBytes(skill.name_) + engine::debug::heapBytes(skill.description_);
+    });
     context_.getDispatcher().sink<game::defs::UIPortraitHoverEnterEvent>().connect<&DebugUISystem::onUIPortraitHoverEnterEvent>(this);
     context_.getDispatcher().sink<game::defs::UIPortraitHoverLeaveEvent>().connect<&DebugUISystem::onUIPortraitHoverLeaveEvent>(this);
+    context_.getDispatcher().sink<engine::utils::FileWrittenEvent>().connect<&DebugUISystem::onFileWrittenEvent>(this);
 }
 
 DebugUISystem::~DebugUISystem() {
@@ -52,6 +87,7 @@ void DebugUISystem::update() {
     renderInfoUI();
     renderSettingUI();
     renderDebugUI();
+    renderMemoryUI();
     // 渲染可能激活的保存面板
     auto& show_save_panel = registry_.ctx().get<bool&>("show_save_panel"_hs);
     renderSavePanelUI(show_save_panel);
@@ -97,9 +133,11 @@ void DebugUISystem::beginFrame() {
 }
 
 void DebugUISystem::endFrame() {
-    // ImGui: 渲染
+    // ImGui: 渲染（绕过 Renderer 直接使用 SDL_Renderer，之后 Renderer 缓存的颜色状态不再可靠）
     ImGui::Render();
-    ImGui_ImplSDLRenderer3_RenderDrawData(ImGui::GetDrawData(), context_.getRenderer().getSDLRenderer());
+    auto& renderer = context_.getRenderer();
+    ImGui_ImplSDLRenderer3_RenderDrawData(ImGui::GetDrawData(), renderer.getSDLRenderer());
+    renderer.invalidateStateCache();
     
     // 渲染完成后，打开(恢复)逻辑分辨率
     if (!context_.getGameState().enableLogicalPresentation()) {
@@ -364,6 +402,8 @@ void DebugUISystem::renderSettingUI() {
 
     // 切换调试工具显示 （勾选结果保存在show_debug_ui_中）
     ImGui::Checkbox("显示调试工具", &show_debug_ui_);
+    ImGui::SameLine();
+    ImGui::Checkbox("显示内存统计", &show_memory_ui_);
     ImGui::End();
 }
 
@@ -384,10 +424,184 @@ void DebugUISystem::renderDebugUI() {
     if (ImGui::Button("通关")) {
         context_.getDispatcher().enqueue<game::defs::LevelClearEvent>();
     }
+    ImGui::Separator();
+    // 检查点（战斗快照），快捷键 F5 保存、F9 读取
+    ImGui::SetNextItemShortcut(ImGuiKey_F5, ImGuiInputFlags_RouteAlways | ImGuiInputFlags_Tooltip);
+    if (ImGui::Button("保存检查点")) {
+        context_.getDispatcher().enqueue<game::defs::SaveCheckpointEvent>();
+    }
+    ImGui::SetNextItemShortcut(ImGuiKey_F9, ImGuiInputFlags_RouteAlways | ImGuiInputFlags_Tooltip);
+    if (ImGui::Button("读取检查点")) {
+        context_.getDispatcher().enqueue<game::defs::LoadCheckpointEvent>();
+    }
+    if (ImGui::Button("回退检查点")) {
+        context_.getDispatcher().enqueue<game::defs::RewindCheckpointEvent>();
+    }
+    // 上一帧的绘制统计（不含调试UI自身的绘制）
+    ImGui::SeparatorText("渲染统计");
+    const auto& render_stats = context_.getRenderer().getLastFrameStats();
+    ImGui::Text("绘制调用: %zu    顶点: %zu", render_stats.draw_calls_, render_stats.vertices_);
+    ImGui::Text("纹理绘制: %zu    纹理切换: %zu", render_stats.texture_draws_, render_stats.texture_switches_);
+    ImGui::Text("颜色调整: %zu    透明度调整: %zu    绘制颜色: %zu",
+                render_stats.color_mod_changes_, render_stats.alpha_mod_changes_, render_stats.draw_color_changes_);
+    ImGui::Text("文本: %zu", render_stats.text_draws_);
+    ImGui::Text("世界绘制: %zu    裁剪: %zu", render_stats.world_draws_, render_stats.world_culled_);
+    // 帧时间：最近 FRAME_HISTORY 帧的分布与错过截止时间的帧数
+    ImGui::SeparatorText("帧时间");
+    const auto& time = context_.getTime();
+    const auto frame_stats = time.getFrameTimeStats();
+    const auto& frame_history = time.getFrameTimeHistory();
+    ImGui::PlotLines("##frame_times", frame_history.data(), static_cast<int>(frame_history.size()),
+                     static_cast<int>(time.getFrameTimeHistoryOffset()), nullptr, 0.0f, frame_stats.max_ms_, ImVec2(0.0f, 50.0f));
+    ImGui::Text("目标: %d FPS (%s)    平均: %.2f ms",
+                time.getTargetFps(), engine::core::toString(time.getFramePacing()).data(), frame_stats.average_ms_);
+    ImGui::Text("P50: %.2f ms    P99: %.2f ms    最大: %.2f ms", frame_stats.p50_ms_, frame_stats.p99_ms_, frame_stats.max_ms_);
+    ImGui::Text("错过截止: %zu / %zu (累计 %zu)    睡眠1ms实际: %.2f ms",
+                frame_stats.missed_deadlines_, frame_stats.samples_, frame_stats.total_missed_deadlines_, frame_stats.sleep_overshoot_ms_);
+    // 输入延迟：输入事件（SDL 时间戳）及延迟锁存的鼠标采样到呈现完成的时间
+    ImGui::SeparatorText("输入延迟");
+    const auto& latency_stats = context_.getInputManager().getLatencyStats();
+    ImGui::Text("输入->呈现: %.2f ms    平均: %.2f ms    最大: %.2f ms",
+                latency_stats.input_to_present_ms_, latency_stats.average_input_to_present_ms_, latency_stats.max_input_to_present_ms_);
+    ImGui::Text("鼠标锁存->呈现: %.2f ms    修正: %.1f px    事件: %zu",
+                latency_stats.latch_to_present_ms_, latency_stats.latch_correction_px_, latency_stats.events_);
+    // 音效声部：占用率即混音器负载（每个正在播放的声部都要参与混音）
+    ImGui::SeparatorText("音效声部");
+    const auto& voice_stats = context_.getAudioPlayer().getVoiceStats();
+    char voice_overlay[32];
+    std::snprintf(voice_overlay, sizeof(voice_overlay), "%zu / %zu", voice_stats.active_voices_, voice_stats.voice_count_);
+    ImGui::ProgressBar(voice_stats.voice_count_ > 0 ? static_cast<float>(voice_stats.active_voices_) / voice_stats.voice_count_ : 0.0f,
+                       ImVec2(200.0f, 0.0f), voice_overlay);
+    ImGui::SameLine();
+    ImGui::Text("峰值: %zu", voice_stats.peak_active_voices_);
+    ImGui::Text("请求: %zu    播放: %zu    合并: %zu", voice_stats.requests_, voice_stats.started_, voice_stats.deduplicated_);
+    ImGui::Text("超限: %zu    抢占: %zu    拒绝: %zu    距离剔除: %zu",
+                voice_stats.capped_, voice_stats.stolen_, voice_stats.rejected_, voice_stats.inaudible_);
     // TODO: 未来可按需添加其他调试工具
     ImGui::End();
 }
 
+void DebugUISystem::renderMemoryUI() {
+    if (!show_memory_ui_) return;
+    // 定时采样（遍历所有存储的开销不小，不必每帧进行）
+    memory_sample_timer_ -= context_.getTime().getUnscaledDeltaTime();
+    if (memory_sample_timer_ <= 0.0f) {
+        memory_sample_timer_ = MEMORY_SAMPLE_INTERVAL;
+        auto snapshot = memory_profiler_->capture(registry_, context_.getDispatcher(), context_.getResourceManager());
+        snapshot.render_ = context_.getRenderer().getLastFrameStats();
+        snapshot.frame_time_ = context_.getTime().getFrameTimeStats();
+        memory_profiler_->record(std::move(snapshot));
+    }
+
+    if (!ImGui::Begin("内存统计", &show_memory_ui_)) {
+        ImGui::End();
+        return;
+    }
+    constexpr float KB = 1024.0f;
+    const auto& snapshot = memory_profiler_->getLatest();
+    const auto& resources = snapshot.resources_;
+    ImGui::Text("实体数量: %zu    待处理事件: %zu", snapshot.entity_count_, snapshot.pending_events_);
+    ImGui::Text("ECS存储: %.1f KB    组件堆内存: %.1f KB", snapshot.ecs_bytes_ / KB, snapshot.ecs_heap_bytes_ / KB);
+    ImGui::Text("纹理: %zu 个, %.1f KB    音效: %zu 个, %.1f KB    音乐: %zu 个, %.1f KB",
+                resources.texture_count_, resources.texture_bytes_ / KB,
+                resources.sound_count_, resources.sound_bytes_ / KB,
+                resources.music_count_, resources.music_bytes_ / KB);
+    ImGui::Text("纹理预算: %.1f MB    被引用: %zu 个    累计逐出: %zu 次    重新载入: %zu 次",
+                resources.texture_budget_bytes_ / (KB * KB), resources.texture_referenced_count_,
+                resources.texture_evictions_, resources.texture_reloads_);
+    // 按加载策略分类的音频（流式播放的音乐不常驻内存）
+    for (size_t i = 0; i < resources.audio_policies_.size(); ++i) {
+        const auto& policy = resources.audio_policies_[i];
+        const auto name = engine::resource::toString(static_cast<engine::resource::AudioLoadPolicy>(i));
+        ImGui::Text("  音频[%.*s]: 登记 %zu 个, 常驻 %zu 个, %.1f KB", static_cast<int>(name.size()), name.data(),
+                    policy.registered_, policy.loaded_, policy.bytes_ / KB);
+    }
+    const auto& frame_arena = context_.getFrameArena();
+    ImGui::Text("帧内存: 上一帧 %.1f KB / 容量 %.1f KB    峰值: %.1f KB    溢出帧数: %zu",
+                frame_arena.getLastFrameUsed() / KB, frame_arena.getCapacity() / KB,
+                frame_arena.getHighWaterMark() / KB, frame_arena.getOverflowFrames());
+
+    // 总内存历史曲线
+    const auto& history = memory_profiler_->getHistory();
+    char overlay[32];
+    std::snprintf(overlay, sizeof(overlay), "合计 %.2f MB", snapshot.getTotalBytes() / (KB * KB));
+    ImGui::PlotLines("##memory_history", history.data(), static_cast<int>(history.size()),
+                     static_cast<int>(memory_profiler_->getHistoryOffset()), overlay,
+                     0.0f, FLT_MAX, ImVec2(0.0f, 60.0f));
+
+    if (ImGui::Button("导出JSON")) {
+        engine::debug::MemoryProfiler::dumpJson(snapshot, "memory_stats.json");
+    }
+
+    // 各组件存储明细
+    if (ImGui::BeginTable("组件存储", 5, ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY,
+                          ImVec2(0.0f, 300.0f))) {
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("组件");
+        ImGui::TableSetupColumn("数量");
+        ImGui::TableSetupColumn("容量");
+        ImGui::TableSetupColumn("存储(KB)");
+        ImGui::TableSetupColumn("堆(KB)");
+        ImGui::TableHeadersRow();
+        for (const auto& stats : snapshot.storages_) {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(stats.name_.c_str());
+            ImGui::TableNextColumn();
+            ImGui::Text("%zu", stats.count_);
+            ImGui::TableNextColumn();
+            ImGui::Text("%zu", stats.capacity_);
+            ImGui::TableNextColumn();
+            ImGui::Text(stats.tracked_ ? "%.1f" : "%.1f*", stats.bytes_ / KB);   // *: 未登记类型，不含组件数据
+            ImGui::TableNextColumn();
+            ImGui::Text("%.1f", stats.heap_bytes_ / KB);
+        }
+        ImGui::EndTable();
+    }
+
+    // 每帧堆分配统计（需要开启 ENABLE_ALLOC_TRACKING）
+    ImGui::SeparatorText("堆分配");
+    if (!engine::debug::AllocTracker::isEnabled()) {
+        ImGui::TextDisabled("未开启分配追踪 (CMake 选项 ENABLE_ALLOC_TRACKING)");
+    } else {
+        const auto last_frame = engine::debug::AllocTracker::getLastFrame();
+        const auto& alloc_history = engine::debug::AllocTracker::getHistory();
+        std::snprintf(overlay, sizeof(overlay), "%llu 次/帧", static_cast<unsigned long long>(last_frame.count_));
+        ImGui::PlotLines("##alloc_history", alloc_history.data(), static_cast<int>(alloc_history.size()),
+                         static_cast<int>(engine::debug::AllocTracker::getHistoryOffset()), overlay,
+                         0.0f, FLT_MAX, ImVec2(0.0f, 60.0f));
+        ImGui::Text("上一帧: %llu 次, %.1f KB", static_cast<unsigned long long>(last_frame.count_), last_frame.bytes_ / KB);
+        if (ImGui::BeginTable("作用域分配", 4, ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_RowBg)) {
+            ImGui::TableSetupColumn("作用域");
+            ImGui::TableSetupColumn("次数/帧");
+            ImGui::TableSetupColumn("字节/帧");
+            ImGui::TableSetupColumn("ZERO_ALLOC违规");
+            ImGui::TableHeadersRow();
+            const auto& scopes = engine::debug::AllocTracker::getScopes();
+            for (size_t i = 0; i < engine::debug::AllocTracker::getScopeCount(); ++i) {
+                const auto& scope = scopes[i];
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(scope.name_);
+                ImGui::TableNextColumn();
+                ImGui::Text("%llu", static_cast<unsigned long long>(scope.last_frame_.count_));
+                ImGui::TableNextColumn();
+                ImGui::Text("%llu", static_cast<unsigned long long>(scope.last_frame_.bytes_));
+                ImGui::TableNextColumn();
+                if (!scope.zero_alloc_) {
+                    ImGui::TextDisabled("-");
+                } else if (scope.violations_ > 0) {
+                    ImGui::TextColored(ImVec4(1.0f, 0.3f, 0.3f, 1.0f), "%llu", static_cast<unsigned long long>(scope.violations_));
+                } else {
+                    ImGui::Text("0");
+                }
+            }
+            ImGui::EndTable();
+        }
+    }
+    ImGui::End();
+}
+
 // ----------------------------- TitleScene -----------------------------
 void DebugUISystem::renderTitleLogo() {
     if (!ImGui::Begin("TitleLogo", nullptr, ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoBackground)) {
@@ -576,16 +790,21 @@ void DebugUISystem::renderSavePanelUI(bool& show_save_panel) {
         return;
     }
     const auto& session_data = registry_.ctx().get<std::shared_ptr<game::data::SessionData>>();
+    // 主线程只序列化，写盘交给后台线程（完成后通过 FileWrittenEvent 通知）
+    auto& file_writer = context_.getFileWriter();
     if (ImGui::Button("SLOT 1")) {        
-        session_data->saveToFile("assets/save/SLOT_1.json");
+        file_writer.write("assets/save/SLOT_1.json", session_data->serialize());
     }
     ImGui::SameLine();
     if (ImGui::Button("SLOT 2")) {
-        session_data->saveToFile("assets/save/SLOT_2.json");
+        file_writer.write("assets/save/SLOT_2.json", session_data->serialize());
     }
     ImGui::SameLine();
     if (ImGui::Button("SLOT 3")) {
-        session_data->saveToFile("assets/save/SLOT_3.json");
+        file_writer.write("assets/save/SLOT_3.json", session_data->serialize());
+    }
+    if (!save_status_.empty()) {
+        ImGui::Text("%s", save_status_.c_str());
     }
     // 根据是否已经通关，切换显示提示信息
     if (session_data->isLevelClear()) {
@@ -833,4 +1052,8 @@ void DebugUISystem::onUIPortraitHoverLeaveEvent() {
     hovered_portrait_ = entt::null;
 }
 
+void DebugUISystem::onFileWrittenEvent(const engine::utils::FileWrittenEvent& event) {
+    save_status_ = event.success_ ? "已保存: " + event.path_ : "保存失败: " + event.path_;
+}
+
 } // namespace game::system
\ No newline at end of file
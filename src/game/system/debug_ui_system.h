@@ -1,4 +1,6 @@
 #pragma once
+#include <memory>
+#include <string>
 #include <entt/entity/fwd.hpp>
 #include <entt/entity/entity.hpp>
 #include "game/defs/events.h"
@@ -7,6 +9,14 @@ namespace engine::core {
     class Context;
 }
 
+namespace engine::debug {
+    class MemoryProfiler;
+}
+
+namespace engine::utils {
+    struct FileWrittenEvent;
+}
+
 namespace game::scene {
     class TitleScene;
     class LevelClearScene;
@@ -27,6 +37,13 @@ class DebugUISystem {
 
     entt::id_type hovered_portrait_{entt::null};    ///< @brief 悬浮肖像的角色名称ID
     bool show_debug_ui_{true};                      ///< @brief 是否显示调试UI
+    bool show_memory_ui_{false};                    ///< @brief 是否显示内存统计面板
+
+    std::unique_ptr<engine::debug::MemoryProfiler> memory_profiler_;    ///< @brief 内存统计工具
+    float memory_sample_timer_{0.0f};               ///< @brief 距下次采样的剩余时间（秒）
+    static constexpr float MEMORY_SAMPLE_INTERVAL{0.5f};    ///< @brief 内存采样间隔（秒）
+
+    std::string save_status_;                       ///< @brief 最近一次存档的结果（显示在存档面板中）
 
 public:
     DebugUISystem(entt::registry& registry, engine::core::Context& context);
@@ -51,6 +68,7 @@ private:
     void renderInfoUI();
     void renderSettingUI();
     void renderDebugUI();
+    void renderMemoryUI();
 
     // --- TitleScene ---
     void renderTitleLogo();
@@ -74,6 +92,7 @@ private:
     // 事件回调函数
     void onUIPortraitHoverEnterEvent(const game::defs::UIPortraitHoverEnterEvent& event);
     void onUIPortraitHoverLeaveEvent();
+    void onFileWrittenEvent(const engine::utils::FileWrittenEvent& event);
 
 };
 
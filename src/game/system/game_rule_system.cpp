@@ -48,6 +48,11 @@ void GameRuleSystem::update(float delta_time) {
     }
 }
 
+void GameRuleSystem::restore(bool is_level_clear, float level_clear_timer) {
+    is_level_clear_ = is_level_clear;
+    level_clear_timer_ = level_clear_timer;
+}
+
 void GameRuleSystem::onEnemyArriveHome(const game::defs::EnemyArriveHomeEvent&) {
     spdlog::info("敌人到达基地");
     auto& game_stats = registry_.ctx().get<game::data::GameStats&>();
@@ -23,6 +23,12 @@ public:
 
     void update(float delta_time);
 
+    // --- 战斗快照 ---
+    bool isLevelClear() const { return is_level_clear_; }
+    float getLevelClearTimer() const { return level_clear_timer_; }
+    /// @brief 恢复通关状态（读取检查点时调用）
+    void restore(bool is_level_clear, float level_clear_timer);
+
 private:
     // 事件回调函数
     void onEnemyArriveHome(const game::defs::EnemyArriveHomeEvent& event);
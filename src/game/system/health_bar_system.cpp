@@ -1,6 +1,8 @@
 #include "health_bar_system.h"
+#include "engine/debug/alloc_tracker.h"
 #include "game/component/stats_component.h"
 #include "engine/component/transform_component.h"
+#include "engine/defs/tags.h"
 #include "game/defs/tags.h"
 #include "game/defs/constants.h"
 #include "engine/render/renderer.h"
@@ -11,8 +13,10 @@
 namespace game::system {
 
 void HealthBarSystem::update(entt::registry& registry, engine::render::Renderer& renderer, engine::render::Camera& camera) {
-    // 只有受伤的实体才显示血量标签
-    auto view = registry.view<engine::component::TransformComponent,
+    ENGINE_ALLOC_SCOPE("HealthBarSystem");
+    // 只有受伤且可见的实体才显示血量标签
+    auto view = registry.view<engine::defs::VisibleTag,
+        engine::component::TransformComponent,
         game::component::StatsComponent,
         game::defs::HasHealthBarTag,
         game::defs::InjuredTag>();
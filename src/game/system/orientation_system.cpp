@@ -1,4 +1,5 @@
 #include "orientation_system.h"
+#include "engine/debug/alloc_tracker.h"
 #include "game/component/enemy_component.h"
 #include "game/component/target_component.h"
 #include "game/component/blocked_by_component.h"
@@ -11,6 +12,7 @@
 namespace game::system {
 
 void OrientationSystem::update(entt::registry& registry) {
+    ENGINE_ALLOC_SCOPE("OrientationSystem");
     updateHasTarget(registry);
     updateBlocked(registry);
     updateMoving(registry);     // 移动处理最后调用，确保优先级最高
@@ -51,11 +51,11 @@ void PlaceUnitSystem::update(float) {
     target_place_entity_ = entt::null;
 
     auto view = registry_.view<game::component::UnitPrepComponent, engine::component::TransformComponent>();
+    // 位置同步到鼠标（绘制时还会按渲染前重新采样的鼠标位置修正，见 FollowCursorTag；
+    // 下面的有效性颜色和目标放置点仍按这里的位置计算，鼠标快速移动时可能与画面相差一帧）
+    const auto mouse_pos_world = context_.getCamera().screenToWorld(context_.getInputManager().getLogicalMousePosition());
     // 虽然是循环，但拥有UnitPrepComponent的实体最多只有一个
     for (auto entity : view) {
-        // 位置同步到到鼠标
-        const auto& mouse_pos_screen = context_.getInputManager().getLogicalMousePosition();
-        const auto mouse_pos_world = context_.getCamera().screenToWorld(mouse_pos_screen);
         auto& transform = view.get<engine::component::TransformComponent>(entity);
         transform.position_ = mouse_pos_world;
 
@@ -177,7 +177,7 @@ bool PlaceUnitSystem::onPlaceUnit() {
 
     }
     // 播放放置音效
-    context_.getAudioPlayer().playSound("unit_placed"_hs);
+    context_.getAudioPlayer().playSound("unit_placed"_hs, engine::audio::SOUND_PRIORITY_HIGH);
     return true;
 }
 
@@ -1,8 +1,10 @@
 #include "projectile_system.h"
+#include "engine/debug/alloc_tracker.h"
 #include "game/component/projectile_component.h"
 #include "game/defs/tags.h"
 #include "game/defs/events.h"
 #include "game/factory/entity_factory.h"
+#include "engine/audio/voice_manager.h"
 #include "engine/component/transform_component.h"
 #include "engine/utils/events.h"
 #include <entt/entity/registry.hpp>
@@ -26,6 +28,7 @@ ProjectileSystem::~ProjectileSystem() {
 }
 
 void ProjectileSystem::update(float delta_time) {
+    ENGINE_ALLOC_SCOPE("ProjectileSystem");
     // 获取所有投射物
     auto view = registry_.view<game::component::ProjectileComponent, engine::component::TransformComponent>();
     for (auto entity : view) {
@@ -36,7 +39,7 @@ void ProjectileSystem::update(float delta_time) {
         // 如果飞行时间超过总飞行时间，则命中目标（发送攻击事件以及播放音效）并销毁
         if (projectile.current_flight_time_ >= projectile.total_flight_time_) {
             dispatcher_.enqueue(game::defs::AttackEvent{entity, projectile.target_, projectile.damage_});
-            dispatcher_.enqueue(engine::utils::PlaySoundEvent{entity, "hit"_hs});
+            dispatcher_.enqueue(engine::utils::PlaySoundEvent{entity, "hit"_hs, engine::audio::SOUND_PRIORITY_LOW});
             registry_.emplace<game::defs::DeadTag>(entity);
             continue;
         }
@@ -12,12 +12,14 @@ namespace game::system {
 void RenderRangeSystem::update(entt::registry& registry, engine::render::Renderer& renderer, const engine::render::Camera& camera) {
     // 准备放置类型的单位
     auto view_prep = registry.view<game::defs::ShowRangeTag, engine::component::TransformComponent, game::component::UnitPrepComponent>();
+    renderer.setFollowCursor(true);     // 准备单位跟随鼠标，攻击范围也随之修正
     for (auto entity : view_prep) {
         auto& transform = view_prep.get<engine::component::TransformComponent>(entity);
         auto& prep = view_prep.get<game::component::UnitPrepComponent>(entity);
         // 攻击范围显示为透明绿色圆形
         renderer.drawFilledCircle(camera, transform.position_, prep.range_, game::defs::RANGE_COLOR);
     }
+    renderer.setFollowCursor(false);
     // 地图上的单位
     auto view_remote = registry.view<game::defs::ShowRangeTag, engine::component::TransformComponent, game::component::StatsComponent>();
     for (auto entity : view_remote) {
@@ -1,4 +1,5 @@
 #include "set_target_system.h"
+#include "engine/debug/alloc_tracker.h"
 #include "game/component/target_component.h"
 #include "game/component/stats_component.h"
 #include "game/component/player_component.h"
@@ -13,6 +14,7 @@
 namespace game::system {
 
 void SetTargetSystem::update(entt::registry& registry) {
+    ENGINE_ALLOC_SCOPE("SetTargetSystem");
     updateHasTarget(registry);
     updateNoTargetPlayer(registry);
     updateNoTargetEnemy(registry);
@@ -1,4 +1,5 @@
 #include "timer_system.h"
+#include "engine/debug/alloc_tracker.h"
 #include "game/component/stats_component.h"
 #include "game/component/skill_component.h"
 #include "game/defs/tags.h"
@@ -14,6 +15,7 @@ TimerSystem::TimerSystem(entt::registry& registry, entt::dispatcher& dispatcher)
 }
 
 void TimerSystem::update(float delta_time) {
+    ENGINE_ALLOC_SCOPE("TimerSystem");
     updateAttackTimer(delta_time);
     updateSkillCooldownTimer(delta_time);
     updateSkillDurationTimer(delta_time);
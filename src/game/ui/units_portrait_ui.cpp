@@ -17,6 +17,7 @@
 #include <entt/signal/dispatcher.hpp>
 #include <spdlog/spdlog.h>
 #include <glm/common.hpp>
+#include <algorithm>
 
 using namespace entt::literals;
 
@@ -188,6 +189,31 @@ void UnitsPortraitUI::movePortraitPanelLeft(float delta_time) {
     anchor_panel_->setPosition(panel_position);
 }
 
+std::vector<entt::id_type> UnitsPortraitUI::getPortraitIds() const {
+    std::vector<entt::id_type> name_ids;
+    name_ids.reserve(anchor_panel_->getChildren().size());
+    for (const auto& frame_panel : anchor_panel_->getChildren()) {
+        name_ids.push_back(frame_panel->getId());
+    }
+    return name_ids;
+}
+
+void UnitsPortraitUI::restorePortraits(const std::vector<entt::id_type>& name_ids) {
+    // 已移除的肖像无法找回，因此整体重建，再移除不在列表中的肖像
+    ui_manager_.getRootElement()->removeChild(anchor_panel_);
+    createUnitsPortraitUI();
+    std::vector<entt::id_type> removed_ids;
+    for (const auto& frame_panel : anchor_panel_->getChildren()) {
+        if (std::find(name_ids.begin(), name_ids.end(), frame_panel->getId()) == name_ids.end()) {
+            removed_ids.push_back(frame_panel->getId());
+        }
+    }
+    for (auto name_id : removed_ids) {
+        anchor_panel_->removeChildById(name_id);
+    }
+    arrangeUnitsPortraitUI();
+}
+
 void UnitsPortraitUI::onRemoveUIPortraitEvent(const game::defs::RemoveUIPortraitEvent& event) {
     anchor_panel_->removeChildById(event.name_id_);
     arrangeUnitsPortraitUI();
@@ -2,6 +2,7 @@
 #include "game/defs/events.h"
 #include <entt/entity/fwd.hpp>
 #include <glm/vec2.hpp>
+#include <vector>
 
 namespace engine::core {
     class Context;
@@ -43,6 +44,10 @@ public:
 
     engine::ui::UIPanel* getAnchorPanel() const { return anchor_panel_; }
 
+    // --- 战斗快照 ---
+    std::vector<entt::id_type> getPortraitIds() const;                  ///< @brief 获取尚未出击的角色肖像（名称ID）
+    void restorePortraits(const std::vector<entt::id_type>& name_ids);  ///< @brief 重建肖像UI，只保留指定的角色（读取检查点时调用）
+
 private:
     void updatePortraitCover();         ///< @brief 更新肖像遮盖
     void createUnitsPortraitUI();       ///< @brief 创建单位肖像UI
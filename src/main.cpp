@@ -1,10 +1,19 @@
 #include "engine/core/game_app.h"
 #include "engine/core/context.h"
 #include "game/scene/title_scene.h"
+#include "game/scene/game_scene.h"
+#include "game/scene/balance_scene.h"
+#include "game/scene/stream_bench_scene.h"
+#include "game/data/replay_data.h"
+#include "game/data/session_data.h"
 #include "engine/utils/events.h"
 #include <spdlog/spdlog.h>
 #include <SDL3/SDL_main.h>
 #include <entt/signal/dispatcher.hpp>
+#include <charconv>
+#include <memory>
+#include <string>
+#include <string_view>
 
 // 只在 Windows 平台上包含 Windows.h
 #ifdef _WIN32
@@ -26,12 +35,110 @@ void setupInitialScene(engine::core::Context& context) {
 }
 
 
-int main(int /* argc */, char* /* argv */[]) {
+void setupReplayScene(engine::core::Context& context,
+                      std::shared_ptr<const game::data::ReplayData> replay,
+                      std::shared_ptr<game::data::SessionData> session_data) {
+    // 回放录像：直接进入录像对应的关卡
+    auto game_scene = std::make_unique<game::scene::GameScene>(context,
+        nullptr,
+        std::move(session_data),
+        nullptr,
+        nullptr,
+        std::shared_future<std::shared_ptr<engine::loader::PreloadedLevel>>{},
+        nullptr,
+        std::move(replay)
+    );
+    context.getDispatcher().trigger<engine::utils::PushSceneEvent>(engine::utils::PushSceneEvent{std::move(game_scene)});
+}
+
+
+void setupBalanceScene(engine::core::Context& context,
+                       const game::simulation::BalanceConfig& config,
+                       int level_number,
+                       const std::string& output_prefix) {
+    // 平衡性测试：不进入游戏，直接运行模拟
+    auto balance_scene = std::make_unique<game::scene::BalanceScene>(context, config, level_number, output_prefix);
+    context.getDispatcher().trigger<engine::utils::PushSceneEvent>(engine::utils::PushSceneEvent{std::move(balance_scene)});
+}
+
+void setupStreamBenchScene(engine::core::Context& context, int map_size, const std::string& output_prefix) {
+    // 区块流式加载基准测试：相机平移扫过合成地图，输出帧耗时与内存统计
+    auto bench_scene = std::make_unique<game::scene::StreamBenchScene>(context, map_size, output_prefix);
+    context.getDispatcher().trigger<engine::utils::PushSceneEvent>(engine::utils::PushSceneEvent{std::move(bench_scene)});
+}
+
+// 解析整数参数（未提供时保持默认值）
+template<typename T>
+bool parseArgument(std::string_view text, T& value) {
+    if (text.empty()) return true;
+    const auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+    return ec == std::errc{} && ptr == text.data() + text.size();
+}
+
+
+int main(int argc, char* argv[]) {
     initialize_environment();
     spdlog::set_level(spdlog::level::info);
 
+    // 命令行参数 --replay <录像文件>：无界面、以最快速度回放录像（用于复现bug和性能尖峰）
+    // 命令行参数 --balance <次数>：无界面并行模拟关卡，输出平衡性报告
+    //     可选 --threads <线程数>、--level <关卡号>、--seed <种子>、--out <报告路径前缀>
+    // 命令行参数 --stream-bench <地图边长>：无界面平移相机扫过合成地图，输出区块流式加载的基准测试报告
+    //     可选 --out <报告路径前缀>
+    std::string_view replay_path;
+    std::string_view balance_runs, balance_threads, balance_level, balance_seed;
+    std::string_view report_prefix;
+    std::string_view stream_bench_size;
+    for (int i = 1; i + 1 < argc; ++i) {
+        const std::string_view arg = argv[i];
+        const std::string_view value = argv[i + 1];
+        if (arg == "--replay") replay_path = value;
+        else if (arg == "--balance") balance_runs = value;
+        else if (arg == "--threads") balance_threads = value;
+        else if (arg == "--level") balance_level = value;
+        else if (arg == "--seed") balance_seed = value;
+        else if (arg == "--out") report_prefix = value;
+        else if (arg == "--stream-bench") stream_bench_size = value;
+    }
+
     engine::core::GameApp app;
-    app.registerSceneSetup(setupInitialScene);
+    if (!stream_bench_size.empty()) {
+        int map_size = 256;
+        if (!parseArgument(stream_bench_size, map_size) || map_size <= 0) {
+            spdlog::error("流式加载基准测试参数无效");
+            return 1;
+        }
+        app.setHeadless(true);
+        app.registerSceneSetup([map_size, output_prefix = std::string(report_prefix.empty() ? "stream_bench" : report_prefix)](engine::core::Context& context) {
+            setupStreamBenchScene(context, map_size, output_prefix);
+        });
+    } else if (!balance_runs.empty()) {
+        game::simulation::BalanceConfig config;
+        int level_number = 0;
+        if (!parseArgument(balance_runs, config.runs_) || !parseArgument(balance_threads, config.threads_) ||
+            !parseArgument(balance_level, level_number) || !parseArgument(balance_seed, config.seed_)) {
+            spdlog::error("平衡性测试参数无效");
+            return 1;
+        }
+        app.setHeadless(true);
+        app.registerSceneSetup([config, level_number, output_prefix = std::string(report_prefix.empty() ? "balance_report" : report_prefix)](engine::core::Context& context) {
+            setupBalanceScene(context, config, level_number, output_prefix);
+        });
+    } else if (replay_path.empty()) {
+        app.registerSceneSetup(setupInitialScene);
+    } else {
+        auto replay = std::make_shared<game::data::ReplayData>();
+        auto session_data = std::make_shared<game::data::SessionData>();
+        if (!replay->loadFromFile(replay_path) || !session_data->deserialize(replay->session_data_)) {
+            spdlog::error("无法回放录像: {}", replay_path);
+            return 1;
+        }
+        app.setHeadless(true);
+        app.registerSceneSetup([replay = std::shared_ptr<const game::data::ReplayData>(std::move(replay)),
+                                session_data = std::move(session_data)](engine::core::Context& context) {
+            setupReplayScene(context, replay, session_data);
+        });
+    }
     app.run();
     return 0;
 }
\ No newline at end of file